@@ -5,7 +5,15 @@
 
 #include "AI.h"
 #include "Utils.h"
+#include "JobSystem.h"
+#include "AIScheduler.h"
+#include "UtilityAI.h"
+#include "AIPerception.h"
+#include "LatentTask.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
 #include <algorithm>
+#include <chrono>
 
 namespace UE4SDK
 {
@@ -15,8 +23,10 @@ namespace UE4SDK
         , m_BlackboardComponent(nullptr)
         , m_BehaviorTreeComponent(nullptr)
         , m_bIsActive(false)
-        , m_UpdateFrequency(1.0f)
-        , m_LastUpdateTime(0.0f)
+        , m_FrameSnapshot(nullptr)
+        , m_CommandBuffer(nullptr)
+        , m_AgentIndex(-1)
+        , m_PerceptionComponent(nullptr)
     {
     }
 
@@ -37,6 +47,14 @@ namespace UE4SDK
     void AIController::SetBlackboardComponent(BlackboardComponent* Component)
     {
         m_BlackboardComponent = Component;
+        if (m_BehaviorTreeComponent && m_BlackboardComponent)
+        {
+            m_BehaviorTreeComponent->SetBlackboard(m_BlackboardComponent->GetBlackboard());
+        }
+        if (m_PerceptionComponent)
+        {
+            m_PerceptionComponent->SetBlackboard(m_BlackboardComponent ? m_BlackboardComponent->GetBlackboard() : nullptr);
+        }
     }
 
     BlackboardComponent* AIController::GetBlackboardComponent() const
@@ -47,6 +65,10 @@ namespace UE4SDK
     void AIController::SetBehaviorTreeComponent(BehaviorTreeComponent* Component)
     {
         m_BehaviorTreeComponent = Component;
+        if (m_BehaviorTreeComponent && m_BlackboardComponent)
+        {
+            m_BehaviorTreeComponent->SetBlackboard(m_BlackboardComponent->GetBlackboard());
+        }
     }
 
     BehaviorTreeComponent* AIController::GetBehaviorTreeComponent() const
@@ -54,6 +76,22 @@ namespace UE4SDK
         return m_BehaviorTreeComponent;
     }
 
+    void AIController::SetPerceptionComponent(AIPerceptionComponent* Component)
+    {
+        if (m_PerceptionComponent)
+        {
+            AIPerceptionSystem::Get().UnregisterListener(m_PerceptionComponent);
+        }
+        
+        m_PerceptionComponent = Component;
+        if (m_PerceptionComponent)
+        {
+            m_PerceptionComponent->SetOwner(this);
+            m_PerceptionComponent->SetBlackboard(m_BlackboardComponent ? m_BlackboardComponent->GetBlackboard() : nullptr);
+            AIPerceptionSystem::Get().RegisterListener(m_PerceptionComponent);
+        }
+    }
+
     void AIController::SetActive(bool bActive)
     {
         m_bIsActive = bActive;
@@ -72,16 +110,6 @@ namespace UE4SDK
         return m_bIsActive;
     }
 
-    void AIController::SetUpdateFrequency(float Frequency)
-    {
-        m_UpdateFrequency = Frequency;
-    }
-
-    float AIController::GetUpdateFrequency() const
-    {
-        return m_UpdateFrequency;
-    }
-
     void AIController::Update(float DeltaTime)
     {
         if (!m_bIsActive)
@@ -89,12 +117,8 @@ namespace UE4SDK
             return;
         }
         
-        float CurrentTime = Utils::Get().GetTimeSinceStart();
-        if (CurrentTime - m_LastUpdateTime >= (1.0f / m_UpdateFrequency))
-        {
-            ProcessAI(DeltaTime);
-            m_LastUpdateTime = CurrentTime;
-        }
+        // AIScheduler decides when a controller ticks and hands it the time since its last tick
+        ProcessAI(DeltaTime);
     }
 
     void AIController::ProcessAI(float DeltaTime)
@@ -118,12 +142,49 @@ namespace UE4SDK
             return;
         }
         
+        // Read the pawn through the frame snapshot when one is available - the pawn is shared world state
+        const AIAgentSnapshot* Agent = m_FrameSnapshot ? m_FrameSnapshot->GetAgent(m_AgentIndex) : nullptr;
+        FVector SelfLocation = Agent ? Agent->Location : m_ControlledPawn->GetActorLocation();
+        FRotator SelfRotation = Agent ? Agent->Rotation : m_ControlledPawn->GetActorRotation();
+        
         // Update common blackboard values
-        m_BlackboardComponent->SetValueAsVector(TEXT("SelfLocation"), m_ControlledPawn->GetActorLocation());
-        m_BlackboardComponent->SetValueAsRotator(TEXT("SelfRotation"), m_ControlledPawn->GetActorRotation());
+        m_BlackboardComponent->SetValueAsVector(TEXT("SelfLocation"), SelfLocation);
+        m_BlackboardComponent->SetValueAsRotator(TEXT("SelfRotation"), SelfRotation);
         m_BlackboardComponent->SetValueAsBool(TEXT("IsActive"), m_bIsActive);
     }
 
+    void AIController::SetFrameContext(const AIFrameSnapshot* Snapshot, AICommandBuffer* CommandBuffer, int32 AgentIndex)
+    {
+        m_FrameSnapshot = Snapshot;
+        m_CommandBuffer = CommandBuffer;
+        m_AgentIndex = AgentIndex;
+    }
+
+    void AIController::ClearFrameContext()
+    {
+        m_FrameSnapshot = nullptr;
+        m_CommandBuffer = nullptr;
+        m_AgentIndex = -1;
+    }
+
+    void AIController::EnqueueSharedWrite(std::function<void()> Command)
+    {
+        if (!Command)
+        {
+            return;
+        }
+        
+        if (m_CommandBuffer)
+        {
+            m_CommandBuffer->Enqueue(std::move(Command));
+        }
+        else
+        {
+            // Not inside a parallel tick - safe to apply right away
+            Command();
+        }
+    }
+
     // BehaviorTree implementation
     BehaviorTree::BehaviorTree()
         : m_TreeName(TEXT("UnnamedBehaviorTree"))
@@ -191,8 +252,17 @@ namespace UE4SDK
         , m_CurrentNode(nullptr)
         , m_bIsRunning(false)
         , m_UpdateFrequency(1.0f)
-        , m_LastUpdateTime(0.0f)
+        , m_TimeSinceLastUpdate(0.0f)
+        , m_CompletedNode(nullptr)
+        , m_CompletedResult(ENodeExecutionResult::Success)
+        , m_Blackboard(nullptr)
+        , m_bNeedsExecution(false)
+    {
+    }
+
+    BehaviorTreeComponent::~BehaviorTreeComponent()
     {
+        UnregisterObservers();
     }
 
     void BehaviorTreeComponent::SetBehaviorTree(BehaviorTree* Tree)
@@ -209,6 +279,23 @@ namespace UE4SDK
         return m_BehaviorTree;
     }
 
+    void BehaviorTreeComponent::SetBlackboard(Blackboard* InBlackboard)
+    {
+        if (m_Blackboard == InBlackboard)
+        {
+            return;
+        }
+        
+        UnregisterObservers();
+        m_Blackboard = InBlackboard;
+        
+        if (m_bIsRunning)
+        {
+            RegisterObservers();
+            m_bNeedsExecution = true;
+        }
+    }
+
     void BehaviorTreeComponent::StartBehaviorTree()
     {
         if (!m_BehaviorTree || !m_BehaviorTree->IsValid())
@@ -217,16 +304,26 @@ namespace UE4SDK
             return;
         }
         
-        m_CurrentNode = m_BehaviorTree->GetRootNode();
+        AbortCurrentNode();
+        m_ChildProgress.Empty();
+        m_ActiveNodes.Empty();
+        m_CompletedNode = nullptr;
+        m_bNeedsExecution = true;
         m_bIsRunning = true;
+        RegisterObservers();
         
         Utils::Get().LogInfo(TEXT("BehaviorTreeComponent started: ") + m_BehaviorTree->GetTreeName());
     }
 
     void BehaviorTreeComponent::StopBehaviorTree()
     {
+        AbortCurrentNode();
+        UnregisterObservers();
+        m_ChildProgress.Empty();
+        m_ActiveNodes.Empty();
+        m_CompletedNode = nullptr;
+        m_bNeedsExecution = false;
         m_bIsRunning = false;
-        m_CurrentNode = nullptr;
         
         Utils::Get().LogInfo(TEXT("BehaviorTreeComponent stopped"));
     }
@@ -260,28 +357,68 @@ namespace UE4SDK
 
     void BehaviorTreeComponent::Update(float DeltaTime)
     {
-        if (!m_bIsRunning || !m_BehaviorTree || !m_CurrentNode)
+        // Nothing running and no observed input changed - the tree has nothing to do
+        if (!m_bIsRunning || !m_BehaviorTree || IsIdle())
         {
             return;
         }
         
-        float CurrentTime = Utils::Get().GetTimeSinceStart();
-        if (CurrentTime - m_LastUpdateTime >= (1.0f / m_UpdateFrequency))
+        m_TimeSinceLastUpdate += DeltaTime;
+        
+        // Observed changes are handled right away, only running actions are paced by the update frequency
+        if (m_bNeedsExecution || m_TimeSinceLastUpdate >= (1.0f / m_UpdateFrequency))
         {
-            ProcessCurrentNode(DeltaTime);
-            m_LastUpdateTime = CurrentTime;
+            float ElapsedTime = m_TimeSinceLastUpdate;
+            ProcessCurrentNode(ElapsedTime);
+            m_TimeSinceLastUpdate = 0.0f;
         }
     }
 
     void BehaviorTreeComponent::ProcessCurrentNode(float DeltaTime)
     {
-        if (!m_CurrentNode)
+        if (m_CurrentNode)
         {
-            return;
+            // Only the running action is ticked - its branch is guarded by decorator observers
+            ENodeExecutionResult Result = m_CurrentNode->Execute(DeltaTime);
+            if (Result == ENodeExecutionResult::Running)
+            {
+                return;
+            }
+            
+            // Hand the result back to the parent composites on the next descent
+            m_CompletedNode = m_CurrentNode;
+            m_CompletedResult = Result;
+            m_CurrentNode = nullptr;
+            m_bNeedsExecution = true;
+        }
+        
+        if (m_bNeedsExecution)
+        {
+            ExecuteTree(DeltaTime);
         }
+    }
+
+    void BehaviorTreeComponent::OnNodeSuccess()
+    {
+        LOG_DEBUG(TEXT("BehaviorTree node succeeded"));
+        // Tree completed - stay idle until an observed key changes or execution is requested
+        m_ChildProgress.Empty();
+    }
+
+    void BehaviorTreeComponent::OnNodeFailure()
+    {
+        LOG_DEBUG(TEXT("BehaviorTree node failed"));
+        // Tree completed - stay idle until an observed key changes or execution is requested
+        m_ChildProgress.Empty();
+    }
+
+    void BehaviorTreeComponent::ExecuteTree(float DeltaTime)
+    {
+        m_bNeedsExecution = false;
+        m_ActiveNodes.Empty();
         
-        // Simulate node execution
-        ENodeExecutionResult Result = m_CurrentNode->Execute(DeltaTime);
+        ENodeExecutionResult Result = ExecuteNode(m_BehaviorTree->GetRootNode(), DeltaTime);
+        m_CompletedNode = nullptr;
         
         switch (Result)
         {
@@ -297,20 +434,228 @@ namespace UE4SDK
         }
     }
 
-    void BehaviorTreeComponent::OnNodeSuccess()
+    ENodeExecutionResult BehaviorTreeComponent::ExecuteNode(BehaviorTreeNode* Node, float DeltaTime)
     {
-        Utils::Get().LogDebug(TEXT("BehaviorTree node succeeded"));
-        // Move to next node or complete tree
-        m_CurrentNode = nullptr;
-        m_bIsRunning = false;
+        if (!Node)
+        {
+            return ENodeExecutionResult::Failure;
+        }
+        
+        // Decorators are checked on entry only - a node we're resuming is guarded by its observers
+        bool bResuming = Node == m_CompletedNode || m_ChildProgress.Contains(Node);
+        if (!bResuming && !PassesDecorators(Node))
+        {
+            return ENodeExecutionResult::Failure;
+        }
+        
+        ENodeExecutionResult Result;
+        if (Node->GetNodeType() == ENodeType::Action)
+        {
+            if (Node == m_CompletedNode)
+            {
+                Result = m_CompletedResult;
+                m_CompletedNode = nullptr;
+            }
+            else
+            {
+                Result = Node->Execute(DeltaTime);
+            }
+            
+            if (Result == ENodeExecutionResult::Running)
+            {
+                m_CurrentNode = Node;
+            }
+        }
+        else
+        {
+            bool bIsSelector = Node->GetNodeType() == ENodeType::Selector;
+            TArray<BehaviorTreeNode*> Children = Node->GetChildren();
+            int32 ChildIndex = m_ChildProgress.FindOrAdd(Node, 0);
+            
+            Result = bIsSelector ? ENodeExecutionResult::Failure : ENodeExecutionResult::Success;
+            for (; ChildIndex < Children.Num(); ++ChildIndex)
+            {
+                ENodeExecutionResult ChildResult = ExecuteNode(Children[ChildIndex], DeltaTime);
+                if (ChildResult == ENodeExecutionResult::Running)
+                {
+                    Result = ChildResult;
+                    break;
+                }
+                
+                // Selector stops on the first success, sequence on the first failure
+                if (ChildResult == (bIsSelector ? ENodeExecutionResult::Success : ENodeExecutionResult::Failure))
+                {
+                    Result = ChildResult;
+                    break;
+                }
+            }
+            
+            if (Result == ENodeExecutionResult::Running)
+            {
+                m_ChildProgress.Add(Node, ChildIndex);
+            }
+            else
+            {
+                m_ChildProgress.Remove(Node);
+            }
+        }
+        
+        if (Result == ENodeExecutionResult::Running)
+        {
+            m_ActiveNodes.Add(Node);
+        }
+        return Result;
     }
 
-    void BehaviorTreeComponent::OnNodeFailure()
+    bool BehaviorTreeComponent::PassesDecorators(BehaviorTreeNode* Node)
     {
-        Utils::Get().LogDebug(TEXT("BehaviorTree node failed"));
-        // Handle failure or move to next node
-        m_CurrentNode = nullptr;
-        m_bIsRunning = false;
+        for (AIDecorator* Decorator : Node->GetDecorators())
+        {
+            if (Decorator && !Decorator->CheckCondition(m_Blackboard))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void BehaviorTreeComponent::ResetProgress(BehaviorTreeNode* Node)
+    {
+        if (!Node)
+        {
+            return;
+        }
+        
+        m_ChildProgress.Remove(Node);
+        for (BehaviorTreeNode* Child : Node->GetChildren())
+        {
+            ResetProgress(Child);
+        }
+    }
+
+    void BehaviorTreeComponent::AbortCurrentNode()
+    {
+        if (m_CurrentNode)
+        {
+            m_CurrentNode->OnAborted();
+            m_CurrentNode = nullptr;
+        }
+    }
+
+    void BehaviorTreeComponent::RegisterObservers()
+    {
+        UnregisterObservers();
+        if (!m_Blackboard || !m_BehaviorTree)
+        {
+            return;
+        }
+        
+        GatherObservers(m_BehaviorTree->GetRootNode());
+        for (const DecoratorObserver& Observer : m_DecoratorObservers)
+        {
+            for (const FString& KeyName : Observer.Decorator->GetObservedKeys())
+            {
+                m_ObserverHandles.Add(m_Blackboard->AddObserver(KeyName, [this, Observer](const FString&)
+                {
+                    OnObservedKeyChanged(Observer);
+                }));
+            }
+        }
+    }
+
+    void BehaviorTreeComponent::UnregisterObservers()
+    {
+        if (m_Blackboard)
+        {
+            for (int32 Handle : m_ObserverHandles)
+            {
+                m_Blackboard->RemoveObserver(Handle);
+            }
+        }
+        m_ObserverHandles.Empty();
+        m_DecoratorObservers.Empty();
+    }
+
+    void BehaviorTreeComponent::GatherObservers(BehaviorTreeNode* Node)
+    {
+        if (!Node)
+        {
+            return;
+        }
+        
+        for (AIDecorator* Decorator : Node->GetDecorators())
+        {
+            if (Decorator && Decorator->GetObservedKeys().Num() > 0)
+            {
+                DecoratorObserver Observer;
+                Observer.Decorator = Decorator;
+                Observer.Node = Node;
+                m_DecoratorObservers.Add(Observer);
+            }
+        }
+        
+        for (BehaviorTreeNode* Child : Node->GetChildren())
+        {
+            GatherObservers(Child);
+        }
+    }
+
+    void BehaviorTreeComponent::OnObservedKeyChanged(const DecoratorObserver& Observer)
+    {
+        // A finished tree wakes up on any observed change
+        if (!m_CurrentNode && m_ActiveNodes.Num() == 0)
+        {
+            m_bNeedsExecution = true;
+            return;
+        }
+        
+        EBTFlowAbortMode Mode = Observer.Decorator->GetFlowAbortMode();
+        if (Mode == EBTFlowAbortMode::None)
+        {
+            return;
+        }
+        
+        bool bPasses = Observer.Decorator->CheckCondition(m_Blackboard);
+        
+        // Self: the branch we're running no longer meets its condition
+        if (m_ActiveNodes.Contains(Observer.Node))
+        {
+            if ((Mode == EBTFlowAbortMode::Self || Mode == EBTFlowAbortMode::Both) && !bPasses)
+            {
+                AbortCurrentNode();
+                ResetProgress(Observer.Node);
+                m_ActiveNodes.Empty();
+                m_bNeedsExecution = true;
+            }
+            return;
+        }
+        
+        // LowerPriority: a higher priority sibling became available while a later branch runs
+        if ((Mode == EBTFlowAbortMode::LowerPriority || Mode == EBTFlowAbortMode::Both) && bPasses)
+        {
+            BehaviorTreeNode* Parent = Observer.Node->GetParent();
+            if (!Parent || Parent->GetNodeType() != ENodeType::Selector || !m_ActiveNodes.Contains(Parent))
+            {
+                return;
+            }
+            
+            int32* Progress = m_ChildProgress.Find(Parent);
+            int32 NodeIndex = Parent->GetChildIndex(Observer.Node);
+            if (!Progress || NodeIndex < 0 || NodeIndex >= *Progress)
+            {
+                return;
+            }
+            
+            AbortCurrentNode();
+            TArray<BehaviorTreeNode*> Siblings = Parent->GetChildren();
+            for (int32 i = NodeIndex; i < Siblings.Num(); ++i)
+            {
+                ResetProgress(Siblings[i]);
+            }
+            *Progress = NodeIndex;
+            m_ActiveNodes.Empty();
+            m_bNeedsExecution = true;
+        }
     }
 
     // BehaviorTreeNode implementation
@@ -318,6 +663,7 @@ namespace UE4SDK
         : m_NodeName(TEXT("UnnamedNode"))
         , m_NodeType(ENodeType::Action)
         , m_bIsValid(false)
+        , m_Parent(nullptr)
     {
     }
 
@@ -356,12 +702,16 @@ namespace UE4SDK
         if (Child)
         {
             m_Children.Add(Child);
+            Child->m_Parent = this;
         }
     }
 
     void BehaviorTreeNode::RemoveChild(BehaviorTreeNode* Child)
     {
-        m_Children.Remove(Child);
+        if (m_Children.Remove(Child) && Child->m_Parent == this)
+        {
+            Child->m_Parent = nullptr;
+        }
     }
 
     TArray<BehaviorTreeNode*> BehaviorTreeNode::GetChildren() const
@@ -369,6 +719,26 @@ namespace UE4SDK
         return m_Children;
     }
 
+    int32 BehaviorTreeNode::GetChildIndex(const BehaviorTreeNode* Child) const
+    {
+        for (int32 i = 0; i < m_Children.Num(); ++i)
+        {
+            if (m_Children[i] == Child)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void BehaviorTreeNode::AddDecorator(AIDecorator* Decorator)
+    {
+        if (Decorator)
+        {
+            m_Decorators.Add(Decorator);
+        }
+    }
+
     ENodeExecutionResult BehaviorTreeNode::Execute(float DeltaTime)
     {
         if (!m_bIsValid)
@@ -462,6 +832,7 @@ namespace UE4SDK
         : m_DecoratorName(TEXT("UnnamedDecorator"))
         , m_bInvertResult(false)
         , m_bIsValid(false)
+        , m_FlowAbortMode(EBTFlowAbortMode::None)
     {
     }
 
@@ -512,11 +883,36 @@ namespace UE4SDK
         return true;
     }
 
+    bool AIDecorator::CheckCondition(Blackboard* InBlackboard)
+    {
+        if (!m_bIsValid)
+        {
+            return false;
+        }
+        
+        bool Result = EvaluateCondition(InBlackboard);
+        return m_bInvertResult ? !Result : Result;
+    }
+
+    bool AIDecorator::EvaluateCondition(Blackboard* InBlackboard)
+    {
+        // Decorators that don't need the blackboard keep using the parameterless hook
+        return EvaluateCondition();
+    }
+
+    void AIDecorator::AddObservedKey(const FString& KeyName)
+    {
+        if (!m_ObservedKeys.Contains(KeyName))
+        {
+            m_ObservedKeys.Add(KeyName);
+        }
+    }
+
     // AIService implementation
     AIService::AIService()
         : m_ServiceName(TEXT("UnnamedService"))
         , m_UpdateFrequency(1.0f)
-        , m_LastUpdateTime(0.0f)
+        , m_TimeSinceLastUpdate(0.0f)
         , m_bIsActive(false)
     {
     }
@@ -566,25 +962,68 @@ namespace UE4SDK
             return;
         }
         
-        float CurrentTime = Utils::Get().GetTimeSinceStart();
-        if (CurrentTime - m_LastUpdateTime >= (1.0f / m_UpdateFrequency))
+        m_TimeSinceLastUpdate += DeltaTime;
+        if (m_TimeSinceLastUpdate >= (1.0f / m_UpdateFrequency))
         {
-            ExecuteService(DeltaTime);
-            m_LastUpdateTime = CurrentTime;
+            float ElapsedTime = m_TimeSinceLastUpdate;
+            ExecuteService(ElapsedTime);
+            m_TimeSinceLastUpdate = 0.0f;
         }
     }
 
     void AIService::ExecuteService(float DeltaTime)
     {
         // Default implementation - subclasses should override
-        Utils::Get().LogDebug(TEXT("AIService executing: ") + m_ServiceName);
+        LOG_DEBUG(TEXT("AIService executing: ") + m_ServiceName);
+    }
+
+    // AIFrameSnapshot implementation
+    AIFrameSnapshot::AIFrameSnapshot()
+        : m_FrameNumber(0)
+        , m_TimeSeconds(0.0f)
+    {
+    }
+
+    void AIFrameSnapshot::Reset(uint64 FrameNumber, float TimeSeconds)
+    {
+        m_Agents.Empty();
+        m_FrameNumber = FrameNumber;
+        m_TimeSeconds = TimeSeconds;
+    }
+
+    int32 AIFrameSnapshot::AddAgent(const AIAgentSnapshot& Agent)
+    {
+        m_Agents.Add(Agent);
+        return m_Agents.Num() - 1;
+    }
+
+    const AIAgentSnapshot* AIFrameSnapshot::GetAgent(int32 AgentIndex) const
+    {
+        if (AgentIndex < 0 || AgentIndex >= m_Agents.Num())
+        {
+            return nullptr;
+        }
+        return &m_Agents[AgentIndex];
+    }
+
+    // AICommandBuffer implementation
+    void AICommandBuffer::Execute()
+    {
+        for (auto& Command : m_Commands)
+        {
+            Command();
+        }
+        m_Commands.Empty();
     }
 
     // AISystem implementation
     AISystem::AISystem()
         : m_bIsInitialized(false)
         , m_UpdateFrequency(1.0f)
-        , m_LastUpdateTime(0.0f)
+        , m_TimeSinceLastUpdate(0.0f)
+        , m_bParallelTickEnabled(true)
+        , m_ControllerBatchSize(4)
+        , m_FrameNumber(0)
     {
     }
 
@@ -595,6 +1034,11 @@ namespace UE4SDK
             return;
         }
         
+        if (m_bParallelTickEnabled)
+        {
+            JobSystem::Get().Initialize();
+        }
+        
         m_bIsInitialized = true;
         Utils::Get().LogInfo(TEXT("AISystem initialized"));
     }
@@ -620,6 +1064,8 @@ namespace UE4SDK
         }
         m_AIServices.Empty();
         
+        LatentTaskManager::Get().CancelAll();
+        
         m_bIsInitialized = false;
         Utils::Get().LogInfo(TEXT("AISystem shutdown"));
     }
@@ -636,29 +1082,53 @@ namespace UE4SDK
 
     void AISystem::Update(float DeltaTime)
     {
+        PROFILE_SCOPE("AISystem::Update");
+        MEMORY_TAG_SCOPE(AI);
+
         if (!m_bIsInitialized)
         {
             return;
         }
         
-        float CurrentTime = Utils::Get().GetTimeSinceStart();
-        if (CurrentTime - m_LastUpdateTime >= (1.0f / m_UpdateFrequency))
+        // Game thread tasks from the last frame run before any AI does, then coroutines waiting on the frame
+        JobSystem::Get().ProcessGameThreadTasks();
+        LatentTaskManager::Get().ProcessFrame();
+        
+        // The caller's delta is the only time source - everything below accumulates what it's handed
+        // instead of sampling the clock
+        m_TimeSinceLastUpdate += DeltaTime;
+        if (m_TimeSinceLastUpdate >= (1.0f / m_UpdateFrequency))
         {
-            ProcessAI(DeltaTime);
-            m_LastUpdateTime = CurrentTime;
+            float ElapsedTime = m_TimeSinceLastUpdate;
+            ProcessAI(ElapsedTime);
+            m_TimeSinceLastUpdate = 0.0f;
         }
     }
 
     void AISystem::ProcessAI(float DeltaTime)
     {
-        // Update all AI controllers
-        for (auto& Controller : m_AIControllers)
-        {
-            if (Controller->IsActive())
-            {
-                Controller->Update(DeltaTime);
-            }
-        }
+        ++m_FrameNumber;
+        
+        // Capture shared world state once so controllers never read it mid-update
+        BuildFrameSnapshot();
+        
+        // Batched sense queries write their results to blackboards before anything reads them
+        AIPerceptionSystem::Get().Update(DeltaTime);
+        
+        // Pick this frame's controllers by LOD tier, stagger and budget
+        AIScheduler::Get().BeginFrame(m_FrameSnapshot, DeltaTime);
+        
+        // Score every due utility selector in one batched pass before controllers consume the results
+        UtilityAISystem::Get().Update();
+        
+        // Update scheduled AI controllers - independent ones in parallel, writes to shared state deferred
+        TickControllersParallel();
+        
+        // Apply deferred writes in registration order so results don't depend on scheduling
+        MergeCommandBuffers();
+        TickSerialControllers();
+        
+        AIScheduler::Get().EndFrame();
         
         // Update all AI services
         for (auto& Service : m_AIServices)
@@ -670,6 +1140,111 @@ namespace UE4SDK
         }
     }
 
+    void AISystem::BuildFrameSnapshot()
+    {
+        m_FrameSnapshot.Reset(m_FrameNumber, Utils::Get().GetTimeSinceStart());
+        
+        // Count blackboard users - a blackboard shared between controllers can't be written concurrently
+        TMap<Blackboard*, int32> BlackboardUsers;
+        for (AIController* Controller : m_AIControllers)
+        {
+            BlackboardComponent* Component = Controller->GetBlackboardComponent();
+            if (Component && Component->GetBlackboard())
+            {
+                ++BlackboardUsers.FindOrAdd(Component->GetBlackboard(), 0);
+            }
+        }
+        
+        for (AIController* Controller : m_AIControllers)
+        {
+            AIAgentSnapshot Agent;
+            Agent.Controller = Controller;
+            Agent.bIsActive = Controller->IsActive();
+            
+            APawn* Pawn = Controller->GetControlledPawn();
+            if (Pawn)
+            {
+                Agent.bHasPawn = true;
+                Agent.Location = Pawn->GetActorLocation();
+                Agent.Rotation = Pawn->GetActorRotation();
+            }
+            
+            BlackboardComponent* Component = Controller->GetBlackboardComponent();
+            if (Component && Component->GetBlackboard())
+            {
+                Agent.bTickSerially = BlackboardUsers[Component->GetBlackboard()] > 1;
+            }
+            
+            m_FrameSnapshot.AddAgent(Agent);
+        }
+    }
+
+    void AISystem::TickControllersParallel()
+    {
+        int32 ControllerCount = m_FrameSnapshot.GetAgentCount();
+        m_CommandBuffers.SetNum(ControllerCount);
+        for (auto& Commands : m_CommandBuffers)
+        {
+            Commands.Reset();
+        }
+        
+        AIScheduler& Scheduler = AIScheduler::Get();
+        const TArray<int32>& TickList = Scheduler.GetTickList();
+        
+        // With parallel tick disabled a single batch runs inline on this thread
+        int32 BatchSize = m_bParallelTickEnabled ? m_ControllerBatchSize : TickList.Num();
+        
+        JobSystem::Get().ParallelFor(TickList.Num(), BatchSize, [this, &Scheduler, &TickList](int32 Begin, int32 End)
+        {
+            for (int32 TickIndex = Begin; TickIndex < End; ++TickIndex)
+            {
+                int32 Index = TickList[TickIndex];
+                const AIAgentSnapshot* Agent = m_FrameSnapshot.GetAgent(Index);
+                if (Agent->bTickSerially)
+                {
+                    continue;
+                }
+                
+                TickController(Index, &m_CommandBuffers[Index], Scheduler);
+            }
+        });
+    }
+
+    void AISystem::MergeCommandBuffers()
+    {
+        for (auto& Commands : m_CommandBuffers)
+        {
+            Commands.Execute();
+        }
+    }
+
+    void AISystem::TickSerialControllers()
+    {
+        AIScheduler& Scheduler = AIScheduler::Get();
+        for (int32 Index : Scheduler.GetTickList())
+        {
+            if (m_FrameSnapshot.GetAgent(Index)->bTickSerially)
+            {
+                // No command buffer - shared writes apply immediately since nothing else is running
+                TickController(Index, nullptr, Scheduler);
+            }
+        }
+    }
+
+    void AISystem::TickController(int32 AgentIndex, AICommandBuffer* CommandBuffer, AIScheduler& Scheduler)
+    {
+        AIController* Controller = m_FrameSnapshot.GetAgent(AgentIndex)->Controller;
+        auto StartTime = std::chrono::steady_clock::now();
+        
+        Controller->SetFrameContext(&m_FrameSnapshot, CommandBuffer, AgentIndex);
+        Controller->Update(Scheduler.GetTickDeltaTime(AgentIndex));
+        Controller->ClearFrameContext();
+        
+        // Each agent index is ticked by exactly one job, so this write doesn't race
+        auto Elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - StartTime);
+        Scheduler.RecordAgentCost(AgentIndex, static_cast<float>(Elapsed.count()));
+    }
+
     void AISystem::RegisterAIController(AIController* Controller)
     {
         if (Controller && !m_AIControllers.Contains(Controller))
@@ -684,6 +1259,7 @@ namespace UE4SDK
         if (Controller)
         {
             m_AIControllers.Remove(Controller);
+            AIScheduler::Get().RemoveAgent(Controller);
             Utils::Get().LogInfo(TEXT("AIController unregistered"));
         }
     }
@@ -20,6 +20,8 @@ namespace UE4SDK
     class BlackboardComponent;
     class NavMeshQueryFilter;
     class NavPath;
+    class AIScheduler;
+    class AIPerceptionComponent;
 
     // AI Task types
     enum class EBTNodeResult : uint8
@@ -47,6 +49,67 @@ namespace UE4SDK
         Both = 3
     };
 
+    // Behavior tree node types
+    enum class ENodeType : uint8
+    {
+        Action = 0,
+        Selector = 1,
+        Sequence = 2
+    };
+
+    enum class ENodeExecutionResult : uint8
+    {
+        Success = 0,
+        Failure = 1,
+        Running = 2
+    };
+
+    // Per-agent view of the shared world, captured once per AI frame
+    struct AIAgentSnapshot
+    {
+        AIController* Controller = nullptr;
+        FVector Location;
+        FRotator Rotation;
+        bool bHasPawn = false;
+        bool bIsActive = false;
+        bool bTickSerially = false; // Shares a blackboard with another controller
+    };
+
+    // AI frame snapshot - read-only shared world state used during the parallel AI tick
+    class AIFrameSnapshot
+    {
+    public:
+        AIFrameSnapshot();
+
+        void Reset(uint64 FrameNumber, float TimeSeconds);
+        int32 AddAgent(const AIAgentSnapshot& Agent);
+
+        const AIAgentSnapshot* GetAgent(int32 AgentIndex) const;
+        const TArray<AIAgentSnapshot>& GetAgents() const { return m_Agents; }
+        int32 GetAgentCount() const { return m_Agents.Num(); }
+
+        uint64 GetFrameNumber() const { return m_FrameNumber; }
+        float GetTimeSeconds() const { return m_TimeSeconds; }
+
+    private:
+        TArray<AIAgentSnapshot> m_Agents;
+        uint64 m_FrameNumber;
+        float m_TimeSeconds;
+    };
+
+    // AI command buffer - deferred writes to shared state, applied in the merge phase
+    class AICommandBuffer
+    {
+    public:
+        void Enqueue(std::function<void()> Command) { m_Commands.Add(std::move(Command)); }
+        void Execute();
+        void Reset() { m_Commands.Empty(); }
+        int32 Num() const { return m_Commands.Num(); }
+
+    private:
+        TArray<std::function<void()>> m_Commands;
+    };
+
     // AI Task - Base class for behavior tree tasks
     class AITask : public UObject
     {
@@ -59,9 +122,18 @@ namespace UE4SDK
         virtual EBTNodeResult AbortTask(AIController* Controller, Blackboard* Blackboard);
         virtual void OnTaskFinished(AIController* Controller, Blackboard* Blackboard, EBTNodeResult Result);
 
+        // Tick-driven execution
+        void StartTask();
+        virtual void StopTask();
+        void CompleteTask(bool bSuccessful);
+        virtual void Update(float DeltaTime);
+        virtual void ExecuteTask(float DeltaTime);
+
         // Task state
         bool IsRunning() const { return m_bIsRunning; }
         void SetRunning(bool bRunning) { m_bIsRunning = bRunning; }
+        bool IsCompleted() const { return m_bIsCompleted; }
+        bool IsSuccessful() const { return m_bIsSuccessful; }
 
         // Task properties
         void SetTaskName(const FString& Name) { m_TaskName = Name; }
@@ -70,6 +142,9 @@ namespace UE4SDK
     protected:
         FString m_TaskName;
         bool m_bIsRunning;
+        bool m_bIsCompleted;
+        bool m_bIsSuccessful;
+        float m_ExecutionTime;
     };
 
     // AI Decorator - Base class for behavior tree decorators
@@ -83,6 +158,15 @@ namespace UE4SDK
         virtual bool CalculateRawConditionValue(AIController* Controller, Blackboard* Blackboard) const;
         virtual EBTFlowAbortMode GetFlowAbortMode() const { return m_FlowAbortMode; }
 
+        // Blackboard-aware evaluation - defaults to the blackboard-less EvaluateCondition
+        bool CheckCondition(Blackboard* InBlackboard);
+        virtual bool EvaluateCondition(Blackboard* InBlackboard);
+
+        // Abort mode and observed keys - a change to an observed key re-evaluates the owning branch
+        void SetFlowAbortMode(EBTFlowAbortMode Mode) { m_FlowAbortMode = Mode; }
+        void AddObservedKey(const FString& KeyName);
+        const TArray<FString>& GetObservedKeys() const { return m_ObservedKeys; }
+
         // Decorator properties
         void SetDecoratorName(const FString& Name) { m_DecoratorName = Name; }
         const FString& GetDecoratorName() const { return m_DecoratorName; }
@@ -90,6 +174,7 @@ namespace UE4SDK
     protected:
         FString m_DecoratorName;
         EBTFlowAbortMode m_FlowAbortMode;
+        TArray<FString> m_ObservedKeys;
     };
 
     // AI Service - Base class for behavior tree services
@@ -159,6 +244,10 @@ namespace UE4SDK
         void ClearValue(const FString& KeyName);
         void ClearAllValues();
 
+        // Key observers
+        int32 AddObserver(const FString& KeyName, std::function<void(const FString&)> Callback);
+        void RemoveObserver(int32 Handle);
+
         // Blackboard info
         void SetBlackboardName(const FString& Name) { m_BlackboardName = Name; }
         const FString& GetBlackboardName() const { return m_BlackboardName; }
@@ -176,6 +265,45 @@ namespace UE4SDK
         TMap<FString, UClass*> m_ClassValues;
     };
 
+    // BehaviorTreeNode - Action leaf or Selector/Sequence composite with optional decorators
+    class BehaviorTreeNode : public UObject
+    {
+    public:
+        BehaviorTreeNode();
+        virtual ~BehaviorTreeNode() = default;
+
+        // Node properties
+        void SetNodeName(const FString& Name);
+        const FString& GetNodeName() const;
+        void SetNodeType(ENodeType Type);
+        ENodeType GetNodeType() const;
+        void SetIsValid(bool bValid);
+        bool IsValid() const;
+
+        // Hierarchy
+        void AddChild(BehaviorTreeNode* Child);
+        void RemoveChild(BehaviorTreeNode* Child);
+        TArray<BehaviorTreeNode*> GetChildren() const;
+        BehaviorTreeNode* GetParent() const { return m_Parent; }
+        int32 GetChildIndex(const BehaviorTreeNode* Child) const;
+
+        // Decorators - all must pass for the node to be entered
+        void AddDecorator(AIDecorator* Decorator);
+        const TArray<AIDecorator*>& GetDecorators() const { return m_Decorators; }
+
+        // Execution - only called for Action nodes, composites are driven by BehaviorTreeComponent
+        virtual ENodeExecutionResult Execute(float DeltaTime);
+        virtual void OnAborted() {}
+
+    private:
+        FString m_NodeName;
+        ENodeType m_NodeType;
+        bool m_bIsValid;
+        BehaviorTreeNode* m_Parent;
+        TArray<BehaviorTreeNode*> m_Children;
+        TArray<AIDecorator*> m_Decorators;
+    };
+
     // BehaviorTree - AI behavior definition
     class BehaviorTree : public UObject
     {
@@ -231,7 +359,7 @@ namespace UE4SDK
     {
     public:
         BehaviorTreeComponent();
-        virtual ~BehaviorTreeComponent() = default;
+        virtual ~BehaviorTreeComponent();
 
         // Tree execution
         void StartTree(BehaviorTree* Tree);
@@ -258,7 +386,42 @@ namespace UE4SDK
         void SetOwner(AIController* Owner) { m_Owner = Owner; }
         AIController* GetOwner() const { return m_Owner; }
 
+        // Event-driven execution - decorators observe keys on this blackboard
+        void SetBlackboard(Blackboard* InBlackboard);
+        Blackboard* GetBlackboard() const { return m_Blackboard; }
+        void RequestExecution() { m_bNeedsExecution = true; }
+        bool IsIdle() const { return !m_CurrentNode && !m_bNeedsExecution; }
+
     private:
+        struct DecoratorObserver
+        {
+            AIDecorator* Decorator;
+            BehaviorTreeNode* Node;
+        };
+
+        BehaviorTreeNode* m_CurrentNode;
+        BehaviorTreeNode* m_CompletedNode;
+        ENodeExecutionResult m_CompletedResult;
+        Blackboard* m_Blackboard;
+        bool m_bNeedsExecution;
+        TMap<BehaviorTreeNode*, int32> m_ChildProgress;
+        TArray<BehaviorTreeNode*> m_ActiveNodes;
+        TArray<DecoratorObserver> m_DecoratorObservers;
+        TArray<int32> m_ObserverHandles;
+
+        // Execution helpers
+        void ExecuteTree(float DeltaTime);
+        ENodeExecutionResult ExecuteNode(BehaviorTreeNode* Node, float DeltaTime);
+        bool PassesDecorators(BehaviorTreeNode* Node);
+        void ResetProgress(BehaviorTreeNode* Node);
+        void AbortCurrentNode();
+
+        // Observer helpers
+        void RegisterObservers();
+        void UnregisterObservers();
+        void GatherObservers(BehaviorTreeNode* Node);
+        void OnObservedKeyChanged(const DecoratorObserver& Observer);
+
         FString m_ComponentName;
         AIController* m_Owner;
         BehaviorTree* m_CurrentTree;
@@ -344,9 +507,27 @@ namespace UE4SDK
         void SetTarget(UObject* NewTarget);
         UObject* GetTarget() const { return m_Target; }
 
+        // Pawn
+        void SetControlledPawn(APawn* Pawn);
+        APawn* GetControlledPawn() const;
+
+        // Perception - the component's results are written to this controller's blackboard
+        void SetPerceptionComponent(AIPerceptionComponent* Component);
+        AIPerceptionComponent* GetPerceptionComponent() const { return m_PerceptionComponent; }
+
         // AI updates
         virtual void TickAI(float DeltaTime);
 
+        // Frame context - set by AISystem for the duration of a (possibly parallel) tick
+        void SetFrameContext(const AIFrameSnapshot* Snapshot, AICommandBuffer* CommandBuffer, int32 AgentIndex);
+        void ClearFrameContext();
+        const AIFrameSnapshot* GetFrameSnapshot() const { return m_FrameSnapshot; }
+        AICommandBuffer* GetCommandBuffer() const { return m_CommandBuffer; }
+        int32 GetAgentIndex() const { return m_AgentIndex; }
+
+        // Shared state writes - deferred to the merge phase while ticking in parallel
+        void EnqueueSharedWrite(std::function<void()> Command);
+
         // Controller info
         void SetControllerName(const FString& Name) { m_ControllerName = Name; }
         const FString& GetControllerName() const { return m_ControllerName; }
@@ -358,11 +539,17 @@ namespace UE4SDK
         Blackboard* m_Blackboard;
         BlackboardComponent* m_BlackboardComponent;
         UObject* m_Target;
+        APawn* m_ControlledPawn;
+        AIPerceptionComponent* m_PerceptionComponent;
         bool m_bAIEnabled;
         bool m_bAIPaused;
         bool m_bIsMoving;
         FVector m_MoveDestination;
         float m_MoveAcceptanceRadius;
+
+        const AIFrameSnapshot* m_FrameSnapshot;
+        AICommandBuffer* m_CommandBuffer;
+        int32 m_AgentIndex;
     };
 
     // AI System - Global AI management
@@ -392,6 +579,15 @@ namespace UE4SDK
         // AI updates
         void TickAI(float DeltaTime);
 
+        // Parallel tick settings
+        void SetParallelTickEnabled(bool bEnabled) { m_bParallelTickEnabled = bEnabled; }
+        bool IsParallelTickEnabled() const { return m_bParallelTickEnabled; }
+
+        void SetControllerBatchSize(int32 BatchSize) { m_ControllerBatchSize = BatchSize; }
+        int32 GetControllerBatchSize() const { return m_ControllerBatchSize; }
+
+        const AIFrameSnapshot& GetFrameSnapshot() const { return m_FrameSnapshot; }
+
         // Cleanup
         void Cleanup();
 
@@ -406,6 +602,20 @@ namespace UE4SDK
         TArray<std::unique_ptr<BehaviorTree>> m_BehaviorTrees;
         TArray<std::unique_ptr<AIController>> m_AIControllers;
 
+        // Parallel tick state
+        AIFrameSnapshot m_FrameSnapshot;
+        TArray<AICommandBuffer> m_CommandBuffers;
+        bool m_bParallelTickEnabled;
+        int32 m_ControllerBatchSize;
+        uint64 m_FrameNumber;
+
+        // Parallel tick phases
+        void BuildFrameSnapshot();
+        void TickControllersParallel();
+        void MergeCommandBuffers();
+        void TickSerialControllers();
+        void TickController(int32 AgentIndex, AICommandBuffer* CommandBuffer, AIScheduler& Scheduler);
+
         static AISystem* s_Instance;
     };
 
@@ -0,0 +1,451 @@
+/*
+ * UE4 AI Perception Implementation - Self-contained sight and hearing for AI controllers
+ * Vibe coder approved ✨
+ */
+
+#include "AIPerception.h"
+#include "AI.h"
+#include "Utils.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <cmath>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // How long a noise stays queryable for listeners that were over the query cap
+        const float NoiseEventLifetime = 1.0f;
+
+        // Listeners per job in the query pass
+        const int32 QueryBatchSize = 16;
+    }
+
+    // AIPerceptionComponent implementation
+    AIPerceptionComponent::AIPerceptionComponent()
+        : m_Owner(nullptr)
+        , m_Blackboard(nullptr)
+        , m_UpdateInterval(0.25f)
+        , m_TimeSinceUpdate(0.0f)
+        , m_LastNoiseSerial(0)
+        , m_TargetActorKey(TEXT("TargetActor"))
+        , m_TargetLocationKey(TEXT("TargetLocation"))
+        , m_HasTargetKey(TEXT("HasTarget"))
+    {
+        for (bool& bEnabled : m_SenseEnabled)
+        {
+            bEnabled = true;
+        }
+    }
+
+    AIPerceptionComponent::~AIPerceptionComponent()
+    {
+        AIPerceptionSystem::Get().UnregisterListener(this);
+    }
+
+    void AIPerceptionComponent::SetSenseEnabled(EAISense Sense, bool bEnabled)
+    {
+        if (Sense < EAISense::Count)
+        {
+            m_SenseEnabled[static_cast<int32>(Sense)] = bEnabled;
+        }
+    }
+
+    bool AIPerceptionComponent::IsSenseEnabled(EAISense Sense) const
+    {
+        return Sense < EAISense::Count && m_SenseEnabled[static_cast<int32>(Sense)];
+    }
+
+    void AIPerceptionComponent::SetTargetKeys(const FString& TargetActorKey, const FString& TargetLocationKey, const FString& HasTargetKey)
+    {
+        m_TargetActorKey = TargetActorKey;
+        m_TargetLocationKey = TargetLocationKey;
+        m_HasTargetKey = HasTargetKey;
+    }
+
+    const AIStimulus* AIPerceptionComponent::GetBestStimulus() const
+    {
+        // Prefer what we can see right now, then the strongest and freshest memory
+        const AIStimulus* Best = nullptr;
+        float BestScore = 0.0f;
+        for (const AIStimulus& Stimulus : m_KnownStimuli)
+        {
+            float Freshness = Stimulus.MaxAge > 0.0f ? 1.0f - Stimulus.Age / Stimulus.MaxAge : 1.0f;
+            float Score = (Stimulus.bCurrentlySensed ? 2.0f : 0.0f) + Stimulus.Strength * Freshness;
+            if (!Best || Score > BestScore)
+            {
+                Best = &Stimulus;
+                BestScore = Score;
+            }
+        }
+        return Best;
+    }
+
+    AActor* AIPerceptionComponent::GetBestTarget() const
+    {
+        const AIStimulus* Best = GetBestStimulus();
+        return Best ? Best->Source : nullptr;
+    }
+
+    bool AIPerceptionComponent::IsCurrentlySensing(AActor* Source, EAISense Sense) const
+    {
+        for (const AIStimulus& Stimulus : m_KnownStimuli)
+        {
+            if (Stimulus.Source == Source && Stimulus.Sense == Sense)
+            {
+                return Stimulus.bCurrentlySensed;
+            }
+        }
+        return false;
+    }
+
+    void AIPerceptionComponent::AgeStimuli(float DeltaTime)
+    {
+        for (int32 i = m_KnownStimuli.Num() - 1; i >= 0; --i)
+        {
+            AIStimulus& Stimulus = m_KnownStimuli[i];
+            if (!Stimulus.bCurrentlySensed)
+            {
+                Stimulus.Age += DeltaTime;
+            }
+
+            if (Stimulus.IsExpired())
+            {
+                m_KnownStimuli.RemoveAtSwap(i);
+            }
+        }
+    }
+
+    void AIPerceptionComponent::MergePendingStimuli()
+    {
+        TSet<AActor*> SeenSources;
+
+        for (const AIStimulus& Pending : m_PendingStimuli)
+        {
+            if (Pending.Sense == EAISense::Sight)
+            {
+                SeenSources.Add(Pending.Source);
+            }
+
+            AIStimulus* Existing = FindStimulus(Pending.Source, Pending.Sense);
+            bool bNewlySensed = !Existing || !Existing->bCurrentlySensed || Pending.Sense == EAISense::Hearing;
+            if (Existing)
+            {
+                *Existing = Pending;
+            }
+            else
+            {
+                m_KnownStimuli.Add(Pending);
+            }
+
+            if (bNewlySensed && m_OnTargetPerceptionUpdated)
+            {
+                m_OnTargetPerceptionUpdated(Pending.Source, Pending);
+            }
+        }
+
+        // Anything we were looking at and didn't see this pass is lost - it starts aging now
+        for (AIStimulus& Stimulus : m_KnownStimuli)
+        {
+            if (Stimulus.Sense == EAISense::Sight && Stimulus.bCurrentlySensed && !SeenSources.Contains(Stimulus.Source))
+            {
+                Stimulus.bCurrentlySensed = false;
+                Stimulus.Age = 0.0f;
+                if (m_OnTargetPerceptionUpdated)
+                {
+                    m_OnTargetPerceptionUpdated(Stimulus.Source, Stimulus);
+                }
+            }
+        }
+
+        m_PendingStimuli.Empty();
+    }
+
+    void AIPerceptionComponent::WriteToBlackboard()
+    {
+        if (!m_Blackboard)
+        {
+            return;
+        }
+
+        const AIStimulus* Best = GetBestStimulus();
+        if (!m_HasTargetKey.IsEmpty())
+        {
+            m_Blackboard->SetValueAsBool(m_HasTargetKey, Best != nullptr);
+        }
+        if (!m_TargetActorKey.IsEmpty())
+        {
+            m_Blackboard->SetValueAsObject(m_TargetActorKey, Best ? Best->Source : nullptr);
+        }
+        if (Best && !m_TargetLocationKey.IsEmpty())
+        {
+            m_Blackboard->SetValueAsVector(m_TargetLocationKey, Best->Location);
+        }
+    }
+
+    AIStimulus* AIPerceptionComponent::FindStimulus(AActor* Source, EAISense Sense)
+    {
+        for (AIStimulus& Stimulus : m_KnownStimuli)
+        {
+            if (Stimulus.Source == Source && Stimulus.Sense == Sense)
+            {
+                return &Stimulus;
+            }
+        }
+        return nullptr;
+    }
+
+    // AIPerceptionSystem implementation
+    AIPerceptionSystem* AIPerceptionSystem::s_Instance = nullptr;
+
+    AIPerceptionSystem& AIPerceptionSystem::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(AI);
+            s_Instance = new AIPerceptionSystem();
+        }
+        return *s_Instance;
+    }
+
+    AIPerceptionSystem::AIPerceptionSystem()
+        : m_MaxQueriesPerFrame(64)
+        , m_QueriesLastFrame(0)
+        , m_NextListener(0)
+        , m_NextNoiseSerial(1)
+    {
+    }
+
+    void AIPerceptionSystem::RegisterStimulusSource(AActor* Source)
+    {
+        if (Source && !m_StimulusSources.Contains(Source))
+        {
+            m_SourceHandles.Add(m_SpatialIndex.Insert(m_StimulusSources.Num(), Source->GetActorLocation()));
+            m_StimulusSources.Add(Source);
+        }
+    }
+
+    void AIPerceptionSystem::UnregisterStimulusSource(AActor* Source)
+    {
+        int32 Index = m_StimulusSources.Find(Source);
+        if (Index == -1)
+        {
+            return;
+        }
+
+        m_SpatialIndex.Remove(m_SourceHandles[Index]);
+        m_StimulusSources.RemoveAt(Index);
+        m_SourceHandles.RemoveAt(Index);
+
+        // Later sources shifted down one
+        for (int32 i = Index; i < m_SourceHandles.Num(); ++i)
+        {
+            m_SpatialIndex.SetUserId(m_SourceHandles[i], i);
+        }
+    }
+
+    void AIPerceptionSystem::SetSpatialSettings(const SpatialOctreeSettings& Settings)
+    {
+        m_SpatialIndex.SetSettings(Settings);
+        for (int32 i = 0; i < m_StimulusSources.Num(); ++i)
+        {
+            m_SourceHandles[i] = m_SpatialIndex.Insert(i, m_StimulusSources[i]->GetActorLocation());
+        }
+    }
+
+    void AIPerceptionSystem::RegisterListener(AIPerceptionComponent* Listener)
+    {
+        if (Listener && !m_Listeners.Contains(Listener))
+        {
+            // Only hear noises made from now on
+            Listener->m_LastNoiseSerial = m_NextNoiseSerial - 1;
+            m_Listeners.Add(Listener);
+        }
+    }
+
+    void AIPerceptionSystem::UnregisterListener(AIPerceptionComponent* Listener)
+    {
+        m_Listeners.Remove(Listener);
+    }
+
+    void AIPerceptionSystem::ReportNoiseEvent(AActor* Instigator, const FVector& Location, float Loudness)
+    {
+        AINoiseEvent Event;
+        Event.Instigator = Instigator;
+        Event.Location = Location;
+        Event.Loudness = Loudness;
+        Event.Serial = m_NextNoiseSerial++;
+        m_NoiseEvents.Add(Event);
+    }
+
+    void AIPerceptionSystem::Update(float DeltaTime)
+    {
+        PROFILE_SCOPE("AIPerceptionSystem::Update");
+        MEMORY_TAG_SCOPE(AI);
+
+        // One index for every listener this frame
+        UpdateSpatialIndex();
+
+        for (AIPerceptionComponent* Listener : m_Listeners)
+        {
+            Listener->m_TimeSinceUpdate += DeltaTime;
+            Listener->AgeStimuli(DeltaTime);
+        }
+
+        // Pick due listeners round-robin, up to the per-frame cap
+        struct ListenerQuery
+        {
+            AIPerceptionComponent* Listener;
+            FVector Location;
+            FVector Forward;
+            APawn* Self;
+        };
+
+        TArray<ListenerQuery> Queries;
+        int32 ListenerCount = m_Listeners.Num();
+        int32 Visited = 0;
+        for (; Visited < ListenerCount; ++Visited)
+        {
+            if (m_MaxQueriesPerFrame > 0 && Queries.Num() >= m_MaxQueriesPerFrame)
+            {
+                break;
+            }
+
+            AIPerceptionComponent* Listener = m_Listeners[(m_NextListener + Visited) % ListenerCount];
+            if (Listener->m_TimeSinceUpdate < Listener->m_UpdateInterval)
+            {
+                continue;
+            }
+
+            APawn* Pawn = Listener->m_Owner ? Listener->m_Owner->GetControlledPawn() : nullptr;
+            if (!Pawn)
+            {
+                continue;
+            }
+
+            ListenerQuery Query;
+            Query.Listener = Listener;
+            Query.Location = Pawn->GetActorLocation();
+            Query.Forward = Pawn->GetActorRotation().Vector();
+            Query.Self = Pawn;
+            Queries.Add(Query);
+        }
+        m_NextListener = ListenerCount > 0 ? (m_NextListener + Visited) % ListenerCount : 0;
+        m_QueriesLastFrame = Queries.Num();
+
+        // Queries only read shared state and write their own listener's pending list
+        JobSystem::Get().ParallelFor(Queries.Num(), QueryBatchSize, [this, &Queries](int32 Begin, int32 End)
+        {
+            for (int32 i = Begin; i < End; ++i)
+            {
+                QueryListener(Queries[i].Listener, Queries[i].Location, Queries[i].Forward, Queries[i].Self);
+            }
+        });
+
+        // Merge, notify and write blackboards on this thread
+        for (const ListenerQuery& Query : Queries)
+        {
+            AIPerceptionComponent* Listener = Query.Listener;
+            Listener->MergePendingStimuli();
+            Listener->WriteToBlackboard();
+            Listener->m_TimeSinceUpdate = 0.0f;
+            Listener->m_LastNoiseSerial = m_NextNoiseSerial - 1;
+        }
+
+        for (int32 i = m_NoiseEvents.Num() - 1; i >= 0; --i)
+        {
+            m_NoiseEvents[i].Age += DeltaTime;
+            if (m_NoiseEvents[i].Age >= NoiseEventLifetime)
+            {
+                m_NoiseEvents.RemoveAt(i);
+            }
+        }
+    }
+
+    void AIPerceptionSystem::UpdateSpatialIndex()
+    {
+        // Sources that stayed in their cell are a plain write
+        for (int32 i = 0; i < m_StimulusSources.Num(); ++i)
+        {
+            if (AActor* Source = m_StimulusSources[i])
+            {
+                m_SpatialIndex.Move(m_SourceHandles[i], Source->GetActorLocation());
+            }
+        }
+    }
+
+    void AIPerceptionSystem::QueryListener(AIPerceptionComponent* Listener, const FVector& Location, const FVector& Forward, APawn* Self) const
+    {
+        TArray<AIStimulus>& Pending = Listener->m_PendingStimuli;
+        Pending.Empty();
+
+        if (Listener->IsSenseEnabled(EAISense::Sight))
+        {
+            const AISightConfig& Sight = Listener->m_SightConfig;
+            float CosHalfAngle = std::cos(Utils::DegreesToRadians(Sight.PeripheralVisionHalfAngle));
+
+            m_SpatialIndex.QuerySphere(Location, std::max(Sight.SightRadius, Sight.LoseSightRadius), [&](int32, const SpatialEntry& Entry)
+            {
+                AActor* Source = m_StimulusSources[Entry.UserId];
+                if (Source == Self)
+                {
+                    return;
+                }
+
+                // Targets we already see are kept out to the lose-sight radius
+                float MaxRadius = Listener->IsCurrentlySensing(Source, EAISense::Sight) ? Sight.LoseSightRadius : Sight.SightRadius;
+                FVector ToSource = Entry.Location - Location;
+                float DistanceSquared = ToSource.SizeSquared();
+                if (DistanceSquared > MaxRadius * MaxRadius)
+                {
+                    return;
+                }
+
+                float Distance = std::sqrt(DistanceSquared);
+                if (Distance > 1e-4f && ((ToSource / Distance) | Forward) < CosHalfAngle)
+                {
+                    return;
+                }
+
+                AIStimulus Stimulus;
+                Stimulus.Source = Source;
+                Stimulus.Sense = EAISense::Sight;
+                Stimulus.Location = Entry.Location;
+                Stimulus.Strength = MaxRadius > 0.0f ? 1.0f - Distance / MaxRadius : 1.0f;
+                Stimulus.MaxAge = Sight.MaxAge;
+                Stimulus.bCurrentlySensed = true;
+                Pending.Add(Stimulus);
+            });
+        }
+
+        if (Listener->IsSenseEnabled(EAISense::Hearing))
+        {
+            const AIHearingConfig& Hearing = Listener->m_HearingConfig;
+            for (const AINoiseEvent& Event : m_NoiseEvents)
+            {
+                if (Event.Serial <= Listener->m_LastNoiseSerial || Event.Instigator == Self)
+                {
+                    continue;
+                }
+
+                float Range = Hearing.HearingRange * Event.Loudness;
+                if ((Event.Location - Location).SizeSquared() > Range * Range)
+                {
+                    continue;
+                }
+
+                // Hearing is momentary - it starts aging right away
+                AIStimulus Stimulus;
+                Stimulus.Source = Event.Instigator;
+                Stimulus.Sense = EAISense::Hearing;
+                Stimulus.Location = Event.Location;
+                Stimulus.Strength = Event.Loudness;
+                Stimulus.MaxAge = Hearing.MaxAge;
+                Stimulus.bCurrentlySensed = false;
+                Pending.Add(Stimulus);
+            }
+        }
+    }
+}
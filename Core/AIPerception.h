@@ -0,0 +1,185 @@
+/*
+ * UE4 AI Perception - Self-contained sight and hearing for AI controllers
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "SpatialIndex.h"
+#include <functional>
+
+namespace UE4SDK
+{
+    // Forward declarations
+    class AIController;
+    class Blackboard;
+
+    enum class EAISense : uint8
+    {
+        Sight = 0,
+        Hearing = 1,
+        Count = 2
+    };
+
+    // Stimulus - something a listener sensed, kept until it ages out
+    struct AIStimulus
+    {
+        AActor* Source = nullptr;
+        EAISense Sense = EAISense::Sight;
+        FVector Location;
+        float Strength = 1.0f;
+        float Age = 0.0f;
+        float MaxAge = 0.0f;
+        bool bCurrentlySensed = false;
+
+        bool IsExpired() const { return !bCurrentlySensed && MaxAge > 0.0f && Age >= MaxAge; }
+    };
+
+    struct AISightConfig
+    {
+        float SightRadius = 3000.0f;
+        float LoseSightRadius = 3500.0f;         // Already seen targets stay visible out to here
+        float PeripheralVisionHalfAngle = 60.0f; // Degrees either side of forward
+        float MaxAge = 5.0f;                     // How long a lost target is remembered
+    };
+
+    struct AIHearingConfig
+    {
+        float HearingRange = 3000.0f;
+        float MaxAge = 3.0f;
+    };
+
+    // Noise event - kept briefly so listeners skipped by the query cap still hear it
+    struct AINoiseEvent
+    {
+        AActor* Instigator = nullptr;
+        FVector Location;
+        float Loudness = 1.0f; // Scales the listener's hearing range
+        float Age = 0.0f;
+        uint32 Serial = 0;
+    };
+
+    // AI Perception Component - per-controller senses, known stimuli and blackboard output
+    class AIPerceptionComponent
+    {
+    public:
+        AIPerceptionComponent();
+        ~AIPerceptionComponent();
+
+        // Owner
+        void SetOwner(AIController* Owner) { m_Owner = Owner; }
+        AIController* GetOwner() const { return m_Owner; }
+
+        // Sense configuration
+        void SetSightConfig(const AISightConfig& Config) { m_SightConfig = Config; }
+        const AISightConfig& GetSightConfig() const { return m_SightConfig; }
+        void SetHearingConfig(const AIHearingConfig& Config) { m_HearingConfig = Config; }
+        const AIHearingConfig& GetHearingConfig() const { return m_HearingConfig; }
+        void SetSenseEnabled(EAISense Sense, bool bEnabled);
+        bool IsSenseEnabled(EAISense Sense) const;
+
+        // Update rate
+        void SetUpdateInterval(float Interval) { m_UpdateInterval = Interval; }
+        float GetUpdateInterval() const { return m_UpdateInterval; }
+
+        // Blackboard output - empty key names are skipped
+        void SetBlackboard(Blackboard* InBlackboard) { m_Blackboard = InBlackboard; }
+        Blackboard* GetBlackboard() const { return m_Blackboard; }
+        void SetTargetKeys(const FString& TargetActorKey, const FString& TargetLocationKey, const FString& HasTargetKey);
+
+        // Results
+        const TArray<AIStimulus>& GetKnownStimuli() const { return m_KnownStimuli; }
+        const AIStimulus* GetBestStimulus() const;
+        AActor* GetBestTarget() const;
+        bool IsCurrentlySensing(AActor* Source, EAISense Sense) const;
+
+        // Callbacks
+        void SetOnTargetPerceptionUpdated(std::function<void(AActor*, const AIStimulus&)> Callback) { m_OnTargetPerceptionUpdated = Callback; }
+
+    private:
+        friend class AIPerceptionSystem;
+
+        AIController* m_Owner;
+        Blackboard* m_Blackboard;
+        AISightConfig m_SightConfig;
+        AIHearingConfig m_HearingConfig;
+        bool m_SenseEnabled[static_cast<int32>(EAISense::Count)];
+        float m_UpdateInterval;
+        float m_TimeSinceUpdate;
+        uint32 m_LastNoiseSerial;
+
+        FString m_TargetActorKey;
+        FString m_TargetLocationKey;
+        FString m_HasTargetKey;
+
+        TArray<AIStimulus> m_KnownStimuli;
+        TArray<AIStimulus> m_PendingStimuli; // Filled by the query pass, merged on the game thread
+        std::function<void(AActor*, const AIStimulus&)> m_OnTargetPerceptionUpdated;
+
+        // Helper functions
+        void AgeStimuli(float DeltaTime);
+        void MergePendingStimuli();
+        void WriteToBlackboard();
+        AIStimulus* FindStimulus(AActor* Source, EAISense Sense);
+    };
+
+    // AI Perception System - shared spatial index and batched sense queries for every listener
+    class AIPerceptionSystem
+    {
+    public:
+        static AIPerceptionSystem& Get();
+
+        // Stimulus sources - anything that can be seen
+        void RegisterStimulusSource(AActor* Source);
+        void UnregisterStimulusSource(AActor* Source);
+        int32 GetStimulusSourceCount() const { return m_StimulusSources.Num(); }
+
+        // Listeners
+        void RegisterListener(AIPerceptionComponent* Listener);
+        void UnregisterListener(AIPerceptionComponent* Listener);
+        int32 GetListenerCount() const { return m_Listeners.Num(); }
+
+        // Hearing
+        void ReportNoiseEvent(AActor* Instigator, const FVector& Location, float Loudness = 1.0f);
+
+        // Budget - listeners past the cap wait for a later frame, round-robin
+        void SetMaxQueriesPerFrame(int32 MaxQueries) { m_MaxQueriesPerFrame = MaxQueries; }
+        int32 GetMaxQueriesPerFrame() const { return m_MaxQueriesPerFrame; }
+        int32 GetQueriesLastFrame() const { return m_QueriesLastFrame; }
+
+        // Spatial index - sources are moved in place each update rather than rebuilt
+        void SetSpatialSettings(const SpatialOctreeSettings& Settings);
+        const SpatialOctree& GetSpatialIndex() const { return m_SpatialIndex; }
+
+        // Called once per AI frame on the game thread
+        void Update(float DeltaTime);
+
+    private:
+        AIPerceptionSystem();
+        ~AIPerceptionSystem() = default;
+
+        AIPerceptionSystem(const AIPerceptionSystem&) = delete;
+        AIPerceptionSystem& operator=(const AIPerceptionSystem&) = delete;
+
+        TArray<AActor*> m_StimulusSources;
+        TArray<int32> m_SourceHandles; // Spatial index handle per source, user id is the source index
+        TArray<AIPerceptionComponent*> m_Listeners;
+        TArray<AINoiseEvent> m_NoiseEvents;
+        SpatialOctree m_SpatialIndex;
+
+        int32 m_MaxQueriesPerFrame;
+        int32 m_QueriesLastFrame;
+        int32 m_NextListener;
+        uint32 m_NextNoiseSerial;
+
+        // Helper functions
+        void UpdateSpatialIndex();
+        void QueryListener(AIPerceptionComponent* Listener, const FVector& Location, const FVector& Forward, APawn* Self) const;
+
+        static AIPerceptionSystem* s_Instance;
+    };
+
+    // Global access macros
+    #define AI_PERCEPTION_SYSTEM UE4SDK::AIPerceptionSystem::Get()
+}
@@ -0,0 +1,307 @@
+/*
+ * UE4 AI Scheduler Implementation - Self-contained AI level-of-detail scheduler
+ * Vibe coder approved ✨
+ */
+
+#include "AIScheduler.h"
+#include "AI.h"
+#include "Utils.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <cmath>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // Maximum number of tiers a busy frame can push agents down
+        const int32 MaxDemotionLevel = 2;
+
+        // Frames comfortably under budget before a demotion step is undone
+        const int32 PromotionDelayFrames = 30;
+    }
+
+    AIScheduler* AIScheduler::s_Instance = nullptr;
+
+    AIScheduler& AIScheduler::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(AI);
+            s_Instance = new AIScheduler();
+        }
+        return *s_Instance;
+    }
+
+    AIScheduler::AIScheduler()
+        : m_FrameBudgetMicroseconds(2000.0f)
+        , m_LastFrameCostMicroseconds(0.0f)
+        , m_DemotionLevel(0)
+        , m_UnderBudgetFrames(0)
+        , m_bEnabled(true)
+    {
+        // Defaults: full rate up close, dormant bots get a heartbeat every couple of seconds
+        SetTierSettings(EAILODTier::High, 2500.0f, 1);
+        SetTierSettings(EAILODTier::Medium, 7500.0f, 4);
+        SetTierSettings(EAILODTier::Low, 20000.0f, 16);
+        SetTierSettings(EAILODTier::Dormant, 0.0f, 120);
+
+        for (int32& Count : m_TierCounts)
+        {
+            Count = 0;
+        }
+    }
+
+    void AIScheduler::RegisterPlayer(APawn* Player)
+    {
+        if (Player && !m_Players.Contains(Player))
+        {
+            m_Players.Add(Player);
+        }
+    }
+
+    void AIScheduler::UnregisterPlayer(APawn* Player)
+    {
+        m_Players.Remove(Player);
+    }
+
+    void AIScheduler::SetTierSettings(EAILODTier Tier, float MaxDistance, int32 TickInterval)
+    {
+        if (Tier >= EAILODTier::Count)
+        {
+            return;
+        }
+
+        AILODTierSettings& Settings = m_TierSettings[static_cast<int32>(Tier)];
+        Settings.MaxDistance = MaxDistance;
+        Settings.TickInterval = std::max(0, TickInterval);
+    }
+
+    const AILODTierSettings& AIScheduler::GetTierSettings(EAILODTier Tier) const
+    {
+        return m_TierSettings[std::min(static_cast<int32>(Tier), static_cast<int32>(EAILODTier::Dormant))];
+    }
+
+    void AIScheduler::BeginFrame(const AIFrameSnapshot& Snapshot, float DeltaTime)
+    {
+        int32 AgentCount = Snapshot.GetAgentCount();
+
+        m_FrameStates.SetNum(AgentCount);
+        m_TickDeltaTimes.SetNum(AgentCount);
+        m_AgentCosts.SetNum(AgentCount);
+        m_TickList.Empty();
+        for (int32& Count : m_TierCounts)
+        {
+            Count = 0;
+        }
+
+        // Player locations are read once per frame, not once per agent
+        m_PlayerLocations.Empty();
+        for (APawn* Player : m_Players)
+        {
+            if (Player)
+            {
+                m_PlayerLocations.Add(Player->GetActorLocation());
+            }
+        }
+
+        TArray<int32> DueAgents;
+        for (int32 Index = 0; Index < AgentCount; ++Index)
+        {
+            const AIAgentSnapshot* Agent = Snapshot.GetAgent(Index);
+            m_FrameStates[Index] = nullptr;
+            m_TickDeltaTimes[Index] = 0.0f;
+            m_AgentCosts[Index] = 0.0f;
+
+            if (!Agent->bIsActive)
+            {
+                continue;
+            }
+
+            if (!m_bEnabled)
+            {
+                m_TickDeltaTimes[Index] = DeltaTime;
+                m_TickList.Add(Index);
+                continue;
+            }
+
+            AgentState& State = m_AgentStates.FindOrAdd(Agent->Controller, AgentState());
+            State.Tier = ComputeTier(*Agent);
+            State.AccumulatedTime += DeltaTime;
+            m_FrameStates[Index] = &State;
+            ++m_TierCounts[static_cast<int32>(State.Tier)];
+
+            int32 TickInterval = m_TierSettings[static_cast<int32>(State.Tier)].TickInterval;
+            if (State.bIsNew)
+            {
+                // Stagger newcomers so a wave of spawns doesn't tick in lockstep
+                State.FramesSinceTick = TickInterval > 0 ? Index % TickInterval : 0;
+                State.bIsNew = false;
+            }
+            ++State.FramesSinceTick;
+
+            if (TickInterval > 0 && State.FramesSinceTick >= TickInterval)
+            {
+                DueAgents.Add(Index);
+            }
+        }
+
+        if (!m_bEnabled)
+        {
+            return;
+        }
+
+        // Most overdue relative to the tier's interval first, so the budget cuts from the far end.
+        // A skipped agent's ratio keeps growing until it outranks fresh High agents, which bounds
+        // how stale any tier can get. Ties go to the more important tier.
+        std::sort(DueAgents.begin(), DueAgents.end(), [this](int32 A, int32 B)
+        {
+            const AgentState* StateA = m_FrameStates[A];
+            const AgentState* StateB = m_FrameStates[B];
+            int64 Overdue = static_cast<int64>(StateA->FramesSinceTick) * m_TierSettings[static_cast<int32>(StateB->Tier)].TickInterval -
+                            static_cast<int64>(StateB->FramesSinceTick) * m_TierSettings[static_cast<int32>(StateA->Tier)].TickInterval;
+            if (Overdue != 0)
+            {
+                return Overdue > 0;
+            }
+            return StateA->Tier < StateB->Tier;
+        });
+
+        float EstimatedCost = 0.0f;
+        for (int32 Index : DueAgents)
+        {
+            AgentState* State = m_FrameStates[Index];
+            if (m_FrameBudgetMicroseconds > 0.0f && m_TickList.Num() > 0 &&
+                EstimatedCost + State->LastCostMicroseconds > m_FrameBudgetMicroseconds)
+            {
+                // Out of budget - remaining agents stay due and keep accumulating time
+                break;
+            }
+
+            EstimatedCost += State->LastCostMicroseconds;
+            m_TickDeltaTimes[Index] = State->AccumulatedTime;
+            State->AccumulatedTime = 0.0f;
+            State->FramesSinceTick = 0;
+            m_TickList.Add(Index);
+        }
+
+        // Registration order for the tick itself keeps batches cache friendly and results deterministic
+        std::sort(m_TickList.begin(), m_TickList.end());
+    }
+
+    void AIScheduler::EndFrame()
+    {
+        float FrameCost = 0.0f;
+        for (int32 Index : m_TickList)
+        {
+            FrameCost += m_AgentCosts[Index];
+            if (m_FrameStates[Index])
+            {
+                m_FrameStates[Index]->LastCostMicroseconds = m_AgentCosts[Index];
+            }
+        }
+
+        m_LastFrameCostMicroseconds = FrameCost;
+        UpdateDemotion();
+    }
+
+    void AIScheduler::RemoveAgent(AIController* Controller)
+    {
+        m_AgentStates.Remove(Controller);
+    }
+
+    EAILODTier AIScheduler::GetAgentTier(AIController* Controller) const
+    {
+        const AgentState* State = m_AgentStates.Find(Controller);
+        return State ? State->Tier : EAILODTier::High;
+    }
+
+    int32 AIScheduler::GetTierCount(EAILODTier Tier) const
+    {
+        if (Tier >= EAILODTier::Count)
+        {
+            return 0;
+        }
+        return m_TierCounts[static_cast<int32>(Tier)];
+    }
+
+    EAILODTier AIScheduler::ComputeTier(const AIAgentSnapshot& Agent) const
+    {
+        // Without players or a pawn there's nothing to measure against
+        if (m_PlayerLocations.Num() == 0 || !Agent.bHasPawn)
+        {
+            return EAILODTier::High;
+        }
+
+        float ClosestDistanceSquared = -1.0f;
+        for (const FVector& PlayerLocation : m_PlayerLocations)
+        {
+            float DistanceSquared = (Agent.Location - PlayerLocation).SizeSquared();
+            if (ClosestDistanceSquared < 0.0f || DistanceSquared < ClosestDistanceSquared)
+            {
+                ClosestDistanceSquared = DistanceSquared;
+            }
+        }
+
+        float Distance = std::sqrt(ClosestDistanceSquared);
+        if (m_CustomScoreCallback)
+        {
+            Distance *= std::max(0.0f, m_CustomScoreCallback(Agent));
+        }
+
+        int32 Tier = static_cast<int32>(EAILODTier::Dormant);
+        for (int32 Candidate = 0; Candidate < static_cast<int32>(EAILODTier::Dormant); ++Candidate)
+        {
+            if (Distance <= m_TierSettings[Candidate].MaxDistance)
+            {
+                Tier = Candidate;
+                break;
+            }
+        }
+
+        if (Tier == static_cast<int32>(EAILODTier::Dormant))
+        {
+            return EAILODTier::Dormant;
+        }
+
+        if (m_VisibilityCallback && !m_VisibilityCallback(Agent))
+        {
+            ++Tier;
+        }
+
+        // Budget pressure never makes an agent dormant - only distance does
+        Tier = std::min(Tier + m_DemotionLevel, static_cast<int32>(EAILODTier::Low));
+        return static_cast<EAILODTier>(Tier);
+    }
+
+    void AIScheduler::UpdateDemotion()
+    {
+        if (m_FrameBudgetMicroseconds <= 0.0f)
+        {
+            m_DemotionLevel = 0;
+            return;
+        }
+
+        if (m_LastFrameCostMicroseconds > m_FrameBudgetMicroseconds)
+        {
+            if (m_DemotionLevel < MaxDemotionLevel)
+            {
+                ++m_DemotionLevel;
+                Utils::Get().LogWarning(TEXT("AI frame over budget, demoting tiers to level ") + FString::FromInt(m_DemotionLevel));
+            }
+            m_UnderBudgetFrames = 0;
+        }
+        else if (m_DemotionLevel > 0 && m_LastFrameCostMicroseconds < m_FrameBudgetMicroseconds * 0.5f)
+        {
+            if (++m_UnderBudgetFrames >= PromotionDelayFrames)
+            {
+                --m_DemotionLevel;
+                m_UnderBudgetFrames = 0;
+            }
+        }
+        else
+        {
+            m_UnderBudgetFrames = 0;
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * UE4 AI Scheduler - Self-contained AI level-of-detail scheduler
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <functional>
+
+namespace UE4SDK
+{
+    // Forward declarations
+    class AIController;
+    class AIFrameSnapshot;
+    struct AIAgentSnapshot;
+
+    // AI LOD tiers, most expensive first
+    enum class EAILODTier : uint8
+    {
+        High = 0,
+        Medium = 1,
+        Low = 2,
+        Dormant = 3,
+        Count = 4
+    };
+
+    // Per-tier settings - agents within MaxDistance of a player tick every TickInterval frames
+    struct AILODTierSettings
+    {
+        float MaxDistance = 0.0f;
+        int32 TickInterval = 1; // 0 = never tick
+    };
+
+    // AI Scheduler - buckets controllers into LOD tiers and decides who ticks each AI frame.
+    // Updates are staggered across frames and capped by a global per-frame budget.
+    class AIScheduler
+    {
+    public:
+        static AIScheduler& Get();
+
+        // Players - LOD distance is measured to the nearest registered player pawn
+        void RegisterPlayer(APawn* Player);
+        void UnregisterPlayer(APawn* Player);
+        int32 GetPlayerCount() const { return m_Players.Num(); }
+
+        // Tier settings
+        void SetTierSettings(EAILODTier Tier, float MaxDistance, int32 TickInterval);
+        const AILODTierSettings& GetTierSettings(EAILODTier Tier) const;
+
+        // Relevance hooks - hidden agents drop one tier, the custom score scales distance (< 1 = more important)
+        void SetVisibilityCallback(std::function<bool(const AIAgentSnapshot&)> Callback) { m_VisibilityCallback = Callback; }
+        void SetCustomScoreCallback(std::function<float(const AIAgentSnapshot&)> Callback) { m_CustomScoreCallback = Callback; }
+
+        // Budget - when a frame runs over, every non-dormant tier is demoted one step
+        void SetFrameBudgetMicroseconds(float Budget) { m_FrameBudgetMicroseconds = Budget; }
+        float GetFrameBudgetMicroseconds() const { return m_FrameBudgetMicroseconds; }
+        int32 GetDemotionLevel() const { return m_DemotionLevel; }
+        float GetLastFrameCostMicroseconds() const { return m_LastFrameCostMicroseconds; }
+
+        // Disabled = every active controller ticks every frame
+        void SetEnabled(bool bEnabled) { m_bEnabled = bEnabled; }
+        bool IsEnabled() const { return m_bEnabled; }
+
+        // Per-frame scheduling - called by AISystem around the controller tick
+        void BeginFrame(const AIFrameSnapshot& Snapshot, float DeltaTime);
+        const TArray<int32>& GetTickList() const { return m_TickList; }
+        float GetTickDeltaTime(int32 AgentIndex) const { return m_TickDeltaTimes[AgentIndex]; }
+        void RecordAgentCost(int32 AgentIndex, float Microseconds) { m_AgentCosts[AgentIndex] = Microseconds; }
+        void EndFrame();
+
+        // Agent queries
+        void RemoveAgent(AIController* Controller);
+        EAILODTier GetAgentTier(AIController* Controller) const;
+        int32 GetTierCount(EAILODTier Tier) const;
+
+    private:
+        AIScheduler();
+        ~AIScheduler() = default;
+
+        AIScheduler(const AIScheduler&) = delete;
+        AIScheduler& operator=(const AIScheduler&) = delete;
+
+        struct AgentState
+        {
+            EAILODTier Tier = EAILODTier::High;
+            int32 FramesSinceTick = 0;
+            float AccumulatedTime = 0.0f;
+            float LastCostMicroseconds = 0.0f;
+            bool bIsNew = true;
+        };
+
+        TMap<AIController*, AgentState> m_AgentStates;
+        TArray<APawn*> m_Players;
+        TArray<FVector> m_PlayerLocations;
+        AILODTierSettings m_TierSettings[static_cast<int32>(EAILODTier::Count)];
+        int32 m_TierCounts[static_cast<int32>(EAILODTier::Count)];
+
+        std::function<bool(const AIAgentSnapshot&)> m_VisibilityCallback;
+        std::function<float(const AIAgentSnapshot&)> m_CustomScoreCallback;
+
+        // Frame state, indexed by agent index in the current snapshot
+        TArray<AgentState*> m_FrameStates;
+        TArray<int32> m_TickList;
+        TArray<float> m_TickDeltaTimes;
+        TArray<float> m_AgentCosts;
+
+        float m_FrameBudgetMicroseconds;
+        float m_LastFrameCostMicroseconds;
+        int32 m_DemotionLevel;
+        int32 m_UnderBudgetFrames;
+        bool m_bEnabled;
+
+        // Helper functions
+        EAILODTier ComputeTier(const AIAgentSnapshot& Agent) const;
+        void UpdateDemotion();
+
+        static AIScheduler* s_Instance;
+    };
+
+    // Global access macros
+    #define AI_SCHEDULER UE4SDK::AIScheduler::Get()
+}
@@ -5,6 +5,7 @@
 
 #include "Blackboard.h"
 #include "Utils.h"
+#include "MemoryTracker.h"
 #include <algorithm>
 
 namespace UE4SDK
@@ -33,6 +34,7 @@ namespace UE4SDK
 
     void BlackboardData::AddKey(const FString& KeyName, EBlackboardKeyType KeyType, const FString& Description)
     {
+        MEMORY_TAG_SCOPE(Blackboard);
         if (HasKey(KeyName))
         {
             Utils::Get().LogWarning(TEXT("BlackboardData::AddKey - Key already exists: ") + KeyName);
@@ -208,7 +210,7 @@ namespace UE4SDK
 
     // Blackboard implementation
     Blackboard::Blackboard()
-        : m_BlackboardName(TEXT("UnnamedBlackboard")), m_BlackboardData(nullptr)
+        : m_BlackboardName(TEXT("UnnamedBlackboard")), m_BlackboardData(nullptr), m_NextObserverHandle(1)
     {
     }
 
@@ -225,8 +227,10 @@ namespace UE4SDK
             return;
         }
         
-        m_ObjectValues.Add(KeyName, ObjectValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_ObjectValues, KeyName, ObjectValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsClass(const FString& KeyName, UClass* ClassValue)
@@ -237,8 +241,10 @@ namespace UE4SDK
             return;
         }
         
-        m_ClassValues.Add(KeyName, ClassValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_ClassValues, KeyName, ClassValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsEnum(const FString& KeyName, int32 EnumValue)
@@ -249,8 +255,10 @@ namespace UE4SDK
             return;
         }
         
-        m_IntValues.Add(KeyName, EnumValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_IntValues, KeyName, EnumValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsInt(const FString& KeyName, int32 IntValue)
@@ -261,8 +269,10 @@ namespace UE4SDK
             return;
         }
         
-        m_IntValues.Add(KeyName, IntValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_IntValues, KeyName, IntValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsFloat(const FString& KeyName, float FloatValue)
@@ -273,8 +283,10 @@ namespace UE4SDK
             return;
         }
         
-        m_FloatValues.Add(KeyName, FloatValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_FloatValues, KeyName, FloatValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsBool(const FString& KeyName, bool BoolValue)
@@ -285,8 +297,10 @@ namespace UE4SDK
             return;
         }
         
-        m_BoolValues.Add(KeyName, BoolValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_BoolValues, KeyName, BoolValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsString(const FString& KeyName, const FString& StringValue)
@@ -297,8 +311,10 @@ namespace UE4SDK
             return;
         }
         
-        m_StringValues.Add(KeyName, StringValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_StringValues, KeyName, StringValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsVector(const FString& KeyName, const FVector& VectorValue)
@@ -309,8 +325,10 @@ namespace UE4SDK
             return;
         }
         
-        m_VectorValues.Add(KeyName, VectorValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_VectorValues, KeyName, VectorValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsRotator(const FString& KeyName, const FRotator& RotatorValue)
@@ -321,8 +339,10 @@ namespace UE4SDK
             return;
         }
         
-        m_RotatorValues.Add(KeyName, RotatorValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_RotatorValues, KeyName, RotatorValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     void Blackboard::SetValueAsName(const FString& KeyName, const FName& NameValue)
@@ -333,8 +353,10 @@ namespace UE4SDK
             return;
         }
         
-        m_NameValues.Add(KeyName, NameValue);
-        NotifyValueChanged(KeyName);
+        if (StoreValue(m_NameValues, KeyName, NameValue))
+        {
+            NotifyValueChanged(KeyName);
+        }
     }
 
     UObject* Blackboard::GetValueAsObject(const FString& KeyName) const
@@ -486,6 +508,42 @@ namespace UE4SDK
         m_AnyValueChangedCallback = Callback;
     }
 
+    int32 Blackboard::AddObserver(const FString& KeyName, std::function<void(const FString&)> Callback)
+    {
+        if (!Callback)
+        {
+            return 0;
+        }
+        
+        KeyObserver Observer;
+        Observer.Handle = m_NextObserverHandle++;
+        Observer.Callback = Callback;
+        m_KeyObservers.FindOrAdd(KeyName).Add(Observer);
+        return Observer.Handle;
+    }
+
+    void Blackboard::RemoveObserver(int32 Handle)
+    {
+        for (auto& Pair : m_KeyObservers)
+        {
+            TArray<KeyObserver>& Observers = Pair.second;
+            for (int32 i = 0; i < Observers.Num(); ++i)
+            {
+                if (Observers[i].Handle == Handle)
+                {
+                    Observers.RemoveAt(i);
+                    return;
+                }
+            }
+        }
+    }
+
+    int32 Blackboard::GetObserverCount(const FString& KeyName) const
+    {
+        const TArray<KeyObserver>* Observers = m_KeyObservers.Find(KeyName);
+        return Observers ? Observers->Num() : 0;
+    }
+
     void Blackboard::Initialize()
     {
         if (m_BlackboardData)
@@ -661,6 +719,17 @@ namespace UE4SDK
             (*Callback)();
         }
         
+        // Call key observers - copied since an observer may add or remove observers
+        const TArray<KeyObserver>* Observers = m_KeyObservers.Find(KeyName);
+        if (Observers && Observers->Num() > 0)
+        {
+            TArray<KeyObserver> ObserversCopy = *Observers;
+            for (const KeyObserver& Observer : ObserversCopy)
+            {
+                Observer.Callback(KeyName);
+            }
+        }
+        
         // Call any value changed callback
         if (m_AnyValueChangedCallback)
         {
@@ -803,6 +872,7 @@ namespace UE4SDK
     {
         if (!s_Instance)
         {
+            MEMORY_TAG_SCOPE(Blackboard);
             s_Instance = new BlackboardSystem();
         }
         return *s_Instance;
@@ -810,6 +880,7 @@ namespace UE4SDK
 
     BlackboardData* BlackboardSystem::CreateBlackboardData(const FString& DataName)
     {
+        MEMORY_TAG_SCOPE(Blackboard);
         auto NewData = std::make_unique<BlackboardData>();
         NewData->SetDataName(DataName);
         BlackboardData* DataPtr = NewData.get();
@@ -853,6 +924,7 @@ namespace UE4SDK
 
     Blackboard* BlackboardSystem::CreateBlackboard(const FString& BlackboardName, BlackboardData* Data)
     {
+        MEMORY_TAG_SCOPE(Blackboard);
         auto NewBlackboard = std::make_unique<Blackboard>();
         NewBlackboard->SetBlackboardName(BlackboardName);
         if (Data)
@@ -901,6 +973,7 @@ namespace UE4SDK
 
     BlackboardComponent* BlackboardSystem::CreateBlackboardComponent(const FString& ComponentName)
     {
+        MEMORY_TAG_SCOPE(Blackboard);
         auto NewComponent = std::make_unique<BlackboardComponent>();
         NewComponent->SetComponentName(ComponentName);
         BlackboardComponent* ComponentPtr = NewComponent.get();
@@ -153,6 +153,11 @@ namespace UE4SDK
         void ClearOnValueChangedCallback(const FString& KeyName);
         void SetOnAnyValueChangedCallback(std::function<void(const FString&)> Callback);
 
+        // Key observers - any number per key, fired only when the stored value actually changes
+        int32 AddObserver(const FString& KeyName, std::function<void(const FString&)> Callback);
+        void RemoveObserver(int32 Handle);
+        int32 GetObserverCount(const FString& KeyName) const;
+
         // Blackboard state
         bool IsInitialized() const { return m_BlackboardData != nullptr; }
         void Initialize();
@@ -194,8 +199,30 @@ namespace UE4SDK
         TMap<FString, std::function<void()>> m_ValueChangedCallbacks;
         std::function<void(const FString&)> m_AnyValueChangedCallback;
         
+        // Key observers
+        struct KeyObserver
+        {
+            int32 Handle;
+            std::function<void(const FString&)> Callback;
+        };
+        TMap<FString, TArray<KeyObserver>> m_KeyObservers;
+        int32 m_NextObserverHandle;
+        
         // Helper functions
         void NotifyValueChanged(const FString& KeyName);
+        
+        // Stores a value and returns true if it differs from what was there
+        template<typename T>
+        bool StoreValue(TMap<FString, T>& Values, const FString& KeyName, const T& Value)
+        {
+            T* Existing = Values.Find(KeyName);
+            if (Existing && *Existing == Value)
+            {
+                return false;
+            }
+            Values.Add(KeyName, Value);
+            return true;
+        }
         bool IsKeyRegistered(const FString& KeyName) const;
         EBlackboardKeyType GetRegisteredKeyType(const FString& KeyName) const;
     };
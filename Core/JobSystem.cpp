@@ -0,0 +1,774 @@
+/*
+ * UE4 Job System Implementation - Self-contained work-stealing worker pool
+ * Vibe coder approved ✨
+ */
+
+#include "JobSystem.h"
+#include "Utils.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        thread_local int32 t_WorkerIndex = -1;
+
+        // Shared and game thread queue sizes, producers fall back to running inline when they fill up
+        const uint32 SharedQueueCapacity = 16384;
+        const uint32 GameThreadQueueCapacity = 16384;
+    }
+
+    // JobTask implementation
+    JobTask::~JobTask()
+    {
+        // Never completed - drop the edges that were waiting on it
+        Subsequent* Head = m_Subsequents.load(std::memory_order_acquire);
+        while (Head && Head != GetClosedMarker())
+        {
+            Subsequent* Next = Head->Next;
+            delete Head;
+            Head = Next;
+        }
+    }
+
+    // WorkStealingQueue implementation
+    JobSystem::WorkStealingQueue::WorkStealingQueue()
+        : m_Top(0)
+        , m_Bottom(0)
+    {
+        for (auto& Slot : m_Slots)
+        {
+            Slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    bool JobSystem::WorkStealingQueue::Push(Job* InJob)
+    {
+        int64 Bottom = m_Bottom.load(std::memory_order_relaxed);
+        int64 Top = m_Top.load(std::memory_order_acquire);
+        if (Bottom - Top >= Capacity)
+        {
+            return false;
+        }
+
+        m_Slots[Bottom & (Capacity - 1)].store(InJob, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Bottom.store(Bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    JobSystem::Job* JobSystem::WorkStealingQueue::Pop()
+    {
+        // Claim the bottom slot first, then check whether a thief got there too
+        int64 Bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(Bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 Top = m_Top.load(std::memory_order_relaxed);
+
+        if (Top > Bottom)
+        {
+            m_Bottom.store(Bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* Result = m_Slots[Bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (Top == Bottom)
+        {
+            // Last job - race thieves for it
+            if (!m_Top.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                Result = nullptr;
+            }
+            m_Bottom.store(Bottom + 1, std::memory_order_relaxed);
+        }
+        return Result;
+    }
+
+    JobSystem::Job* JobSystem::WorkStealingQueue::Steal()
+    {
+        int64 Top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 Bottom = m_Bottom.load(std::memory_order_acquire);
+        if (Top >= Bottom)
+        {
+            return nullptr;
+        }
+
+        Job* Result = m_Slots[Top & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr; // Lost to the owner or another thief
+        }
+        return Result;
+    }
+
+    // JobQueue implementation
+    JobSystem::JobQueue::JobQueue(uint32 Capacity)
+        : m_EnqueuePos(0)
+        , m_DequeuePos(0)
+    {
+        uint32 Size = 1;
+        while (Size < Capacity)
+        {
+            Size <<= 1;
+        }
+
+        m_Cells.reset(new Cell[Size]);
+        m_Mask = Size - 1;
+        for (uint32 i = 0; i < Size; ++i)
+        {
+            m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+            m_Cells[i].Data = nullptr;
+        }
+    }
+
+    bool JobSystem::JobQueue::Enqueue(Job* InJob)
+    {
+        uint64 Position = m_EnqueuePos.load(std::memory_order_relaxed);
+        Cell* Target;
+        while (true)
+        {
+            Target = &m_Cells[Position & m_Mask];
+            uint64 Sequence = Target->Sequence.load(std::memory_order_acquire);
+            int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+            if (Difference == 0)
+            {
+                if (m_EnqueuePos.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Difference < 0)
+            {
+                return false; // Full
+            }
+            else
+            {
+                Position = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        Target->Data = InJob;
+        Target->Sequence.store(Position + 1, std::memory_order_release);
+        return true;
+    }
+
+    JobSystem::Job* JobSystem::JobQueue::Dequeue()
+    {
+        uint64 Position = m_DequeuePos.load(std::memory_order_relaxed);
+        Cell* Target;
+        while (true)
+        {
+            Target = &m_Cells[Position & m_Mask];
+            uint64 Sequence = Target->Sequence.load(std::memory_order_acquire);
+            int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position + 1);
+            if (Difference == 0)
+            {
+                if (m_DequeuePos.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (Difference < 0)
+            {
+                return nullptr; // Empty
+            }
+            else
+            {
+                Position = m_DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        Job* Result = Target->Data;
+        Target->Sequence.store(Position + m_Mask + 1, std::memory_order_release);
+        return Result;
+    }
+
+    // JobSystem implementation
+    JobSystem* JobSystem::s_Instance = nullptr;
+
+    JobSystem& JobSystem::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(Tasks);
+            s_Instance = new JobSystem();
+        }
+        return *s_Instance;
+    }
+
+    JobSystem::JobSystem()
+        : m_GameThreadQueue(std::make_unique<JobQueue>(GameThreadQueueCapacity))
+        , m_QueuedJobs(0)
+        , m_SleepingWorkers(0)
+        , m_bShuttingDown(false)
+        , m_bIsInitialized(false)
+        , m_CurrentTick(0)
+        , m_NextDeadlineTick(std::numeric_limits<uint64>::max())
+        , m_TimerCount(0)
+        , m_TimerStart(std::chrono::steady_clock::now())
+    {
+        for (TimerEntry*& Slot : m_TimerSlots)
+        {
+            Slot = nullptr;
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        Shutdown();
+
+        while (Job* Pending = m_GameThreadQueue->Dequeue())
+        {
+            delete Pending;
+        }
+    }
+
+    void JobSystem::Initialize(int32 NumWorkers)
+    {
+        std::lock_guard<std::mutex> StateLock(m_StateMutex);
+        if (m_bIsInitialized)
+        {
+            return;
+        }
+
+        if (NumWorkers <= 0)
+        {
+            // Leave one core for the game thread
+            int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+            NumWorkers = std::max(1, HardwareThreads - 1);
+        }
+
+        m_bShuttingDown = false;
+        m_GameThreadId = std::this_thread::get_id();
+
+        m_Queues.clear();
+        for (int32 i = 0; i < NumWorkers; ++i)
+        {
+            m_Queues.push_back(std::make_unique<WorkStealingQueue>());
+        }
+        m_SharedQueue = std::make_unique<JobQueue>(SharedQueueCapacity);
+
+        for (int32 i = 0; i < NumWorkers; ++i)
+        {
+            m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+        }
+
+        m_CurrentTick = GetCurrentTick();
+        m_TimerThread = std::thread(&JobSystem::TimerLoop, this);
+
+        m_bIsInitialized = true;
+        Utils::Get().LogInfo(TEXT("JobSystem initialized with ") + FString::FromInt(NumWorkers) + TEXT(" workers"));
+    }
+
+    void JobSystem::Shutdown()
+    {
+        std::lock_guard<std::mutex> StateLock(m_StateMutex);
+        if (!m_bIsInitialized)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(m_TimerMutex);
+            m_bShuttingDown = true;
+        }
+        m_TimerCondition.notify_all();
+        if (m_TimerThread.joinable())
+        {
+            m_TimerThread.join();
+        }
+        ClearTimers();
+
+        {
+            std::lock_guard<std::mutex> Lock(m_WakeMutex);
+        }
+        m_WakeCondition.notify_all();
+
+        // Workers drain everything already queued before they exit
+        for (auto& Worker : m_Workers)
+        {
+            if (Worker.joinable())
+            {
+                Worker.join();
+            }
+        }
+
+        // Anything queued after the workers left - timers released by ClearTimers or a racing
+        // LaunchDelayed - runs here. New work runs inline from now on.
+        m_bIsInitialized = false;
+        while (TryRunJob(-1))
+        {
+        }
+
+        m_Workers.clear();
+        m_Queues.clear();
+        m_SharedQueue.reset();
+        m_QueuedJobs = 0;
+    }
+
+    void JobSystem::Dispatch(std::function<void()> Function, JobCounter* Counter)
+    {
+        if (Counter)
+        {
+            Counter->Add();
+        }
+
+        Job* NewJob = new Job();
+        NewJob->Function = std::move(Function);
+        NewJob->Counter = Counter;
+        Enqueue(NewJob);
+    }
+
+    void JobSystem::Wait(JobCounter& Counter)
+    {
+        // Help out instead of blocking so nested waits can't starve the pool
+        while (!Counter.IsDone())
+        {
+            if (!m_bIsInitialized || !TryRunJob(GetCurrentWorkerIndex()))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::ParallelFor(int32 Count, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body)
+    {
+        if (Count <= 0)
+        {
+            return;
+        }
+
+        BatchSize = std::max(1, BatchSize);
+
+        if (!m_bIsInitialized || Count <= BatchSize)
+        {
+            Body(0, Count);
+            return;
+        }
+
+        JobCounter Counter;
+        for (int32 Begin = 0; Begin < Count; Begin += BatchSize)
+        {
+            int32 End = std::min(Count, Begin + BatchSize);
+            Dispatch([&Body, Begin, End]() { Body(Begin, End); }, &Counter);
+        }
+
+        Wait(Counter);
+    }
+
+    JobHandle JobSystem::Launch(std::function<void()> Function, const TArray<JobHandle>& Prerequisites, EJobThread Thread)
+    {
+        JobHandle Task = std::make_shared<JobTask>();
+        Task->m_Function = std::move(Function);
+        Task->m_Thread = Thread;
+
+        // The launch reference keeps the task from starting while edges are still being added
+        for (const JobHandle& Prerequisite : Prerequisites)
+        {
+            if (Prerequisite)
+            {
+                Task->m_PendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+                if (!AddSubsequent(Prerequisite, Task))
+                {
+                    Task->m_PendingPrerequisites.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        ReleasePrerequisite(Task);
+        return Task;
+    }
+
+    JobHandle JobSystem::Then(const JobHandle& Prerequisite, std::function<void()> Function, EJobThread Thread)
+    {
+        TArray<JobHandle> Prerequisites;
+        Prerequisites.Add(Prerequisite);
+        return Launch(std::move(Function), Prerequisites, Thread);
+    }
+
+    void JobSystem::Wait(const JobHandle& Task)
+    {
+        // The game thread also drains its own queue, the task may be waiting on it
+        while (Task && !Task->IsComplete())
+        {
+            bool bRanSomething = IsGameThread() && ProcessGameThreadTasks(1) > 0;
+            if (!bRanSomething && (!m_bIsInitialized || !TryRunJob(GetCurrentWorkerIndex())))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    JobHandle JobSystem::LaunchDelayed(float Seconds, std::function<void()> Function, EJobThread Thread)
+    {
+        if (!m_bIsInitialized || Seconds <= 0.0f)
+        {
+            return Launch(std::move(Function), TArray<JobHandle>(), Thread);
+        }
+
+        JobHandle Task = std::make_shared<JobTask>();
+        Task->m_Function = std::move(Function);
+        Task->m_Thread = Thread;
+
+        // The timer holds the launch reference and releases it on expiry
+        uint64 Ticks = std::max<uint64>(1, static_cast<uint64>(std::ceil(Seconds / TimerResolution)));
+        bool bWakeTimer = false;
+        {
+            std::unique_lock<std::mutex> Lock(m_TimerMutex);
+            if (m_bShuttingDown)
+            {
+                // Lost the race with Shutdown - ClearTimers may already have run, skip the delay
+                Lock.unlock();
+                ReleasePrerequisite(Task);
+                return Task;
+            }
+
+            TimerEntry* Entry = new TimerEntry();
+            Entry->Task = Task;
+            Entry->DeadlineTick = GetCurrentTick() + Ticks;
+            TimerEntry*& Slot = m_TimerSlots[Entry->DeadlineTick & (TimerSlotCount - 1)];
+            Entry->Next = Slot;
+            Slot = Entry;
+
+            // An idle wheel stopped turning, catch it up before the first insert
+            if (m_TimerCount.fetch_add(1, std::memory_order_acq_rel) == 0)
+            {
+                uint64 Now = GetCurrentTick();
+                m_CurrentTick = std::max(m_CurrentTick, Now > 0 ? Now - 1 : 0);
+            }
+
+            // Only an earlier deadline changes how long the timer thread should sleep
+            bWakeTimer = Entry->DeadlineTick < m_NextDeadlineTick;
+            m_NextDeadlineTick = std::min(m_NextDeadlineTick, Entry->DeadlineTick);
+        }
+        if (bWakeTimer)
+        {
+            m_TimerCondition.notify_one();
+        }
+        return Task;
+    }
+
+    int32 JobSystem::ProcessGameThreadTasks(int32 MaxTasks)
+    {
+        // Unbounded calls still stop after one queue's worth, so a task that requeues itself can't spin here
+        int32 Budget = MaxTasks > 0 ? MaxTasks : static_cast<int32>(GameThreadQueueCapacity);
+        int32 Ran = 0;
+        while (Ran < Budget)
+        {
+            Job* Next = m_GameThreadQueue->Dequeue();
+            if (!Next)
+            {
+                break;
+            }
+
+            RunJob(Next);
+            ++Ran;
+        }
+        return Ran;
+    }
+
+    int32 JobSystem::GetCurrentWorkerIndex()
+    {
+        return t_WorkerIndex;
+    }
+
+    void JobSystem::WorkerLoop(int32 WorkerIndex)
+    {
+        t_WorkerIndex = WorkerIndex;
+
+        while (true)
+        {
+            if (TryRunJob(WorkerIndex))
+            {
+                continue;
+            }
+
+            // Producers only take the lock when someone is asleep, both sides use seq_cst so one of them sees the other
+            std::unique_lock<std::mutex> Lock(m_WakeMutex);
+            m_SleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            m_WakeCondition.wait(Lock, [this]() {
+                return m_bShuttingDown.load() || m_QueuedJobs.load(std::memory_order_seq_cst) > 0;
+            });
+            m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+            if (m_bShuttingDown && m_QueuedJobs.load(std::memory_order_acquire) == 0)
+            {
+                break;
+            }
+        }
+
+        t_WorkerIndex = -1;
+    }
+
+    void JobSystem::TimerLoop()
+    {
+        TArray<JobHandle> Expired;
+        std::unique_lock<std::mutex> Lock(m_TimerMutex);
+        while (!m_bShuttingDown)
+        {
+            if (m_TimerCount.load(std::memory_order_acquire) == 0)
+            {
+                m_TimerCondition.wait(Lock, [this]() { return m_bShuttingDown.load() || m_TimerCount.load(std::memory_order_acquire) > 0; });
+                continue;
+            }
+
+            // Sleep straight through to the earliest deadline - LaunchDelayed wakes us for an earlier one
+            uint64 Now = GetCurrentTick();
+            if (Now < m_NextDeadlineTick)
+            {
+                m_TimerCondition.wait_until(Lock, m_TimerStart + std::chrono::duration<double>(m_NextDeadlineTick * static_cast<double>(TimerResolution)));
+                continue;
+            }
+
+            // Visit every slot passed since the last turn, a full revolution at most
+            uint64 Steps = std::min<uint64>(Now > m_CurrentTick ? Now - m_CurrentTick : 0, TimerSlotCount);
+            for (uint64 Step = 1; Step <= Steps; ++Step)
+            {
+                TimerEntry** Link = &m_TimerSlots[(m_CurrentTick + Step) & (TimerSlotCount - 1)];
+                while (*Link)
+                {
+                    TimerEntry* Entry = *Link;
+                    if (Entry->DeadlineTick <= Now)
+                    {
+                        *Link = Entry->Next;
+                        Expired.Add(std::move(Entry->Task));
+                        delete Entry;
+                    }
+                    else
+                    {
+                        Link = &Entry->Next; // Later revolution
+                    }
+                }
+            }
+            m_CurrentTick = std::max(m_CurrentTick, Now);
+            m_NextDeadlineTick = FindNextDeadline();
+
+            if (Expired.Num() > 0)
+            {
+                m_TimerCount.fetch_sub(Expired.Num(), std::memory_order_acq_rel);
+                Lock.unlock();
+                for (const JobHandle& Task : Expired)
+                {
+                    ReleasePrerequisite(Task);
+                }
+                Expired.Empty();
+                Lock.lock();
+            }
+        }
+    }
+
+    void JobSystem::Enqueue(Job* InJob)
+    {
+        if (!m_bIsInitialized)
+        {
+            // No pool - run inline so callers never deadlock waiting on the counter
+            RunJob(InJob);
+            return;
+        }
+
+        // Workers push to their own deque, everyone else goes through the shared queue
+        int32 WorkerIndex = GetCurrentWorkerIndex();
+        bool bQueued = (WorkerIndex >= 0 && m_Queues[WorkerIndex]->Push(InJob)) || m_SharedQueue->Enqueue(InJob);
+        if (!bQueued)
+        {
+            // Everything is full - doing the work here is the back-pressure
+            RunJob(InJob);
+            return;
+        }
+
+        m_QueuedJobs.fetch_add(1, std::memory_order_seq_cst);
+        WakeWorker();
+    }
+
+    void JobSystem::WakeWorker()
+    {
+        if (m_SleepingWorkers.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                // Pairs with the predicate check in WorkerLoop so a wakeup can't slip between check and sleep
+                std::lock_guard<std::mutex> Lock(m_WakeMutex);
+            }
+            m_WakeCondition.notify_one();
+        }
+    }
+
+    bool JobSystem::TryRunJob(int32 WorkerIndex)
+    {
+        Job* NextJob = nullptr;
+        int32 QueueCount = static_cast<int32>(m_Queues.size());
+
+        // LIFO from our own deque keeps freshly pushed work hot in cache
+        if (WorkerIndex >= 0)
+        {
+            NextJob = m_Queues[WorkerIndex]->Pop();
+        }
+        if (!NextJob)
+        {
+            NextJob = m_SharedQueue->Dequeue();
+        }
+
+        // Thieves take the oldest (usually largest) chunk of someone else's work
+        int32 Start = WorkerIndex >= 0 ? WorkerIndex : 0;
+        for (int32 Offset = WorkerIndex >= 0 ? 1 : 0; !NextJob && Offset < QueueCount; ++Offset)
+        {
+            NextJob = m_Queues[(Start + Offset) % QueueCount]->Steal();
+        }
+
+        if (!NextJob)
+        {
+            return false;
+        }
+
+        m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+        RunJob(NextJob);
+        return true;
+    }
+
+    void JobSystem::RunJob(Job* InJob)
+    {
+        if (InJob->Function)
+        {
+            MemoryTagScope TagScope(InJob->MemoryTag);
+            InJob->Function();
+        }
+
+        if (InJob->Counter)
+        {
+            InJob->Counter->Release();
+        }
+
+        if (InJob->Task)
+        {
+            CompleteTask(InJob->Task);
+        }
+
+        delete InJob;
+    }
+
+    bool JobSystem::AddSubsequent(const JobHandle& Prerequisite, const JobHandle& Task)
+    {
+        JobTask::Subsequent* Edge = new JobTask::Subsequent{ Task, nullptr };
+        JobTask::Subsequent* Head = Prerequisite->m_Subsequents.load(std::memory_order_acquire);
+        do
+        {
+            if (Head == JobTask::GetClosedMarker())
+            {
+                // Already complete
+                delete Edge;
+                return false;
+            }
+            Edge->Next = Head;
+        }
+        while (!Prerequisite->m_Subsequents.compare_exchange_weak(Head, Edge, std::memory_order_acq_rel, std::memory_order_acquire));
+        return true;
+    }
+
+    void JobSystem::ReleasePrerequisite(const JobHandle& Task)
+    {
+        if (Task->m_PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Schedule(Task);
+        }
+    }
+
+    void JobSystem::Schedule(const JobHandle& Task)
+    {
+        Job* NewJob = new Job();
+        NewJob->Function = std::move(Task->m_Function);
+        NewJob->Task = Task;
+        NewJob->MemoryTag = Task->m_MemoryTag;
+
+        if (Task->m_Thread == EJobThread::GameThread)
+        {
+            if (!m_GameThreadQueue->Enqueue(NewJob))
+            {
+                if (IsGameThread())
+                {
+                    RunJob(NewJob);
+                    return;
+                }
+
+                // The game thread drains every frame, wait for room
+                while (!m_GameThreadQueue->Enqueue(NewJob))
+                {
+                    std::this_thread::yield();
+                }
+            }
+            return;
+        }
+
+        Enqueue(NewJob);
+    }
+
+    void JobSystem::CompleteTask(const JobHandle& Task)
+    {
+        Task->m_bIsComplete.store(true, std::memory_order_release);
+
+        // Closing the list makes late AddSubsequent calls see the task as done
+        JobTask::Subsequent* Head = Task->m_Subsequents.exchange(JobTask::GetClosedMarker(), std::memory_order_acq_rel);
+        while (Head)
+        {
+            JobTask::Subsequent* Next = Head->Next;
+            ReleasePrerequisite(Head->Task);
+            delete Head;
+            Head = Next;
+        }
+    }
+
+    uint64 JobSystem::GetCurrentTick() const
+    {
+        auto Elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_TimerStart).count();
+        return static_cast<uint64>(Elapsed / TimerResolution);
+    }
+
+    uint64 JobSystem::FindNextDeadline() const
+    {
+        // Walk the slots in tick order - the first entry due within its own slot's turn is the
+        // earliest, otherwise everything left is at least a revolution out and the minimum wins
+        uint64 Earliest = std::numeric_limits<uint64>::max();
+        for (uint64 Step = 1; Step <= TimerSlotCount; ++Step)
+        {
+            uint64 Tick = m_CurrentTick + Step;
+            for (const TimerEntry* Entry = m_TimerSlots[Tick & (TimerSlotCount - 1)]; Entry; Entry = Entry->Next)
+            {
+                if (Entry->DeadlineTick <= Tick)
+                {
+                    return Entry->DeadlineTick;
+                }
+                Earliest = std::min(Earliest, Entry->DeadlineTick);
+            }
+        }
+        return Earliest;
+    }
+
+    void JobSystem::ClearTimers()
+    {
+        TArray<JobHandle> Pending;
+        {
+            std::lock_guard<std::mutex> Lock(m_TimerMutex);
+            for (TimerEntry*& Slot : m_TimerSlots)
+            {
+                while (Slot)
+                {
+                    TimerEntry* Next = Slot->Next;
+                    Pending.Add(std::move(Slot->Task));
+                    delete Slot;
+                    Slot = Next;
+                }
+            }
+            m_TimerCount = 0;
+            m_NextDeadlineTick = std::numeric_limits<uint64>::max();
+        }
+
+        // Cut the delay short rather than dropping the task - waiters, continuations and latent
+        // actions would otherwise never finish. Shutdown runs whatever the workers leave behind.
+        for (const JobHandle& Task : Pending)
+        {
+            ReleasePrerequisite(Task);
+        }
+    }
+}
@@ -0,0 +1,228 @@
+/*
+ * UE4 Job System - Self-contained work-stealing worker pool
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+
+namespace UE4SDK
+{
+    // Forward declarations
+    class JobSystem;
+    class JobTask;
+
+    // Task handle - shared by the launcher, waiters and any continuations
+    using JobHandle = std::shared_ptr<JobTask>;
+
+    // Where a task runs once its prerequisites are done
+    enum class EJobThread : uint8
+    {
+        Worker = 0,    // Any pool worker
+        GameThread = 1 // Queued until the game thread calls ProcessGameThreadTasks
+    };
+
+    // Job counter - tracks a batch of dispatched jobs so the caller can wait on it
+    class JobCounter
+    {
+    public:
+        JobCounter() : m_Pending(0) {}
+
+        void Add(int32 Count = 1) { m_Pending.fetch_add(Count, std::memory_order_relaxed); }
+        void Release() { m_Pending.fetch_sub(1, std::memory_order_acq_rel); }
+        bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+        int32 GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+    private:
+        std::atomic<int32> m_Pending;
+    };
+
+    // Job task - a function that runs once every prerequisite has completed, and releases its subsequents when done
+    class JobTask
+    {
+    public:
+        JobTask() : m_Thread(EJobThread::Worker), m_MemoryTag(t_MemoryTag), m_PendingPrerequisites(1), m_Subsequents(nullptr), m_bIsComplete(false) {}
+        ~JobTask();
+
+        bool IsComplete() const { return m_bIsComplete.load(std::memory_order_acquire); }
+        EJobThread GetThread() const { return m_Thread; }
+
+    private:
+        friend class JobSystem;
+
+        struct Subsequent
+        {
+            JobHandle Task;
+            Subsequent* Next;
+        };
+
+        static Subsequent* GetClosedMarker() { return reinterpret_cast<Subsequent*>(static_cast<uintptr_t>(1)); }
+
+        std::function<void()> m_Function;
+        EJobThread m_Thread;
+        EMemoryTag m_MemoryTag;                    // Launcher's tag, the function runs under it
+        std::atomic<int32> m_PendingPrerequisites; // Starts at one, held by Launch until every edge is in
+        std::atomic<Subsequent*> m_Subsequents;    // Lock-free stack, closed once the task completes
+        std::atomic<bool> m_bIsComplete;
+    };
+
+    // Job System - fixed pool of workers, each with a lock-free work-stealing deque.
+    // Owners push and pop at the bottom of their deque, idle workers steal from the top of others.
+    // Threads outside the pool hand work over through a shared MPMC queue.
+    class JobSystem
+    {
+    public:
+        static JobSystem& Get();
+
+        // System state - the thread that initializes the pool becomes the game thread
+        void Initialize(int32 NumWorkers = 0);
+        void Shutdown();
+        bool IsInitialized() const { return m_bIsInitialized; }
+        int32 GetWorkerCount() const { return static_cast<int32>(m_Workers.size()); }
+
+        // Job dispatch
+        void Dispatch(std::function<void()> Job, JobCounter* Counter = nullptr);
+        void Wait(JobCounter& Counter);
+
+        // Splits [0, Count) into batches and runs them across the pool.
+        // The calling thread helps out and returns once every batch is done.
+        void ParallelFor(int32 Count, int32 BatchSize, const std::function<void(int32 Begin, int32 End)>& Body);
+
+        // Task graph - tasks start once every prerequisite is complete, null prerequisites are ignored
+        JobHandle Launch(std::function<void()> Function, const TArray<JobHandle>& Prerequisites = TArray<JobHandle>(), EJobThread Thread = EJobThread::Worker);
+        JobHandle Then(const JobHandle& Prerequisite, std::function<void()> Function, EJobThread Thread = EJobThread::Worker);
+        void Wait(const JobHandle& Task);
+
+        // Delayed tasks - held on a timer wheel with TimerResolution granularity, no thread sleeps per task.
+        // Without a pool, or once Shutdown has started, the delay is skipped.
+        JobHandle LaunchDelayed(float Seconds, std::function<void()> Function, EJobThread Thread = EJobThread::Worker);
+        int32 GetPendingTimerCount() const { return m_TimerCount.load(std::memory_order_acquire); }
+
+        // Game thread queue - drained once per frame (AISystem::Update does it first thing).
+        // MaxTasks of zero runs everything queued; returns how many ran.
+        int32 ProcessGameThreadTasks(int32 MaxTasks = 0);
+        bool IsGameThread() const { return std::this_thread::get_id() == m_GameThreadId; }
+
+        // Worker queries
+        static int32 GetCurrentWorkerIndex();
+        bool IsWorkerThread() const { return GetCurrentWorkerIndex() >= 0; }
+
+        static constexpr float TimerResolution = 0.001f;
+
+    private:
+        JobSystem();
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        struct Job
+        {
+            std::function<void()> Function;
+            JobCounter* Counter = nullptr;
+            JobHandle Task; // Completed after the function runs
+            EMemoryTag MemoryTag = t_MemoryTag; // Allocations in the function are charged to the dispatcher's tag
+        };
+
+        // Chase-Lev deque - only the owning worker pushes and pops, anyone may steal
+        class WorkStealingQueue
+        {
+        public:
+            static constexpr int64 Capacity = 4096;
+
+            WorkStealingQueue();
+            bool Push(Job* InJob);
+            Job* Pop();
+            Job* Steal();
+
+        private:
+            alignas(64) std::atomic<int64> m_Top;
+            alignas(64) std::atomic<int64> m_Bottom;
+            std::atomic<Job*> m_Slots[Capacity];
+        };
+
+        // Bounded MPMC ring - each cell's sequence number says whose turn it is
+        class JobQueue
+        {
+        public:
+            explicit JobQueue(uint32 Capacity);
+            bool Enqueue(Job* InJob);
+            Job* Dequeue();
+
+        private:
+            struct Cell
+            {
+                std::atomic<uint64> Sequence;
+                Job* Data;
+            };
+
+            std::unique_ptr<Cell[]> m_Cells;
+            uint64 m_Mask;
+            alignas(64) std::atomic<uint64> m_EnqueuePos;
+            alignas(64) std::atomic<uint64> m_DequeuePos;
+        };
+
+        struct TimerEntry
+        {
+            JobHandle Task;
+            uint64 DeadlineTick;
+            TimerEntry* Next;
+        };
+
+        static constexpr int32 TimerSlotCount = 512;
+
+        std::vector<std::thread> m_Workers;
+        std::vector<std::unique_ptr<WorkStealingQueue>> m_Queues;
+        std::unique_ptr<JobQueue> m_SharedQueue;
+        std::unique_ptr<JobQueue> m_GameThreadQueue;
+        std::thread::id m_GameThreadId;
+
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+        std::atomic<int32> m_QueuedJobs;
+        std::atomic<int32> m_SleepingWorkers;
+        std::atomic<bool> m_bShuttingDown;
+        std::atomic<bool> m_bIsInitialized;
+        std::mutex m_StateMutex; // Initialize and Shutdown can come from any thread
+
+        // Timer wheel - owned by the timer thread, inserts take the mutex
+        std::thread m_TimerThread;
+        std::mutex m_TimerMutex;
+        std::condition_variable m_TimerCondition;
+        TimerEntry* m_TimerSlots[TimerSlotCount];
+        uint64 m_CurrentTick;
+        uint64 m_NextDeadlineTick; // Earliest pending deadline, the timer thread sleeps until it
+        std::atomic<int32> m_TimerCount;
+        std::chrono::steady_clock::time_point m_TimerStart;
+
+        // Helper functions
+        void WorkerLoop(int32 WorkerIndex);
+        void TimerLoop();
+        void Enqueue(Job* InJob);
+        void WakeWorker();
+        bool TryRunJob(int32 WorkerIndex);
+        void RunJob(Job* InJob);
+
+        bool AddSubsequent(const JobHandle& Prerequisite, const JobHandle& Task);
+        void ReleasePrerequisite(const JobHandle& Task);
+        void Schedule(const JobHandle& Task);
+        void CompleteTask(const JobHandle& Task);
+
+        uint64 GetCurrentTick() const;
+        uint64 FindNextDeadline() const;
+        void ClearTimers();
+
+        static JobSystem* s_Instance;
+    };
+
+    // Global access macros
+    #define JOB_SYSTEM UE4SDK::JobSystem::Get()
+}
@@ -0,0 +1,502 @@
+/*
+ * UE4 Latent Task Implementation - Self-contained coroutine task implementation
+ * Vibe coder approved ✨
+ */
+
+#include "LatentTask.h"
+#include "Navigation.h"
+#include "JobSystem.h"
+#include "Utils.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+
+namespace UE4SDK
+{
+    // CoroutineFramePool implementation
+    CoroutineFramePool* CoroutineFramePool::s_Instance = nullptr;
+
+    CoroutineFramePool& CoroutineFramePool::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(AI);
+            s_Instance = new CoroutineFramePool();
+        }
+        return *s_Instance;
+    }
+
+    CoroutineFramePool::CoroutineFramePool()
+        : m_OversizedAllocations(0)
+    {
+    }
+
+    CoroutineFramePool::~CoroutineFramePool()
+    {
+        for (void* Chunk : m_Chunks)
+        {
+            ::operator delete(Chunk);
+        }
+    }
+
+    void* CoroutineFramePool::Allocate(std::size_t Size)
+    {
+        int32 ClassIndex = GetSizeClass(Size);
+        if (ClassIndex < 0)
+        {
+            std::lock_guard<std::mutex> Lock(m_ChunkMutex);
+            ++m_OversizedAllocations;
+            return ::operator new(Size);
+        }
+
+        SizeClass& Class = m_Classes[ClassIndex];
+        std::lock_guard<std::mutex> Lock(Class.Mutex);
+        if (!Class.FirstFree)
+        {
+            AddChunk(ClassIndex);
+        }
+
+        FreeBlock* Block = Class.FirstFree;
+        Class.FirstFree = Block->Next;
+        --Class.FreeCount;
+        ++Class.InUse;
+        return Block;
+    }
+
+    void CoroutineFramePool::Free(void* Block, std::size_t Size)
+    {
+        if (!Block)
+        {
+            return;
+        }
+
+        int32 ClassIndex = GetSizeClass(Size);
+        if (ClassIndex < 0)
+        {
+            ::operator delete(Block);
+            return;
+        }
+
+        SizeClass& Class = m_Classes[ClassIndex];
+        std::lock_guard<std::mutex> Lock(Class.Mutex);
+        FreeBlock* Freed = static_cast<FreeBlock*>(Block);
+        Freed->Next = Class.FirstFree;
+        Class.FirstFree = Freed;
+        ++Class.FreeCount;
+        --Class.InUse;
+    }
+
+    void CoroutineFramePool::Reserve(std::size_t FrameSize, int32 Count)
+    {
+        int32 ClassIndex = GetSizeClass(FrameSize);
+        if (ClassIndex < 0)
+        {
+            return;
+        }
+
+        SizeClass& Class = m_Classes[ClassIndex];
+        std::lock_guard<std::mutex> Lock(Class.Mutex);
+        while (Class.FreeCount < Count)
+        {
+            AddChunk(ClassIndex);
+        }
+    }
+
+    int32 CoroutineFramePool::GetFramesInUse() const
+    {
+        int32 InUse = 0;
+        for (const SizeClass& Class : m_Classes)
+        {
+            std::lock_guard<std::mutex> Lock(Class.Mutex);
+            InUse += Class.InUse;
+        }
+        return InUse;
+    }
+
+    int32 CoroutineFramePool::GetChunkCount() const
+    {
+        std::lock_guard<std::mutex> Lock(m_ChunkMutex);
+        return m_Chunks.Num();
+    }
+
+    int32 CoroutineFramePool::GetOversizedAllocations() const
+    {
+        std::lock_guard<std::mutex> Lock(m_ChunkMutex);
+        return m_OversizedAllocations;
+    }
+
+    int32 CoroutineFramePool::GetSizeClass(std::size_t Size)
+    {
+        std::size_t BlockSize = MinBlockSize;
+        for (int32 ClassIndex = 0; ClassIndex < SizeClassCount; ++ClassIndex, BlockSize <<= 1)
+        {
+            if (Size <= BlockSize)
+            {
+                return ClassIndex;
+            }
+        }
+        return -1;
+    }
+
+    void CoroutineFramePool::AddChunk(int32 ClassIndex)
+    {
+        std::size_t BlockSize = MinBlockSize << ClassIndex;
+        char* Chunk = static_cast<char*>(::operator new(ChunkSize));
+        {
+            std::lock_guard<std::mutex> Lock(m_ChunkMutex);
+            m_Chunks.Add(Chunk);
+        }
+
+        // Thread the blocks onto the free list back to front so they come out in address order
+        SizeClass& Class = m_Classes[ClassIndex];
+        int32 BlockCount = static_cast<int32>(ChunkSize / BlockSize);
+        for (int32 i = BlockCount - 1; i >= 0; --i)
+        {
+            FreeBlock* Block = reinterpret_cast<FreeBlock*>(Chunk + i * BlockSize);
+            Block->Next = Class.FirstFree;
+            Class.FirstFree = Block;
+        }
+        Class.FreeCount += BlockCount;
+    }
+
+    // LatentPromiseBase implementation
+    std::coroutine_handle<> LatentPromiseBase::OnFinalSuspend() noexcept
+    {
+        if (m_Continuation)
+        {
+            return m_Continuation;
+        }
+
+        // Spawned task - this destroys the frame, nothing here may be touched afterwards
+        LatentTaskManager::Get().Retire(m_OwningTask);
+        return std::noop_coroutine();
+    }
+
+    // LatentTaskManager implementation
+    LatentTaskManager* LatentTaskManager::s_Instance = nullptr;
+
+    LatentTaskManager& LatentTaskManager::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(AI);
+            s_Instance = new LatentTaskManager();
+        }
+        return *s_Instance;
+    }
+
+    LatentTaskManager::LatentTaskManager()
+        : m_FirstFreeSlot(-1)
+        , m_RunningCount(0)
+        , m_NextPathQuery(0)
+        , m_MaxPathQueriesPerFrame(8)
+        , m_FrameNumber(0)
+    {
+    }
+
+    LatentTaskHandle LatentTaskManager::Spawn(TTask<void> Task)
+    {
+        if (!Task.IsValid() || Task.IsDone())
+        {
+            return LatentTaskHandle();
+        }
+
+        int32 Index = m_FirstFreeSlot;
+        if (Index >= 0)
+        {
+            m_FirstFreeSlot = m_Slots[Index].NextFree;
+        }
+        else
+        {
+            Index = m_Slots.Num();
+            m_Slots.Add(TaskSlot());
+        }
+
+        // The slot owns the frame from here on
+        std::coroutine_handle<TLatentPromise<void>> Handle = std::exchange(Task.m_Handle, nullptr);
+        TaskSlot& Slot = m_Slots[Index];
+        Slot.Handle = Handle;
+        Slot.Promise = &Handle.promise();
+        Slot.Serial = 0;
+        Slot.RunDepth = 0;
+        Slot.NextFree = -1;
+        Slot.bActive = true;
+        Slot.bCancelRequested = false;
+        ++m_RunningCount;
+
+        LatentTaskHandle Spawned;
+        Spawned.Index = Index;
+        Spawned.Generation = Slot.Generation;
+        Handle.promise().m_OwningTask = Spawned;
+
+        Run(Spawned, Handle);
+        return Spawned;
+    }
+
+    void LatentTaskManager::Cancel(const LatentTaskHandle& Task)
+    {
+        if (!IsRunning(Task))
+        {
+            return;
+        }
+
+        TaskSlot& Slot = m_Slots[Task.Index];
+        if (Slot.RunDepth > 0)
+        {
+            // Still on the stack - Run tears it down once it suspends
+            Slot.bCancelRequested = true;
+            return;
+        }
+        Destroy(Task.Index);
+    }
+
+    void LatentTaskManager::CancelAll()
+    {
+        for (int32 Index = 0; Index < m_Slots.Num(); ++Index)
+        {
+            if (m_Slots[Index].bActive)
+            {
+                LatentTaskHandle Task;
+                Task.Index = Index;
+                Task.Generation = m_Slots[Index].Generation;
+                Cancel(Task);
+            }
+        }
+
+        m_NextFrame.Empty();
+        m_PathQueries.Empty();
+        m_NextPathQuery = 0;
+    }
+
+    bool LatentTaskManager::IsRunning(const LatentTaskHandle& Task) const
+    {
+        return Task.Index >= 0 && Task.Index < m_Slots.Num() && m_Slots[Task.Index].bActive && m_Slots[Task.Index].Generation == Task.Generation;
+    }
+
+    void LatentTaskManager::ProcessFrame()
+    {
+        PROFILE_SCOPE("LatentTaskManager::ProcessFrame");
+        MEMORY_TAG_SCOPE(AI);
+
+        ++m_FrameNumber;
+
+        // Only wakeups queued before this frame run now, anything awaiting the next frame again waits for the next call
+        std::swap(m_ResumingNow, m_NextFrame);
+        for (const LatentWakeup& Wakeup : m_ResumingNow)
+        {
+            Resume(Wakeup);
+        }
+        m_ResumingNow.Empty();
+
+        // Path queries under the per-frame cap, skipping any whose task has gone away
+        int32 Budget = m_MaxPathQueriesPerFrame;
+        while (Budget > 0 && m_NextPathQuery < m_PathQueries.Num())
+        {
+            // Copy out - resuming may queue more queries and move the array
+            PathQuery Query = m_PathQueries[m_NextPathQuery++];
+            if (!IsCurrent(Query.Wakeup))
+            {
+                continue;
+            }
+
+            *Query.OutPath = Query.System ? Query.System->FindPath(Query.Start, Query.End, Query.Filter)
+                                          : NavigationSystemManager::Get().FindPath(Query.Start, Query.End, Query.Filter);
+            --Budget;
+            Resume(Query.Wakeup);
+        }
+
+        if (m_NextPathQuery >= m_PathQueries.Num())
+        {
+            m_PathQueries.Empty();
+            m_NextPathQuery = 0;
+        }
+    }
+
+    LatentWakeup LatentTaskManager::MakeWakeup(std::coroutine_handle<> Handle, const LatentTaskHandle& Task) const
+    {
+        LatentWakeup Wakeup;
+        Wakeup.Handle = Handle;
+        Wakeup.Task = Task;
+        Wakeup.Serial = IsRunning(Task) ? m_Slots[Task.Index].Serial : 0;
+        return Wakeup;
+    }
+
+    void LatentTaskManager::Resume(const LatentWakeup& Wakeup)
+    {
+        if (!IsCurrent(Wakeup))
+        {
+            return;
+        }
+
+        ++m_Slots[Wakeup.Task.Index].Serial;
+        Run(Wakeup.Task, Wakeup.Handle);
+    }
+
+    void LatentTaskManager::Post(const LatentWakeup& Wakeup)
+    {
+        JobSystem::Get().Launch([Wakeup]() { LatentTaskManager::Get().Resume(Wakeup); }, TArray<JobHandle>(), EJobThread::GameThread);
+    }
+
+    void LatentTaskManager::ResumeNextFrame(const LatentWakeup& Wakeup)
+    {
+        m_NextFrame.Add(Wakeup);
+    }
+
+    void LatentTaskManager::QueuePathQuery(const LatentWakeup& Wakeup, NavigationSystem* System, const FVector& Start, const FVector& End, NavQueryFilter* Filter, NavPath** OutPath)
+    {
+        PathQuery Query;
+        Query.Wakeup = Wakeup;
+        Query.System = System;
+        Query.Start = Start;
+        Query.End = End;
+        Query.Filter = Filter;
+        Query.OutPath = OutPath;
+        m_PathQueries.Add(Query);
+    }
+
+    bool LatentTaskManager::IsCurrent(const LatentWakeup& Wakeup) const
+    {
+        if (!IsRunning(Wakeup.Task))
+        {
+            return false;
+        }
+
+        const TaskSlot& Slot = m_Slots[Wakeup.Task.Index];
+        return !Slot.bCancelRequested && Slot.Serial == Wakeup.Serial;
+    }
+
+    void LatentTaskManager::Run(const LatentTaskHandle& Task, std::coroutine_handle<> Handle)
+    {
+        ++m_Slots[Task.Index].RunDepth;
+        Handle.resume();
+
+        // The task may have finished (and its slot been reused) while it ran
+        if (!IsRunning(Task))
+        {
+            return;
+        }
+
+        TaskSlot& Slot = m_Slots[Task.Index];
+        if (--Slot.RunDepth == 0 && Slot.bCancelRequested)
+        {
+            Destroy(Task.Index);
+        }
+    }
+
+    void LatentTaskManager::Retire(const LatentTaskHandle& Task)
+    {
+        if (!IsRunning(Task))
+        {
+            return;
+        }
+
+        if (m_Slots[Task.Index].Promise->HasException())
+        {
+            Utils::Get().LogError(TEXT("Latent task ended with an unhandled exception"));
+        }
+        Destroy(Task.Index);
+    }
+
+    void LatentTaskManager::Destroy(int32 Index)
+    {
+        // Free the slot first - destroying the frame runs awaiter destructors, which may call back in
+        std::coroutine_handle<> Handle = m_Slots[Index].Handle;
+        TaskSlot& Slot = m_Slots[Index];
+        Slot.Handle = nullptr;
+        Slot.Promise = nullptr;
+        Slot.bActive = false;
+        Slot.bCancelRequested = false;
+        ++Slot.Generation;
+        Slot.NextFree = m_FirstFreeSlot;
+        m_FirstFreeSlot = Index;
+        --m_RunningCount;
+
+        Handle.destroy();
+    }
+
+    // LatentDelayAwaiter implementation
+    void LatentDelayAwaiter::Start(const LatentWakeup& Wakeup) const
+    {
+        JobSystem::Get().LaunchDelayed(Seconds, [Wakeup]() { LatentTaskManager::Get().Resume(Wakeup); }, EJobThread::GameThread);
+    }
+
+    // LatentKeyChangeAwaiter implementation
+    LatentKeyChangeAwaiter::~LatentKeyChangeAwaiter()
+    {
+        if (m_ObserverHandle >= 0)
+        {
+            m_Blackboard->RemoveObserver(m_ObserverHandle);
+        }
+    }
+
+    void LatentKeyChangeAwaiter::Start(const LatentWakeup& Wakeup)
+    {
+        // Blackboards can be written from parallel AI ticks, so the wakeup always goes through the game thread queue.
+        // Extra changes before the resume post stale wakeups, which are dropped.
+        m_ObserverHandle = m_Blackboard->AddObserver(m_KeyName, [Wakeup](const FString&) { LatentTaskManager::Get().Post(Wakeup); });
+    }
+
+    // LatentAITask implementation
+    LatentAITask::LatentAITask()
+        : m_bBodyStarted(false)
+        , m_StartSerial(0)
+        , m_Self(std::make_shared<LatentAITask*>(this))
+    {
+        SetTaskName(TEXT("LatentTask"));
+    }
+
+    LatentAITask::~LatentAITask()
+    {
+        *m_Self = nullptr;
+        LatentTaskManager::Get().Cancel(m_Running);
+    }
+
+    void LatentAITask::ExecuteTask(float DeltaTime)
+    {
+        // Nothing to poll once started - the body completes the task when it returns
+        if (m_bBodyStarted)
+        {
+            return;
+        }
+
+        if (!m_Body)
+        {
+            CompleteTask(false);
+            return;
+        }
+
+        // The manager is game thread only. Game thread jobs run between AI ticks, so nothing below
+        // races the workers.
+        m_bBodyStarted = true;
+        uint32 Serial = ++m_StartSerial;
+        std::shared_ptr<LatentAITask*> Self = m_Self;
+        Utils::RunOnGameThread([Self, Serial]()
+        {
+            LatentAITask* Task = *Self;
+            if (Task && Task->m_StartSerial == Serial)
+            {
+                Task->m_Running = LatentTaskManager::Get().Spawn(RunBody(Task, Task->m_Body()));
+            }
+        });
+    }
+
+    void LatentAITask::StopTask()
+    {
+        ++m_StartSerial;
+        m_bBodyStarted = false;
+
+        LatentTaskHandle Running = m_Running;
+        m_Running = LatentTaskHandle();
+        Utils::RunOnGameThread([Running]() { LatentTaskManager::Get().Cancel(Running); });
+
+        AITask::StopTask();
+    }
+
+    TTask<void> LatentAITask::RunBody(LatentAITask* Task, TTask<bool> Body)
+    {
+        bool bSuccessful = co_await Body;
+        Task->m_Running = LatentTaskHandle();
+        Task->m_bBodyStarted = false;
+        Task->CompleteTask(bSuccessful);
+    }
+}
@@ -0,0 +1,525 @@
+/*
+ * UE4 Latent Task - Self-contained C++20 coroutine tasks for latent AI actions
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "AI.h"
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace UE4SDK
+{
+    // Forward declarations
+    class Blackboard;
+    class NavigationSystem;
+    class NavQueryFilter;
+    class NavPath;
+    class LatentTaskManager;
+
+    // Coroutine frame pool - frames come from fixed size classes carved out of large chunks and go back
+    // on a free list, so starting a task doesn't touch the heap once the pool is warm. Frames bigger than
+    // the largest class fall back to operator new.
+    class CoroutineFramePool
+    {
+    public:
+        static CoroutineFramePool& Get();
+
+        void* Allocate(std::size_t Size);
+        void Free(void* Block, std::size_t Size);
+
+        // Warm up - makes sure Count frames of FrameSize bytes can be handed out without allocating
+        void Reserve(std::size_t FrameSize, int32 Count);
+
+        // Stats
+        int32 GetFramesInUse() const;
+        int32 GetChunkCount() const;
+        int32 GetOversizedAllocations() const;
+
+        static constexpr int32 SizeClassCount = 7; // 64 bytes up to 4 KB
+        static constexpr std::size_t MinBlockSize = 64;
+        static constexpr std::size_t MaxBlockSize = MinBlockSize << (SizeClassCount - 1);
+        static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    private:
+        CoroutineFramePool();
+        ~CoroutineFramePool();
+
+        CoroutineFramePool(const CoroutineFramePool&) = delete;
+        CoroutineFramePool& operator=(const CoroutineFramePool&) = delete;
+
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        struct SizeClass
+        {
+            mutable std::mutex Mutex;
+            FreeBlock* FirstFree = nullptr;
+            int32 FreeCount = 0;
+            int32 InUse = 0;
+        };
+
+        SizeClass m_Classes[SizeClassCount];
+        TArray<void*> m_Chunks;
+        mutable std::mutex m_ChunkMutex;
+        int32 m_OversizedAllocations;
+
+        // Helper functions
+        static int32 GetSizeClass(std::size_t Size);
+        void AddChunk(int32 ClassIndex); // Caller holds the class mutex
+
+        static CoroutineFramePool* s_Instance;
+    };
+
+    // Latent task handle - identifies a spawned task, stays safe to use after the task has finished
+    struct LatentTaskHandle
+    {
+        int32 Index = -1;
+        uint32 Generation = 0;
+
+        bool IsValid() const { return Index >= 0; }
+        bool operator==(const LatentTaskHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    };
+
+    // Wakeup - resumes a suspended coroutine at one particular suspension point. Stale wakeups
+    // (the task moved on, finished or was cancelled) are dropped, so an awaitable never has to unregister in time.
+    struct LatentWakeup
+    {
+        std::coroutine_handle<> Handle;
+        LatentTaskHandle Task;
+        uint32 Serial = 0;
+    };
+
+    // Promise state shared by every TTask
+    class LatentPromiseBase
+    {
+    public:
+        static void* operator new(std::size_t Size) { return CoroutineFramePool::Get().Allocate(Size); }
+        static void operator delete(void* Block, std::size_t Size) { CoroutineFramePool::Get().Free(Block, Size); }
+
+        // Tasks start suspended; they run once spawned or awaited
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        // Hands control back to the awaiting coroutine, or retires a spawned task
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+            void await_resume() const noexcept {}
+
+            template<typename PromiseType>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> Finished) noexcept
+            {
+                return Finished.promise().OnFinalSuspend();
+            }
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void unhandled_exception() { m_Exception = std::current_exception(); }
+
+        const LatentTaskHandle& GetOwningTask() const { return m_OwningTask; }
+        bool HasException() const { return static_cast<bool>(m_Exception); }
+
+    protected:
+        void RethrowIfFailed() const
+        {
+            if (m_Exception)
+            {
+                std::rethrow_exception(m_Exception);
+            }
+        }
+
+    private:
+        template<typename T> friend class TTask;
+        friend class LatentTaskManager;
+
+        std::coroutine_handle<> OnFinalSuspend() noexcept;
+
+        std::coroutine_handle<> m_Continuation; // Awaiting coroutine, empty for spawned tasks
+        LatentTaskHandle m_OwningTask;          // Spawned task this frame runs under
+        std::exception_ptr m_Exception;
+    };
+
+    template<typename T> class TTask;
+
+    template<typename T>
+    class TLatentPromise : public LatentPromiseBase
+    {
+    public:
+        TTask<T> get_return_object() noexcept;
+
+        template<typename ValueType>
+        void return_value(ValueType&& Value) { m_Value.emplace(std::forward<ValueType>(Value)); }
+
+        T TakeResult()
+        {
+            RethrowIfFailed();
+            return std::move(*m_Value);
+        }
+
+    private:
+        std::optional<T> m_Value;
+    };
+
+    template<>
+    class TLatentPromise<void> : public LatentPromiseBase
+    {
+    public:
+        TTask<void> get_return_object() noexcept;
+
+        void return_void() {}
+        void TakeResult() { RethrowIfFailed(); }
+    };
+
+    // Coroutine task - lazily started, move-only. co_await it from another task to run it and get its
+    // result, or hand a TTask<void> to LatentTaskManager::Spawn to run it on its own.
+    // Tasks run on the game thread; every awaitable below resumes them there.
+    template<typename T = void>
+    class TTask
+    {
+    public:
+        using promise_type = TLatentPromise<T>;
+
+        TTask() = default;
+        explicit TTask(std::coroutine_handle<promise_type> Handle) : m_Handle(Handle) {}
+        TTask(TTask&& Other) noexcept : m_Handle(std::exchange(Other.m_Handle, nullptr)) {}
+        TTask& operator=(TTask&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                Reset();
+                m_Handle = std::exchange(Other.m_Handle, nullptr);
+            }
+            return *this;
+        }
+        ~TTask() { Reset(); }
+
+        TTask(const TTask&) = delete;
+        TTask& operator=(const TTask&) = delete;
+
+        bool IsValid() const { return static_cast<bool>(m_Handle); }
+        bool IsDone() const { return m_Handle && m_Handle.done(); }
+
+        // Awaiting - the child runs straight away under the awaiting task
+        bool await_ready() const noexcept { return m_Handle.done(); }
+
+        template<typename PromiseType>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> Awaiting) noexcept
+        {
+            promise_type& Child = m_Handle.promise();
+            Child.m_Continuation = Awaiting;
+            Child.m_OwningTask = Awaiting.promise().GetOwningTask();
+            return m_Handle;
+        }
+
+        T await_resume() { return m_Handle.promise().TakeResult(); }
+
+    private:
+        friend class LatentTaskManager;
+
+        void Reset()
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+                m_Handle = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> m_Handle;
+    };
+
+    template<typename T>
+    TTask<T> TLatentPromise<T>::get_return_object() noexcept
+    {
+        return TTask<T>(std::coroutine_handle<TLatentPromise<T>>::from_promise(*this));
+    }
+
+    inline TTask<void> TLatentPromise<void>::get_return_object() noexcept
+    {
+        return TTask<void>(std::coroutine_handle<TLatentPromise<void>>::from_promise(*this));
+    }
+
+    // Latent Task Manager - owns spawned tasks and resumes them on the game thread
+    class LatentTaskManager
+    {
+    public:
+        static LatentTaskManager& Get();
+
+        // Spawning - the task starts running before Spawn returns. Game thread only.
+        LatentTaskHandle Spawn(TTask<void> Task);
+
+        // Cancelling destroys the task's frames at their current suspension point, awaitables clean up
+        // in their destructors. A task cancelling itself is torn down once it next suspends.
+        void Cancel(const LatentTaskHandle& Task);
+        void CancelAll();
+        bool IsRunning(const LatentTaskHandle& Task) const;
+        int32 GetRunningCount() const { return m_RunningCount; }
+
+        // Path queries - run on the game thread during ProcessFrame, a few per frame, round-robin by request order
+        void SetMaxPathQueriesPerFrame(int32 MaxQueries) { m_MaxPathQueriesPerFrame = MaxQueries; }
+        int32 GetMaxPathQueriesPerFrame() const { return m_MaxPathQueriesPerFrame; }
+        int32 GetPendingPathQueryCount() const { return m_PathQueries.Num() - m_NextPathQuery; }
+
+        // Called once per AI frame on the game thread, after the job system's game thread queue is drained
+        void ProcessFrame();
+        uint64 GetFrameNumber() const { return m_FrameNumber; }
+
+        // Awaitable plumbing
+        template<typename PromiseType>
+        LatentWakeup MakeWakeup(std::coroutine_handle<PromiseType> Handle) const
+        {
+            return MakeWakeup(Handle, Handle.promise().GetOwningTask());
+        }
+        LatentWakeup MakeWakeup(std::coroutine_handle<> Handle, const LatentTaskHandle& Task) const;
+        void Resume(const LatentWakeup& Wakeup);     // Game thread only
+        void Post(const LatentWakeup& Wakeup);       // Any thread, resumes at the next game thread drain
+        void ResumeNextFrame(const LatentWakeup& Wakeup);
+        void QueuePathQuery(const LatentWakeup& Wakeup, NavigationSystem* System, const FVector& Start, const FVector& End, NavQueryFilter* Filter, NavPath** OutPath);
+
+    private:
+        LatentTaskManager();
+        ~LatentTaskManager() = default;
+
+        LatentTaskManager(const LatentTaskManager&) = delete;
+        LatentTaskManager& operator=(const LatentTaskManager&) = delete;
+
+        friend class LatentPromiseBase;
+
+        struct TaskSlot
+        {
+            std::coroutine_handle<> Handle; // Outermost frame
+            LatentPromiseBase* Promise = nullptr;
+            uint32 Generation = 0;
+            uint32 Serial = 0; // Bumped on every resume, wakeups carry the value they expect
+            int32 RunDepth = 0;
+            int32 NextFree = -1;
+            bool bActive = false;
+            bool bCancelRequested = false;
+        };
+
+        struct PathQuery
+        {
+            LatentWakeup Wakeup;
+            NavigationSystem* System;
+            FVector Start;
+            FVector End;
+            NavQueryFilter* Filter;
+            NavPath** OutPath;
+        };
+
+        TArray<TaskSlot> m_Slots;
+        int32 m_FirstFreeSlot;
+        int32 m_RunningCount;
+
+        TArray<LatentWakeup> m_NextFrame;
+        TArray<LatentWakeup> m_ResumingNow; // Kept around so frames don't reallocate
+        TArray<PathQuery> m_PathQueries;
+        int32 m_NextPathQuery;
+        int32 m_MaxPathQueriesPerFrame;
+        uint64 m_FrameNumber;
+
+        // Helper functions
+        bool IsCurrent(const LatentWakeup& Wakeup) const;
+        void Run(const LatentTaskHandle& Task, std::coroutine_handle<> Handle);
+        void Retire(const LatentTaskHandle& Task);
+        void Destroy(int32 Index);
+
+        static LatentTaskManager* s_Instance;
+    };
+
+    // Awaitables - co_await these from a TTask
+    struct LatentNextFrameAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_resume() const noexcept {}
+
+        template<typename PromiseType>
+        void await_suspend(std::coroutine_handle<PromiseType> Handle) const
+        {
+            LatentTaskManager& Manager = LatentTaskManager::Get();
+            Manager.ResumeNextFrame(Manager.MakeWakeup(Handle));
+        }
+    };
+
+    // Delays sit on the job system's timer wheel and resume at the next game thread drain after they expire
+    struct LatentDelayAwaiter
+    {
+        float Seconds;
+
+        bool await_ready() const noexcept { return Seconds <= 0.0f; }
+        void await_resume() const noexcept {}
+
+        template<typename PromiseType>
+        void await_suspend(std::coroutine_handle<PromiseType> Handle) const
+        {
+            Start(LatentTaskManager::Get().MakeWakeup(Handle));
+        }
+
+        void Start(const LatentWakeup& Wakeup) const;
+    };
+
+    // Path query - resumes with the path (or null) once the manager gets to it, see SetMaxPathQueriesPerFrame
+    struct LatentPathQueryAwaiter
+    {
+        NavigationSystem* System; // Null uses the default navigation system
+        FVector Start;
+        FVector End;
+        NavQueryFilter* Filter;
+        NavPath* Result = nullptr;
+
+        bool await_ready() const noexcept { return false; }
+        NavPath* await_resume() const noexcept { return Result; }
+
+        template<typename PromiseType>
+        void await_suspend(std::coroutine_handle<PromiseType> Handle)
+        {
+            LatentTaskManager& Manager = LatentTaskManager::Get();
+            Manager.QueuePathQuery(Manager.MakeWakeup(Handle), System, Start, End, Filter, &Result);
+        }
+    };
+
+    // Blackboard key change - resumes after the key's value next changes; the observer is removed again
+    // when the await finishes or the task is cancelled
+    class LatentKeyChangeAwaiter
+    {
+    public:
+        LatentKeyChangeAwaiter(Blackboard* InBlackboard, const FString& KeyName) : m_Blackboard(InBlackboard), m_KeyName(KeyName), m_ObserverHandle(-1) {}
+        ~LatentKeyChangeAwaiter();
+
+        LatentKeyChangeAwaiter(const LatentKeyChangeAwaiter&) = delete;
+        LatentKeyChangeAwaiter& operator=(const LatentKeyChangeAwaiter&) = delete;
+
+        bool await_ready() const noexcept { return m_Blackboard == nullptr; }
+        void await_resume() const noexcept {}
+
+        template<typename PromiseType>
+        void await_suspend(std::coroutine_handle<PromiseType> Handle)
+        {
+            Start(LatentTaskManager::Get().MakeWakeup(Handle));
+        }
+
+    private:
+        Blackboard* m_Blackboard;
+        FString m_KeyName;
+        int32 m_ObserverHandle;
+
+        void Start(const LatentWakeup& Wakeup);
+    };
+
+    // Latent response - a one-shot result filled in from any thread by whatever gets the reply, such as an
+    // RPC or request handler. Copies share the same state; the first SetValue wins and one task may await it.
+    template<typename T>
+    class TLatentResponse
+    {
+    public:
+        TLatentResponse() : m_State(std::make_shared<State>()) {}
+
+        void SetValue(T Value) const
+        {
+            LatentWakeup Waiter;
+            bool bHasWaiter;
+            {
+                std::lock_guard<std::mutex> Lock(m_State->Mutex);
+                if (m_State->Value.has_value())
+                {
+                    return;
+                }
+                m_State->Value.emplace(std::move(Value));
+                Waiter = m_State->Waiter;
+                bHasWaiter = m_State->bHasWaiter;
+            }
+
+            if (bHasWaiter)
+            {
+                LatentTaskManager::Get().Post(Waiter);
+            }
+        }
+
+        bool IsReady() const
+        {
+            std::lock_guard<std::mutex> Lock(m_State->Mutex);
+            return m_State->Value.has_value();
+        }
+
+        // Awaiting
+        bool await_ready() const { return IsReady(); }
+
+        template<typename PromiseType>
+        bool await_suspend(std::coroutine_handle<PromiseType> Handle) const
+        {
+            LatentWakeup Wakeup = LatentTaskManager::Get().MakeWakeup(Handle);
+            std::lock_guard<std::mutex> Lock(m_State->Mutex);
+            if (m_State->Value.has_value())
+            {
+                return false; // Arrived in the meantime, carry on without suspending
+            }
+            m_State->Waiter = Wakeup;
+            m_State->bHasWaiter = true;
+            return true;
+        }
+
+        T await_resume() const
+        {
+            std::lock_guard<std::mutex> Lock(m_State->Mutex);
+            return *m_State->Value;
+        }
+
+    private:
+        struct State
+        {
+            std::mutex Mutex;
+            std::optional<T> Value;
+            LatentWakeup Waiter;
+            bool bHasWaiter = false;
+        };
+
+        std::shared_ptr<State> m_State;
+    };
+
+    inline LatentNextFrameAwaiter LatentNextFrame() { return LatentNextFrameAwaiter(); }
+    inline LatentDelayAwaiter LatentDelay(float Seconds) { return LatentDelayAwaiter{ Seconds }; }
+    inline LatentPathQueryAwaiter LatentFindPath(const FVector& Start, const FVector& End, NavQueryFilter* Filter = nullptr, NavigationSystem* System = nullptr)
+    {
+        return LatentPathQueryAwaiter{ System, Start, End, Filter };
+    }
+    inline LatentKeyChangeAwaiter LatentWaitForKeyChange(Blackboard* InBlackboard, const FString& KeyName) { return LatentKeyChangeAwaiter(InBlackboard, KeyName); }
+
+    // Latent AI task - a behavior tree task whose body is a coroutine. The body starts when the task does,
+    // and its result completes the task; stopping the task cancels the body.
+    // Controllers may tick on job system workers, so the body is spawned and cancelled through the game thread
+    // queue unless the task is already ticking there.
+    class LatentAITask : public AITask
+    {
+    public:
+        LatentAITask();
+        virtual ~LatentAITask(); // Game thread only
+
+        void SetBody(std::function<TTask<bool>()> Body) { m_Body = std::move(Body); }
+        bool IsBodyRunning() const { return LatentTaskManager::Get().IsRunning(m_Running); } // Game thread only
+
+        // Task execution
+        virtual void ExecuteTask(float DeltaTime) override;
+        virtual void StopTask() override;
+
+    private:
+        std::function<TTask<bool>()> m_Body;
+        LatentTaskHandle m_Running;
+        bool m_bBodyStarted;                   // Start requested, cleared when the body returns or the task stops
+        uint32 m_StartSerial;                  // Bumped by StopTask so a start still in the queue is dropped
+        std::shared_ptr<LatentAITask*> m_Self; // Queued starts hold this, cleared when the task is destroyed
+
+        static TTask<void> RunBody(LatentAITask* Task, TTask<bool> Body);
+    };
+
+    // Global access macros
+    #define LATENT_TASK_MANAGER UE4SDK::LatentTaskManager::Get()
+}
@@ -0,0 +1,494 @@
+/*
+ * UE4 Logging Implementation - Self-contained asynchronous logging backend implementation
+ * Vibe coder approved ✨
+ */
+
+#include "Logging.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // Records the writer takes per pass before checking for stop and flushing the sinks
+        const int32 WriterBatchSize = 256;
+
+        // Writer sleep when the ring is empty - bounds the delay between a log call and the sinks
+        const std::chrono::microseconds WriterIdleSleep(500);
+
+        std::atomic<uint32> NextThreadId(0);
+        thread_local uint32 t_ThreadId = ~0u;
+
+        void ShutdownLogAtExit()
+        {
+            LogSystem::Get().Shutdown();
+        }
+    }
+
+    const char* GetLogVerbosityName(ELogVerbosity Verbosity)
+    {
+        switch (Verbosity)
+        {
+            case ELogVerbosity::NoLogging: return "NoLogging";
+            case ELogVerbosity::Fatal: return "Fatal";
+            case ELogVerbosity::Error: return "Error";
+            case ELogVerbosity::Warning: return "Warning";
+            case ELogVerbosity::Display: return "Display";
+            case ELogVerbosity::Log: return "Log";
+            case ELogVerbosity::Verbose: return "Verbose";
+            case ELogVerbosity::VeryVerbose: return "VeryVerbose";
+        }
+        return "Log";
+    }
+
+    // StdoutLogSink implementation
+    void StdoutLogSink::Write(const LogRecord& Record)
+    {
+        std::fprintf(stdout, "[%s] %.*s\n", GetLogVerbosityName(Record.Verbosity), Record.Length, Record.Text);
+    }
+
+    void StdoutLogSink::Flush()
+    {
+        std::fflush(stdout);
+    }
+
+    // FileLogSink implementation
+    FileLogSink::FileLogSink(const FString& FilePath, int64 MaxBytes, int32 MaxFiles)
+        : m_FilePath(FilePath)
+        , m_MaxBytes(std::max<int64>(1024, MaxBytes))
+        , m_MaxFiles(std::max(0, MaxFiles))
+        , m_File(nullptr)
+        , m_Size(0)
+    {
+        Open();
+    }
+
+    FileLogSink::~FileLogSink()
+    {
+        if (m_File)
+        {
+            std::fclose(m_File);
+        }
+    }
+
+    void FileLogSink::Write(const LogRecord& Record)
+    {
+        if (!m_File)
+        {
+            return;
+        }
+
+        if (m_Size + Record.Length + 64 > m_MaxBytes)
+        {
+            Rotate();
+            if (!m_File)
+            {
+                return;
+            }
+        }
+
+        int Written = std::fprintf(m_File, "[%10.4f][%3u][%s] %.*s\n", Record.Seconds, Record.ThreadId, GetLogVerbosityName(Record.Verbosity), Record.Length, Record.Text);
+        if (Written > 0)
+        {
+            m_Size += Written;
+        }
+    }
+
+    void FileLogSink::Flush()
+    {
+        if (m_File)
+        {
+            std::fflush(m_File);
+        }
+    }
+
+    void FileLogSink::Open()
+    {
+        // Appends to what a previous run left, and rotates on the first write if that's already full
+        m_File = std::fopen(m_FilePath.c_str(), "ab");
+        if (!m_File)
+        {
+            std::fprintf(stderr, "[Error] FileLogSink: can't open %s\n", m_FilePath.c_str());
+            return;
+        }
+
+        std::fseek(m_File, 0, SEEK_END);
+        long Position = std::ftell(m_File);
+        m_Size = Position > 0 ? Position : 0;
+    }
+
+    void FileLogSink::Rotate()
+    {
+        if (m_File)
+        {
+            std::fclose(m_File);
+            m_File = nullptr;
+        }
+
+        std::error_code Error;
+        std::string Base = m_FilePath.c_str();
+        if (m_MaxFiles == 0)
+        {
+            std::filesystem::remove(Base, Error);
+        }
+        else
+        {
+            std::filesystem::remove(Base + "." + std::to_string(m_MaxFiles), Error);
+            for (int32 i = m_MaxFiles - 1; i >= 1; --i)
+            {
+                std::filesystem::rename(Base + "." + std::to_string(i), Base + "." + std::to_string(i + 1), Error);
+            }
+            std::filesystem::rename(Base, Base + ".1", Error);
+        }
+
+        Open();
+    }
+
+    // LogSystem implementation
+    std::atomic<uint8> LogSystem::s_Verbosity(static_cast<uint8>(ELogVerbosity::Log));
+    LogSystem* LogSystem::s_Instance = nullptr;
+
+    LogSystem& LogSystem::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(Diagnostics);
+            s_Instance = new LogSystem();
+        }
+        return *s_Instance;
+    }
+
+    LogSystem::LogSystem()
+        : m_Slots(new LogSlot[QueueCapacity])
+        , m_EnqueuePosition(0)
+        , m_DequeuePosition(0)
+        , m_Dropped(0)
+        , m_Written(0)
+        , m_bAsync(true)
+        , m_bWriterRunning(false)
+        , m_bStopWriter(false)
+        , m_ReportedDropped(0)
+        , m_StartTimestamp(GetTimestamp())
+    {
+        static_assert((QueueCapacity & (QueueCapacity - 1)) == 0, "QueueCapacity must be a power of two");
+        static_assert(sizeof(LogSlot) == SlotSize, "LogSlot header grew past 64 bytes");
+
+        for (int32 i = 0; i < QueueCapacity; ++i)
+        {
+            m_Slots[i].Sequence.store(static_cast<uint64>(i), std::memory_order_relaxed);
+            m_Slots[i].HeapText = nullptr;
+        }
+
+        m_Sinks.Add(std::make_shared<StdoutLogSink>());
+    }
+
+    void LogSystem::Log(ELogVerbosity Verbosity, const char* Message, int32 Length)
+    {
+        if (!IsEnabled(Verbosity))
+        {
+            return;
+        }
+
+        Length = std::max(0, Length);
+        uint64 Position;
+        LogSlot* Slot = IsAsync() && EnsureWriter() ? ClaimSlot(Verbosity, Position) : nullptr;
+        if (!Slot)
+        {
+            if (!IsAsync() || !m_bWriterRunning.load(std::memory_order_acquire))
+            {
+                WriteSynchronous(Verbosity, Message, Length);
+            }
+            return;
+        }
+
+        if (Length <= PayloadSize)
+        {
+            FillHeader(*Slot, Verbosity, ESlotKind::Text);
+            std::memcpy(Slot->Payload, Message, static_cast<std::size_t>(Length));
+        }
+        else
+        {
+            FillHeader(*Slot, Verbosity, ESlotKind::HeapText);
+            Slot->HeapText = new std::string(Message, static_cast<std::size_t>(Length));
+        }
+        Slot->Length = Length;
+        PublishSlot(*Slot, Position);
+
+        // Fatal means the process is about to go down - get it out now
+        if (Verbosity == ELogVerbosity::Fatal)
+        {
+            Flush();
+        }
+    }
+
+    LogSystem::LogSlot* LogSystem::ClaimSlot(ELogVerbosity Verbosity, uint64& OutPosition)
+    {
+        bool bWaitForSpace = Verbosity <= ELogVerbosity::Warning;
+        uint64 Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            LogSlot& Slot = m_Slots[Position & (QueueCapacity - 1)];
+            uint64 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+            int64 Difference = static_cast<int64>(Sequence - Position);
+
+            if (Difference == 0)
+            {
+                if (m_EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                {
+                    OutPosition = Position;
+                    return &Slot;
+                }
+            }
+            else if (Difference < 0)
+            {
+                // Full - the writer hasn't freed this slot from the previous lap yet
+                if (!bWaitForSpace || !m_bWriterRunning.load(std::memory_order_acquire))
+                {
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+                std::this_thread::yield();
+                Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void LogSystem::PublishSlot(LogSlot& Slot, uint64 Position)
+    {
+        Slot.Sequence.store(Position + 1);
+
+        // Claimed just as the writer stopped - nobody else will pick it up, so write it from here.
+        // Both sides are sequentially consistent, so either the writer's last pass saw this slot or this load sees the stop.
+        if (!m_bWriterRunning.load())
+        {
+            DrainQueue();
+        }
+    }
+
+    void LogSystem::FillHeader(LogSlot& Slot, ELogVerbosity Verbosity, ESlotKind Kind)
+    {
+        Slot.Verbosity = Verbosity;
+        Slot.Kind = Kind;
+        Slot.ThreadId = GetThreadId();
+        Slot.Length = 0;
+        Slot.Timestamp = GetTimestamp();
+        Slot.Formatter = nullptr;
+        Slot.Format = nullptr;
+    }
+
+    bool LogSystem::EnsureWriter()
+    {
+        if (m_bWriterRunning.load(std::memory_order_acquire))
+        {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> Lock(m_WriterMutex);
+        if (!m_bWriterRunning.load(std::memory_order_relaxed) && m_bAsync.load(std::memory_order_relaxed))
+        {
+            static bool bRegisteredAtExit = false;
+            if (!bRegisteredAtExit)
+            {
+                // Whatever is still queued when main returns gets written
+                std::atexit(&ShutdownLogAtExit);
+                bRegisteredAtExit = true;
+            }
+
+            m_bStopWriter.store(false, std::memory_order_relaxed);
+            m_Writer = std::thread([this]() { WriterLoop(); });
+            m_bWriterRunning.store(true, std::memory_order_release);
+        }
+        return m_bWriterRunning.load(std::memory_order_relaxed);
+    }
+
+    void LogSystem::WriterLoop()
+    {
+        while (!m_bStopWriter.load(std::memory_order_acquire))
+        {
+            if (DrainQueue() == 0)
+            {
+                std::this_thread::sleep_for(WriterIdleSleep);
+            }
+        }
+
+        // Stop is only requested after producers were switched to synchronous writes, so this is the last of it
+        while (DrainQueue() > 0)
+        {
+        }
+    }
+
+    int32 LogSystem::DrainQueue()
+    {
+        std::lock_guard<std::mutex> Lock(m_SinkMutex);
+        uint64 Position = m_DequeuePosition.load(std::memory_order_relaxed);
+        int32 Count = 0;
+        char Formatted[MaxFormattedLength];
+
+        while (Count < WriterBatchSize)
+        {
+            LogSlot& Slot = m_Slots[Position & (QueueCapacity - 1)];
+            if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+            {
+                break;
+            }
+
+            switch (Slot.Kind)
+            {
+                case ESlotKind::Text:
+                    WriteRecord(Slot.Verbosity, Slot.ThreadId, Slot.Timestamp, reinterpret_cast<const char*>(Slot.Payload), Slot.Length);
+                    break;
+                case ESlotKind::HeapText:
+                    WriteRecord(Slot.Verbosity, Slot.ThreadId, Slot.Timestamp, Slot.HeapText->data(), static_cast<int32>(Slot.HeapText->size()));
+                    delete Slot.HeapText;
+                    Slot.HeapText = nullptr;
+                    break;
+                case ESlotKind::Deferred:
+                {
+                    int32 Length = Slot.Formatter(Formatted, sizeof(Formatted), Slot.Format, Slot.Payload);
+                    WriteRecord(Slot.Verbosity, Slot.ThreadId, Slot.Timestamp, Formatted, Length);
+                    break;
+                }
+            }
+
+            // Hand the slot to the producer one lap ahead
+            Slot.Sequence.store(Position + QueueCapacity, std::memory_order_release);
+            ++Position;
+            ++Count;
+            m_DequeuePosition.store(Position, std::memory_order_release);
+        }
+
+        int64 Dropped = m_Dropped.load(std::memory_order_relaxed);
+        if (Dropped != m_ReportedDropped)
+        {
+            char Line[96];
+            int32 Length = std::snprintf(Line, sizeof(Line), "Log: %lld messages dropped, the queue was full", static_cast<long long>(Dropped - m_ReportedDropped));
+            WriteRecord(ELogVerbosity::Warning, GetThreadId(), GetTimestamp(), Line, Length);
+            m_ReportedDropped = Dropped;
+            ++Count;
+        }
+
+        // Sinks buffer within a batch and flush once the ring is empty
+        if (Count > 0 && Count < WriterBatchSize)
+        {
+            for (const std::shared_ptr<LogSink>& Sink : m_Sinks)
+            {
+                Sink->Flush();
+            }
+        }
+        return Count;
+    }
+
+    void LogSystem::WriteRecord(ELogVerbosity Verbosity, uint32 ThreadId, int64 Timestamp, const char* Text, int32 Length)
+    {
+        LogRecord Record;
+        Record.Verbosity = Verbosity;
+        Record.ThreadId = ThreadId;
+        Record.Seconds = static_cast<double>(Timestamp - m_StartTimestamp) * 1e-9;
+        Record.Text = Text;
+        Record.Length = Length;
+
+        for (const std::shared_ptr<LogSink>& Sink : m_Sinks)
+        {
+            Sink->Write(Record);
+        }
+        m_Written.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void LogSystem::WriteSynchronous(ELogVerbosity Verbosity, const char* Text, int32 Length)
+    {
+        std::lock_guard<std::mutex> Lock(m_SinkMutex);
+        WriteRecord(Verbosity, GetThreadId(), GetTimestamp(), Text, Length);
+        for (const std::shared_ptr<LogSink>& Sink : m_Sinks)
+        {
+            Sink->Flush();
+        }
+    }
+
+    void LogSystem::SetAsync(bool bAsync)
+    {
+        if (!bAsync)
+        {
+            Shutdown();
+        }
+        m_bAsync.store(bAsync, std::memory_order_relaxed);
+    }
+
+    void LogSystem::Flush()
+    {
+        uint64 Target = m_EnqueuePosition.load(std::memory_order_acquire);
+        while (m_bWriterRunning.load(std::memory_order_acquire) && m_DequeuePosition.load(std::memory_order_acquire) < Target)
+        {
+            std::this_thread::yield();
+        }
+
+        std::lock_guard<std::mutex> Lock(m_SinkMutex);
+        for (const std::shared_ptr<LogSink>& Sink : m_Sinks)
+        {
+            Sink->Flush();
+        }
+    }
+
+    void LogSystem::Shutdown()
+    {
+        std::lock_guard<std::mutex> Lock(m_WriterMutex);
+        if (!m_bWriterRunning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // New messages go synchronous from here; the writer finishes whatever was claimed before
+        m_bAsync.store(false, std::memory_order_relaxed);
+        m_bWriterRunning.store(false);
+        m_bStopWriter.store(true, std::memory_order_release);
+        if (m_Writer.joinable())
+        {
+            m_Writer.join();
+        }
+    }
+
+    void LogSystem::AddSink(std::shared_ptr<LogSink> Sink)
+    {
+        if (!Sink)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> Lock(m_SinkMutex);
+        m_Sinks.Add(Sink);
+    }
+
+    void LogSystem::RemoveSink(const std::shared_ptr<LogSink>& Sink)
+    {
+        std::lock_guard<std::mutex> Lock(m_SinkMutex);
+        m_Sinks.Remove(Sink);
+    }
+
+    void LogSystem::ClearSinks()
+    {
+        std::lock_guard<std::mutex> Lock(m_SinkMutex);
+        m_Sinks.Empty();
+    }
+
+    uint32 LogSystem::GetThreadId()
+    {
+        if (t_ThreadId == ~0u)
+        {
+            t_ThreadId = NextThreadId.fetch_add(1, std::memory_order_relaxed);
+        }
+        return t_ThreadId;
+    }
+
+    int64 LogSystem::GetTimestamp()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
@@ -0,0 +1,260 @@
+/*
+ * UE4 Logging - Self-contained asynchronous logging backend
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+// Messages above this verbosity are compiled out of the LOG_ macros entirely.
+// Defaults to Log in NDEBUG builds and VeryVerbose otherwise.
+#ifndef UE4SDK_COMPILED_LOG_VERBOSITY
+    #ifdef NDEBUG
+        #define UE4SDK_COMPILED_LOG_VERBOSITY 5
+    #else
+        #define UE4SDK_COMPILED_LOG_VERBOSITY 7
+    #endif
+#endif
+
+namespace UE4SDK
+{
+    const char* GetLogVerbosityName(ELogVerbosity Verbosity);
+
+    // One finished message, as handed to the sinks
+    struct LogRecord
+    {
+        ELogVerbosity Verbosity;
+        uint32 ThreadId;     // Small sequential ID, not the OS thread ID
+        double Seconds;      // Since the log system started
+        const char* Text;    // Not null terminated
+        int32 Length;
+    };
+
+    // Sinks run on the writer thread only, one record at a time
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+        virtual void Write(const LogRecord& Record) = 0;
+        virtual void Flush() {}
+    };
+
+    // "[Verbosity] Message" on stdout, the format Utils::Log always used
+    class StdoutLogSink : public LogSink
+    {
+    public:
+        void Write(const LogRecord& Record) override;
+        void Flush() override;
+    };
+
+    // Timestamped lines in a file. Past MaxBytes the file rolls to Path.1, Path.1 to Path.2 and so on,
+    // keeping MaxFiles old files.
+    class FileLogSink : public LogSink
+    {
+    public:
+        FileLogSink(const FString& FilePath, int64 MaxBytes = 16 * 1024 * 1024, int32 MaxFiles = 5);
+        ~FileLogSink() override;
+
+        bool IsOpen() const { return m_File != nullptr; }
+        void Write(const LogRecord& Record) override;
+        void Flush() override;
+
+    private:
+        FString m_FilePath;
+        int64 m_MaxBytes;
+        int32 m_MaxFiles;
+        std::FILE* m_File;
+        int64 m_Size;
+
+        void Open();
+        void Rotate();
+    };
+
+    // Deferred formatter - rebuilds the argument tuple from the slot and runs snprintf on the writer thread
+    using LogFormatFunction = int32 (*)(char* Out, int32 OutSize, const char* Format, const void* Arguments);
+
+    // LogSystem - messages go into a bounded lock-free MPSC ring and a background thread formats
+    // and writes them. Producers never lock; a full ring drops Log and below, and makes Warning and
+    // above wait for space. Without the writer thread (SetAsync(false) or after Shutdown) messages
+    // are written on the calling thread.
+    class LogSystem
+    {
+    public:
+        static constexpr int32 QueueCapacity = 4096;  // Slots, a power of two
+        static constexpr int32 SlotSize = 256;
+        static constexpr int32 MaxFormattedLength = 4096;
+
+        static LogSystem& Get();
+
+        // Filtering - with a constant verbosity the compile-time half folds away
+        static bool IsEnabled(ELogVerbosity Verbosity)
+        {
+            uint8 Level = static_cast<uint8>(Verbosity);
+            return Level <= UE4SDK_COMPILED_LOG_VERBOSITY && Level <= s_Verbosity.load(std::memory_order_relaxed);
+        }
+
+        static void SetVerbosity(ELogVerbosity Verbosity) { s_Verbosity.store(static_cast<uint8>(Verbosity), std::memory_order_relaxed); }
+        static ELogVerbosity GetVerbosity() { return static_cast<ELogVerbosity>(s_Verbosity.load(std::memory_order_relaxed)); }
+
+        // Logging - filtered messages cost one compare
+        void Log(ELogVerbosity Verbosity, const FString& Message) { Log(Verbosity, Message.c_str(), static_cast<int32>(Message.Len())); }
+        void Log(ELogVerbosity Verbosity, const char* Message, int32 Length);
+
+        // Deferred formatting - only the format pointer and the raw arguments are copied on the calling
+        // thread. The format and any const char* arguments must outlive the write (string literals).
+        template<typename... ArgTypes>
+        void LogDeferred(ELogVerbosity Verbosity, const char* Format, ArgTypes&&... Arguments);
+
+        // Writer thread
+        void SetAsync(bool bAsync);
+        bool IsAsync() const { return m_bAsync.load(std::memory_order_relaxed); }
+        void Flush();    // Returns once everything logged before the call has reached the sinks
+        void Shutdown(); // Flushes and stops the writer, later messages are written synchronously
+
+        // Sinks - stdout is installed by default
+        void AddSink(std::shared_ptr<LogSink> Sink);
+        void RemoveSink(const std::shared_ptr<LogSink>& Sink);
+        void ClearSinks();
+
+        // Stats
+        int64 GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+        int64 GetWrittenCount() const { return m_Written.load(std::memory_order_relaxed); }
+
+    private:
+        LogSystem();
+        ~LogSystem() = default;
+
+        LogSystem(const LogSystem&) = delete;
+        LogSystem& operator=(const LogSystem&) = delete;
+
+        enum class ESlotKind : uint8
+        {
+            Text,      // Message bytes in the payload
+            HeapText,  // Too long for the payload, the slot owns a heap copy
+            Deferred   // Format pointer plus argument tuple
+        };
+
+        struct alignas(64) LogSlot
+        {
+            std::atomic<uint64> Sequence;
+            ELogVerbosity Verbosity;
+            ESlotKind Kind;
+            uint32 ThreadId;
+            int32 Length;
+            int64 Timestamp;
+            LogFormatFunction Formatter;
+            const char* Format;
+            std::string* HeapText;
+            alignas(16) unsigned char Payload[SlotSize - 64];
+        };
+
+        static constexpr int32 PayloadSize = SlotSize - 64;
+
+        // Ring - Vyukov bounded queue, slot sequence numbers tell producers and the writer whose turn it is
+        std::unique_ptr<LogSlot[]> m_Slots;
+        alignas(64) std::atomic<uint64> m_EnqueuePosition;
+        alignas(64) std::atomic<uint64> m_DequeuePosition; // Written under m_SinkMutex only
+        std::atomic<int64> m_Dropped;
+        std::atomic<int64> m_Written;
+
+        // Writer - every dequeue happens under m_SinkMutex, so a producer can drain when the writer is gone
+        std::atomic<bool> m_bAsync;
+        std::atomic<bool> m_bWriterRunning;
+        std::atomic<bool> m_bStopWriter;
+        std::mutex m_WriterMutex; // Start/stop only
+        std::thread m_Writer;
+        int64 m_ReportedDropped;
+
+        // Sinks - the writer holds this while it writes a batch
+        std::mutex m_SinkMutex;
+        TArray<std::shared_ptr<LogSink>> m_Sinks;
+        int64 m_StartTimestamp;
+
+        // Helper functions
+        LogSlot* ClaimSlot(ELogVerbosity Verbosity, uint64& OutPosition);
+        void PublishSlot(LogSlot& Slot, uint64 Position);
+        void FillHeader(LogSlot& Slot, ELogVerbosity Verbosity, ESlotKind Kind);
+        bool EnsureWriter();
+        void WriterLoop();
+        int32 DrainQueue(); // Returns the records written
+        void WriteRecord(ELogVerbosity Verbosity, uint32 ThreadId, int64 Timestamp, const char* Text, int32 Length);
+        void WriteSynchronous(ELogVerbosity Verbosity, const char* Text, int32 Length);
+
+        template<typename... ArgTypes>
+        static int32 FormatDeferred(char* Out, int32 OutSize, const char* Format, const void* Arguments);
+
+        static uint32 GetThreadId();
+        static int64 GetTimestamp();
+
+        static std::atomic<uint8> s_Verbosity;
+        static LogSystem* s_Instance;
+    };
+
+    template<typename... ArgTypes>
+    void LogSystem::LogDeferred(ELogVerbosity Verbosity, const char* Format, ArgTypes&&... Arguments)
+    {
+        // Arrays decay, so string literals are stored as pointers
+        using ArgumentTuple = std::tuple<std::decay_t<ArgTypes>...>;
+        static_assert((std::is_trivially_copyable_v<std::decay_t<ArgTypes>> && ...), "LogDeferred arguments must be trivially copyable, log FStrings with Log instead");
+        static_assert(sizeof(ArgumentTuple) <= PayloadSize && alignof(ArgumentTuple) <= 16, "LogDeferred arguments don't fit in a log slot");
+
+        if (!IsEnabled(Verbosity))
+        {
+            return;
+        }
+
+        uint64 Position;
+        LogSlot* Slot = IsAsync() && EnsureWriter() ? ClaimSlot(Verbosity, Position) : nullptr;
+        if (!Slot)
+        {
+            if (!IsAsync() || !m_bWriterRunning.load(std::memory_order_acquire))
+            {
+                char Buffer[MaxFormattedLength];
+                ArgumentTuple Values(Arguments...);
+                int32 Length = FormatDeferred<std::decay_t<ArgTypes>...>(Buffer, sizeof(Buffer), Format, &Values);
+                WriteSynchronous(Verbosity, Buffer, Length);
+            }
+            return;
+        }
+
+        FillHeader(*Slot, Verbosity, ESlotKind::Deferred);
+        Slot->Formatter = &FormatDeferred<std::decay_t<ArgTypes>...>;
+        Slot->Format = Format;
+        new (Slot->Payload) ArgumentTuple(Arguments...);
+        PublishSlot(*Slot, Position);
+    }
+
+    template<typename... ArgTypes>
+    int32 LogSystem::FormatDeferred(char* Out, int32 OutSize, const char* Format, const void* Arguments)
+    {
+        const std::tuple<ArgTypes...>& Values = *static_cast<const std::tuple<ArgTypes...>*>(Arguments);
+        int32 Length = std::apply([&](const ArgTypes&... Values) { return std::snprintf(Out, static_cast<std::size_t>(OutSize), Format, Values...); }, Values);
+        return Length < 0 ? 0 : (Length >= OutSize ? OutSize - 1 : Length);
+    }
+}
+
+// Global access macros
+#define LOGGER UE4SDK::LogSystem::Get()
+
+// The message expression is only evaluated when the verbosity passes both filters
+#define UE4SDK_LOG(Verbosity, Message) \
+    do { if (UE4SDK::LogSystem::IsEnabled(UE4SDK::ELogVerbosity::Verbosity)) { UE4SDK::LogSystem::Get().Log(UE4SDK::ELogVerbosity::Verbosity, Message); } } while (0)
+
+#define LOG_ERROR(Message) UE4SDK_LOG(Error, Message)
+#define LOG_WARNING(Message) UE4SDK_LOG(Warning, Message)
+#define LOG_INFO(Message) UE4SDK_LOG(Log, Message)
+#define LOG_DEBUG(Message) UE4SDK_LOG(Verbose, Message)
+
+// printf-style, formatted on the writer thread
+#define LOG_DEFERRED(Verbosity, Format, ...) \
+    do { if (UE4SDK::LogSystem::IsEnabled(UE4SDK::ELogVerbosity::Verbosity)) { UE4SDK::LogSystem::Get().LogDeferred(UE4SDK::ELogVerbosity::Verbosity, Format, ##__VA_ARGS__); } } while (0)
@@ -0,0 +1,251 @@
+/*
+ * UE4 Matrix Implementation - Self-contained matrix, bounds and transform conversion implementation
+ * Vibe coder approved ✨
+ */
+
+#include "Matrix.h"
+#include <sstream>
+#include <cassert>
+
+namespace UE4SDK
+{
+    // FMatrix implementation
+    FMatrix FMatrix::Inverse() const
+    {
+        // 2x2 sub-determinants of the lower two rows, shared by the first two rows of cofactors
+        float Det[4][4];
+        float S0 = M[2][2] * M[3][3] - M[2][3] * M[3][2];
+        float S1 = M[2][1] * M[3][3] - M[2][3] * M[3][1];
+        float S2 = M[2][1] * M[3][2] - M[2][2] * M[3][1];
+        float S3 = M[2][0] * M[3][3] - M[2][3] * M[3][0];
+        float S4 = M[2][0] * M[3][2] - M[2][2] * M[3][0];
+        float S5 = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+
+        Det[0][0] =   M[1][1] * S0 - M[1][2] * S1 + M[1][3] * S2;
+        Det[0][1] = -(M[1][0] * S0 - M[1][2] * S3 + M[1][3] * S4);
+        Det[0][2] =   M[1][0] * S1 - M[1][1] * S3 + M[1][3] * S5;
+        Det[0][3] = -(M[1][0] * S2 - M[1][1] * S4 + M[1][2] * S5);
+
+        float Determinant = M[0][0] * Det[0][0] + M[0][1] * Det[0][1] + M[0][2] * Det[0][2] + M[0][3] * Det[0][3];
+        if (Determinant == 0.0f || !std::isfinite(Determinant))
+        {
+            return Identity;
+        }
+
+        Det[1][0] = -(M[0][1] * S0 - M[0][2] * S1 + M[0][3] * S2);
+        Det[1][1] =   M[0][0] * S0 - M[0][2] * S3 + M[0][3] * S4;
+        Det[1][2] = -(M[0][0] * S1 - M[0][1] * S3 + M[0][3] * S5);
+        Det[1][3] =   M[0][0] * S2 - M[0][1] * S4 + M[0][2] * S5;
+
+        // Same again for the upper two rows
+        float T0 = M[0][2] * M[1][3] - M[0][3] * M[1][2];
+        float T1 = M[0][1] * M[1][3] - M[0][3] * M[1][1];
+        float T2 = M[0][1] * M[1][2] - M[0][2] * M[1][1];
+        float T3 = M[0][0] * M[1][3] - M[0][3] * M[1][0];
+        float T4 = M[0][0] * M[1][2] - M[0][2] * M[1][0];
+        float T5 = M[0][0] * M[1][1] - M[0][1] * M[1][0];
+
+        Det[2][0] =   M[3][1] * T0 - M[3][2] * T1 + M[3][3] * T2;
+        Det[2][1] = -(M[3][0] * T0 - M[3][2] * T3 + M[3][3] * T4);
+        Det[2][2] =   M[3][0] * T1 - M[3][1] * T3 + M[3][3] * T5;
+        Det[2][3] = -(M[3][0] * T2 - M[3][1] * T4 + M[3][2] * T5);
+
+        Det[3][0] = -(M[2][1] * T0 - M[2][2] * T1 + M[2][3] * T2);
+        Det[3][1] =   M[2][0] * T0 - M[2][2] * T3 + M[2][3] * T4;
+        Det[3][2] = -(M[2][0] * T1 - M[2][1] * T3 + M[2][3] * T5);
+        Det[3][3] =   M[2][0] * T2 - M[2][1] * T4 + M[2][2] * T5;
+
+        // Inverse is the transposed cofactor matrix over the determinant
+        FMatrix Result;
+        float InvDeterminant = 1.0f / Determinant;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            for (int32 j = 0; j < 4; ++j)
+            {
+                Result.M[i][j] = Det[j][i] * InvDeterminant;
+            }
+        }
+        return Result;
+    }
+
+    FQuat FMatrix::ToQuat() const
+    {
+        // Pick the largest diagonal term to divide by, keeps the result stable near 180 degree rotations
+        FQuat Result;
+        float Trace = M[0][0] + M[1][1] + M[2][2];
+        if (Trace > 0.0f)
+        {
+            float Root = std::sqrt(Trace + 1.0f);
+            float InvScale = 0.5f / Root;
+            Result.W = 0.5f * Root;
+            Result.X = (M[1][2] - M[2][1]) * InvScale;
+            Result.Y = (M[2][0] - M[0][2]) * InvScale;
+            Result.Z = (M[0][1] - M[1][0]) * InvScale;
+        }
+        else
+        {
+            int32 i = 0;
+            if (M[1][1] > M[0][0]) i = 1;
+            if (M[2][2] > M[i][i]) i = 2;
+
+            static const int32 Next[3] = { 1, 2, 0 };
+            int32 j = Next[i];
+            int32 k = Next[j];
+
+            float Root = std::sqrt(M[i][i] - M[j][j] - M[k][k] + 1.0f);
+            float InvScale = 0.5f / Root;
+
+            float Components[4];
+            Components[i] = 0.5f * Root;
+            Components[3] = (M[j][k] - M[k][j]) * InvScale;
+            Components[j] = (M[i][j] + M[j][i]) * InvScale;
+            Components[k] = (M[i][k] + M[k][i]) * InvScale;
+
+            Result = FQuat(Components[0], Components[1], Components[2], Components[3]);
+        }
+        return Result.GetNormalized();
+    }
+
+    FString FMatrix::ToString() const
+    {
+        std::ostringstream oss;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            oss << "[" << M[i][0] << " " << M[i][1] << " " << M[i][2] << " " << M[i][3] << "]";
+            if (i < 3) oss << " ";
+        }
+        return FString(oss.str());
+    }
+
+    // FBox implementation
+    FBox FBox::TransformBy(const FMatrix& Matrix) const
+    {
+        if (!bIsValid)
+        {
+            return FBox();
+        }
+
+        // Transform the center, then grow the extent by the absolute matrix so every corner stays inside
+        FVector Center = Matrix.TransformPosition(GetCenter());
+        FVector Extent = GetExtent();
+        FVector NewExtent(std::abs(Extent.X * Matrix.M[0][0]) + std::abs(Extent.Y * Matrix.M[1][0]) + std::abs(Extent.Z * Matrix.M[2][0]),
+                          std::abs(Extent.X * Matrix.M[0][1]) + std::abs(Extent.Y * Matrix.M[1][1]) + std::abs(Extent.Z * Matrix.M[2][1]),
+                          std::abs(Extent.X * Matrix.M[0][2]) + std::abs(Extent.Y * Matrix.M[1][2]) + std::abs(Extent.Z * Matrix.M[2][2]));
+        return FBox(Center - NewExtent, Center + NewExtent);
+    }
+
+    FBox FBox::TransformBy(const FTransform& Transform) const
+    {
+        return TransformBy(Transform.ToMatrixWithScale());
+    }
+
+    FString FBox::ToString() const
+    {
+        std::ostringstream oss;
+        oss << "IsValid=" << (bIsValid ? "true" : "false") << " Min=(" << *Min.ToString() << ") Max=(" << *Max.ToString() << ")";
+        return FString(oss.str());
+    }
+
+    // FSphere and FPlane string conversion
+    FString FSphere::ToString() const
+    {
+        std::ostringstream oss;
+        oss << "Center=(" << *Center.ToString() << ") W=" << W;
+        return FString(oss.str());
+    }
+
+    FString FPlane::ToString() const
+    {
+        std::ostringstream oss;
+        oss << "X=" << X << " Y=" << Y << " Z=" << Z << " W=" << W;
+        return FString(oss.str());
+    }
+
+    // FTransform matrix conversion - declared in Types.h
+    FMatrix FTransform::ToMatrixWithScale() const
+    {
+        FMatrix Result;
+        float X2 = Rotation.X + Rotation.X;
+        float Y2 = Rotation.Y + Rotation.Y;
+        float Z2 = Rotation.Z + Rotation.Z;
+
+        float XX2 = Rotation.X * X2;
+        float YY2 = Rotation.Y * Y2;
+        float ZZ2 = Rotation.Z * Z2;
+        float XY2 = Rotation.X * Y2;
+        float XZ2 = Rotation.X * Z2;
+        float YZ2 = Rotation.Y * Z2;
+        float WX2 = Rotation.W * X2;
+        float WY2 = Rotation.W * Y2;
+        float WZ2 = Rotation.W * Z2;
+
+        // Row i is the rotated, scaled local axis i
+        Result.SetRow(0, (1.0f - (YY2 + ZZ2)) * Scale3D.X, (XY2 + WZ2) * Scale3D.X, (XZ2 - WY2) * Scale3D.X, 0.0f);
+        Result.SetRow(1, (XY2 - WZ2) * Scale3D.Y, (1.0f - (XX2 + ZZ2)) * Scale3D.Y, (YZ2 + WX2) * Scale3D.Y, 0.0f);
+        Result.SetRow(2, (XZ2 + WY2) * Scale3D.Z, (YZ2 - WX2) * Scale3D.Z, (1.0f - (XX2 + YY2)) * Scale3D.Z, 0.0f);
+        Result.SetRow(3, Translation.X, Translation.Y, Translation.Z, 1.0f);
+        return Result;
+    }
+
+    FMatrix FTransform::ToMatrixNoScale() const
+    {
+        return FTransform(Rotation, Translation).ToMatrixWithScale();
+    }
+
+    void FTransform::SetFromMatrix(const FMatrix& Matrix)
+    {
+        FMatrix Rotator = Matrix;
+        Scale3D = Rotator.GetScaleVector();
+        Rotator.RemoveScaling();
+
+        // A mirrored matrix can't be a rotation, so push the flip into the X scale
+        if (Matrix.Determinant() < 0.0f)
+        {
+            Scale3D.X = -Scale3D.X;
+            Rotator.M[0][0] = -Rotator.M[0][0];
+            Rotator.M[0][1] = -Rotator.M[0][1];
+            Rotator.M[0][2] = -Rotator.M[0][2];
+        }
+
+        Rotation = Rotator.ToQuat();
+        Translation = Matrix.GetOrigin();
+    }
+
+    // FMatrix static constants
+    const FMatrix FMatrix::Identity;
+
+#ifndef NDEBUG
+    namespace
+    {
+        // Debug builds check the conventions the culling and bounds code relies on once at startup
+        struct MatrixConventionCheck
+        {
+            MatrixConventionCheck()
+            {
+                // Lifting the plane z = 0 by 5 moves it to z = 5
+                FMatrix Lift;
+                Lift.SetRow(3, 0.0f, 0.0f, 5.0f, 1.0f);
+                FPlane Lifted = Lift.TransformPlane(FPlane(0.0f, 0.0f, 1.0f, 0.0f));
+                assert(std::abs(Lifted.Z - 1.0f) < 1e-4f && std::abs(Lifted.W - 5.0f) < 1e-4f);
+
+                // A point on a plane stays on it when both go through the same rotation, non-uniform scale and translation
+                FMatrix Matrix = FTransform(FQuat(FRotator(30.0f, 45.0f, 10.0f)), FVector(10.0f, -20.0f, 30.0f), FVector(2.0f, 0.5f, 3.0f)).ToMatrixWithScale();
+                FPlane Plane(FVector(1.0f, 2.0f, 3.0f), FVector(0.0f, 0.6f, 0.8f));
+                FVector Point = FVector(1.0f, 2.0f, 3.0f) + FVector(4.0f, -0.8f, 0.6f);
+                assert(std::abs(Matrix.TransformPlane(Plane).PlaneDot(Matrix.TransformPosition(Point))) < 1e-3f);
+
+                // Composition runs in opposite orders on the two types, the conversion has to swap the operands
+                FTransform Parent(FQuat(FRotator(0.0f, 90.0f, 0.0f)), FVector(100.0f, 0.0f, 0.0f), FVector(2.0f));
+                FTransform Child(FQuat(FRotator(20.0f, 0.0f, 40.0f)), FVector(0.0f, 10.0f, 5.0f), FVector(1.0f, 3.0f, 0.5f));
+                assert((Parent * Child).ToMatrixWithScale().Equals(Child.ToMatrixWithScale() * Parent.ToMatrixWithScale(), 1e-3f));
+                (void)Lifted;
+                (void)Point;
+                (void)Parent;
+                (void)Child;
+            }
+        };
+
+        const MatrixConventionCheck RunMatrixConventionCheck;
+    }
+#endif
+}
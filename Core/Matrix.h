@@ -0,0 +1,420 @@
+/*
+ * UE4 Matrix - Self-contained 4x4 matrix, plane, box and sphere types
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "VectorRegister.h"
+
+namespace UE4SDK
+{
+    // Plane - X, Y, Z is the unit normal and W the distance from the origin along it.
+    // PlaneDot is positive in front of the plane; convex volumes use outward facing planes.
+    class FPlane
+    {
+    public:
+        float X, Y, Z, W;
+
+        constexpr FPlane() : X(0.0f), Y(0.0f), Z(0.0f), W(0.0f) {}
+        constexpr FPlane(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+        constexpr FPlane(const FVector& Normal, float InW) : X(Normal.X), Y(Normal.Y), Z(Normal.Z), W(InW) {}
+        constexpr FPlane(const FVector& Base, const FVector& Normal) : X(Normal.X), Y(Normal.Y), Z(Normal.Z), W(Base | Normal) {}
+        FPlane(const FVector& A, const FVector& B, const FVector& C) // Counter-clockwise winding faces the viewer
+        {
+            FVector Normal = ((B - A) ^ (C - A)).GetSafeNormal();
+            X = Normal.X;
+            Y = Normal.Y;
+            Z = Normal.Z;
+            W = A | Normal;
+        }
+
+        constexpr bool operator==(const FPlane& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z && W == Other.W; }
+        constexpr bool operator!=(const FPlane& Other) const { return !(*this == Other); }
+
+        constexpr FVector GetNormal() const { return FVector(X, Y, Z); }
+        constexpr float PlaneDot(const FVector& Point) const { return X * Point.X + Y * Point.Y + Z * Point.Z - W; }
+        constexpr FPlane Flip() const { return FPlane(-X, -Y, -Z, -W); }
+
+        // Point on the plane closest to Point
+        constexpr FVector ProjectPoint(const FVector& Point) const { return Point - GetNormal() * PlaneDot(Point); }
+
+        // Where the segment Start-End crosses the plane, false when it doesn't
+        bool IntersectSegment(const FVector& Start, const FVector& End, FVector& OutIntersection) const
+        {
+            float StartDot = PlaneDot(Start);
+            float EndDot = PlaneDot(End);
+            if ((StartDot > 0.0f) == (EndDot > 0.0f) || StartDot == EndDot)
+            {
+                return false;
+            }
+
+            OutIntersection = Start + (End - Start) * (StartDot / (StartDot - EndDot));
+            return true;
+        }
+
+        FString ToString() const;
+    };
+
+    // Sphere - W is the radius
+    class FSphere
+    {
+    public:
+        FVector Center;
+        float W;
+
+        constexpr FSphere() : Center(0.0f), W(0.0f) {}
+        constexpr FSphere(const FVector& InCenter, float InW) : Center(InCenter), W(InW) {}
+
+        constexpr bool IsInside(const FVector& Point, float Tolerance = 0.0f) const { return (Point - Center).SizeSquared() <= (W + Tolerance) * (W + Tolerance); }
+        constexpr bool IsInside(const FSphere& Other, float Tolerance = 0.0f) const { return W >= Other.W && (Other.Center - Center).SizeSquared() <= (W - Other.W + Tolerance) * (W - Other.W + Tolerance); }
+        constexpr bool Intersects(const FSphere& Other, float Tolerance = 0.0f) const { return (Other.Center - Center).SizeSquared() <= (W + Other.W + Tolerance) * (W + Other.W + Tolerance); }
+
+        // Sphere enclosing both, not necessarily the smallest
+        FSphere operator+(const FSphere& Other) const
+        {
+            if (W == 0.0f) return Other;
+            if (Other.W == 0.0f || IsInside(Other)) return *this;
+            if (Other.IsInside(*this)) return Other;
+
+            FVector Direction = Other.Center - Center;
+            float Distance = Direction.Size();
+            float Radius = (Distance + W + Other.W) * 0.5f;
+            return FSphere(Center + Direction * ((Radius - W) / Distance), Radius);
+        }
+
+        FString ToString() const;
+    };
+
+    // Axis aligned box - bIsValid is false until a point or box has been added
+    class FBox
+    {
+    public:
+        FVector Min;
+        FVector Max;
+        uint8 bIsValid;
+
+        constexpr FBox() : Min(0.0f), Max(0.0f), bIsValid(0) {}
+        constexpr FBox(const FVector& InMin, const FVector& InMax) : Min(InMin), Max(InMax), bIsValid(1) {}
+        FBox(const FVector* Points, int32 Count) : FBox()
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                *this += Points[i];
+            }
+        }
+
+        static constexpr FBox BuildAABB(const FVector& Origin, const FVector& Extent) { return FBox(Origin - Extent, Origin + Extent); }
+
+        constexpr bool operator==(const FBox& Other) const { return Min == Other.Min && Max == Other.Max; }
+        constexpr bool operator!=(const FBox& Other) const { return !(*this == Other); }
+
+        FBox& operator+=(const FVector& Point)
+        {
+            if (bIsValid)
+            {
+                Min = FVector(std::min(Min.X, Point.X), std::min(Min.Y, Point.Y), std::min(Min.Z, Point.Z));
+                Max = FVector(std::max(Max.X, Point.X), std::max(Max.Y, Point.Y), std::max(Max.Z, Point.Z));
+            }
+            else
+            {
+                Min = Max = Point;
+                bIsValid = 1;
+            }
+            return *this;
+        }
+
+        FBox& operator+=(const FBox& Other)
+        {
+            if (Other.bIsValid)
+            {
+                *this += Other.Min;
+                *this += Other.Max;
+            }
+            return *this;
+        }
+
+        FBox operator+(const FVector& Point) const { return FBox(*this) += Point; }
+        FBox operator+(const FBox& Other) const { return FBox(*this) += Other; }
+
+        constexpr FVector GetCenter() const { return (Min + Max) * 0.5f; }
+        constexpr FVector GetExtent() const { return (Max - Min) * 0.5f; }
+        constexpr FVector GetSize() const { return Max - Min; }
+        constexpr float GetVolume() const { return (Max.X - Min.X) * (Max.Y - Min.Y) * (Max.Z - Min.Z); }
+
+        constexpr FBox ExpandBy(float Amount) const { return FBox(Min - FVector(Amount), Max + FVector(Amount)); }
+        constexpr FBox ShiftBy(const FVector& Offset) const { return FBox(Min + Offset, Max + Offset); }
+
+        // Overlap tests - touching counts as overlapping
+        constexpr bool IsInside(const FVector& Point) const
+        {
+            return Point.X > Min.X && Point.X < Max.X && Point.Y > Min.Y && Point.Y < Max.Y && Point.Z > Min.Z && Point.Z < Max.Z;
+        }
+        constexpr bool IsInsideOrOn(const FVector& Point) const
+        {
+            return Point.X >= Min.X && Point.X <= Max.X && Point.Y >= Min.Y && Point.Y <= Max.Y && Point.Z >= Min.Z && Point.Z <= Max.Z;
+        }
+        constexpr bool IsInside(const FBox& Other) const { return IsInsideOrOn(Other.Min) && IsInsideOrOn(Other.Max); }
+        constexpr bool Intersect(const FBox& Other) const
+        {
+            return Min.X <= Other.Max.X && Max.X >= Other.Min.X && Min.Y <= Other.Max.Y && Max.Y >= Other.Min.Y && Min.Z <= Other.Max.Z && Max.Z >= Other.Min.Z;
+        }
+        bool Intersect(const FSphere& Sphere) const { return ComputeSquaredDistanceToPoint(Sphere.Center) <= Sphere.W * Sphere.W; }
+
+        FVector GetClosestPointTo(const FVector& Point) const
+        {
+            return FVector(std::min(std::max(Point.X, Min.X), Max.X), std::min(std::max(Point.Y, Min.Y), Max.Y), std::min(std::max(Point.Z, Min.Z), Max.Z));
+        }
+        float ComputeSquaredDistanceToPoint(const FVector& Point) const { return (GetClosestPointTo(Point) - Point).SizeSquared(); }
+
+        // Slab test. InvDirection is 1 / direction per axis, so one ray can be tested against many boxes cheaply.
+        bool IntersectRay(const FVector& Origin, const FVector& InvDirection, float MaxDistance, float* OutDistance = nullptr) const
+        {
+            float T1 = (Min.X - Origin.X) * InvDirection.X;
+            float T2 = (Max.X - Origin.X) * InvDirection.X;
+            float Near = std::min(T1, T2);
+            float Far = std::max(T1, T2);
+
+            T1 = (Min.Y - Origin.Y) * InvDirection.Y;
+            T2 = (Max.Y - Origin.Y) * InvDirection.Y;
+            Near = std::max(Near, std::min(T1, T2));
+            Far = std::min(Far, std::max(T1, T2));
+
+            T1 = (Min.Z - Origin.Z) * InvDirection.Z;
+            T2 = (Max.Z - Origin.Z) * InvDirection.Z;
+            Near = std::max(Near, std::min(T1, T2));
+            Far = std::min(Far, std::max(T1, T2));
+
+            Near = std::max(Near, 0.0f);
+            if (Near > Far || Near > MaxDistance)
+            {
+                return false;
+            }
+            if (OutDistance)
+            {
+                *OutDistance = Near;
+            }
+            return true;
+        }
+
+        // Which side of a plane the box is on: 1 in front, -1 behind, 0 straddling
+        int32 GetPlaneSide(const FPlane& Plane) const
+        {
+            FVector Center = GetCenter();
+            FVector Extent = GetExtent();
+            float Distance = Plane.PlaneDot(Center);
+            float Radius = std::abs(Extent.X * Plane.X) + std::abs(Extent.Y * Plane.Y) + std::abs(Extent.Z * Plane.Z);
+            return Distance > Radius ? 1 : (Distance < -Radius ? -1 : 0);
+        }
+
+        FBox TransformBy(const FMatrix& Matrix) const;
+        FBox TransformBy(const FTransform& Transform) const;
+
+        FString ToString() const;
+    };
+
+    // 4x4 matrix - row vectors, so points transform as P * M and translation lives in row 3.
+    // A * B applies A first, then B - the reverse of FTransform, whose A * B applies B first.
+    class FMatrix
+    {
+    public:
+        alignas(16) float M[4][4];
+
+        FMatrix() { SetIdentity(); }
+        FMatrix(const FPlane& InX, const FPlane& InY, const FPlane& InZ, const FPlane& InW)
+        {
+            SetRow(0, InX.X, InX.Y, InX.Z, InX.W);
+            SetRow(1, InY.X, InY.Y, InY.Z, InY.W);
+            SetRow(2, InZ.X, InZ.Y, InZ.Z, InZ.W);
+            SetRow(3, InW.X, InW.Y, InW.Z, InW.W);
+        }
+        FMatrix(const FVector& InX, const FVector& InY, const FVector& InZ, const FVector& InW)
+        {
+            SetRow(0, InX.X, InX.Y, InX.Z, 0.0f);
+            SetRow(1, InY.X, InY.Y, InY.Z, 0.0f);
+            SetRow(2, InZ.X, InZ.Y, InZ.Z, 0.0f);
+            SetRow(3, InW.X, InW.Y, InW.Z, 1.0f);
+        }
+
+        void SetIdentity()
+        {
+            SetRow(0, 1.0f, 0.0f, 0.0f, 0.0f);
+            SetRow(1, 0.0f, 1.0f, 0.0f, 0.0f);
+            SetRow(2, 0.0f, 0.0f, 1.0f, 0.0f);
+            SetRow(3, 0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        void SetRow(int32 Row, float X, float Y, float Z, float W) { M[Row][0] = X; M[Row][1] = Y; M[Row][2] = Z; M[Row][3] = W; }
+
+        // Each result row is a blend of Other's rows weighted by this row, four columns per register
+        FMatrix operator*(const FMatrix& Other) const
+        {
+            FMatrix Result;
+            VectorRegister Row0 = VectorLoad(Other.M[0]);
+            VectorRegister Row1 = VectorLoad(Other.M[1]);
+            VectorRegister Row2 = VectorLoad(Other.M[2]);
+            VectorRegister Row3 = VectorLoad(Other.M[3]);
+            for (int32 i = 0; i < 4; ++i)
+            {
+                VectorRegister Sum = VectorMultiply(VectorSetFloat1(M[i][0]), Row0);
+                Sum = VectorMultiplyAdd(VectorSetFloat1(M[i][1]), Row1, Sum);
+                Sum = VectorMultiplyAdd(VectorSetFloat1(M[i][2]), Row2, Sum);
+                Sum = VectorMultiplyAdd(VectorSetFloat1(M[i][3]), Row3, Sum);
+                VectorStore(Sum, Result.M[i]);
+            }
+            return Result;
+        }
+        FMatrix& operator*=(const FMatrix& Other) { *this = *this * Other; return *this; }
+
+        FMatrix operator+(const FMatrix& Other) const
+        {
+            FMatrix Result;
+            for (int32 i = 0; i < 4; ++i)
+            {
+                VectorStore(VectorAdd(VectorLoad(M[i]), VectorLoad(Other.M[i])), Result.M[i]);
+            }
+            return Result;
+        }
+
+        FMatrix operator*(float Scale) const
+        {
+            FMatrix Result;
+            VectorRegister Factor = VectorSetFloat1(Scale);
+            for (int32 i = 0; i < 4; ++i)
+            {
+                VectorStore(VectorMultiply(VectorLoad(M[i]), Factor), Result.M[i]);
+            }
+            return Result;
+        }
+
+        bool operator==(const FMatrix& Other) const { return std::memcmp(M, Other.M, sizeof(M)) == 0; }
+        bool operator!=(const FMatrix& Other) const { return !(*this == Other); }
+        bool Equals(const FMatrix& Other, float Tolerance = 1e-4f) const
+        {
+            for (int32 i = 0; i < 4; ++i)
+            {
+                for (int32 j = 0; j < 4; ++j)
+                {
+                    if (std::abs(M[i][j] - Other.M[i][j]) > Tolerance)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Transforms
+        FVector TransformPosition(const FVector& V) const
+        {
+            return FVector(V.X * M[0][0] + V.Y * M[1][0] + V.Z * M[2][0] + M[3][0],
+                           V.X * M[0][1] + V.Y * M[1][1] + V.Z * M[2][1] + M[3][1],
+                           V.X * M[0][2] + V.Y * M[1][2] + V.Z * M[2][2] + M[3][2]);
+        }
+        FVector TransformVector(const FVector& V) const
+        {
+            return FVector(V.X * M[0][0] + V.Y * M[1][0] + V.Z * M[2][0],
+                           V.X * M[0][1] + V.Y * M[1][1] + V.Z * M[2][1],
+                           V.X * M[0][2] + V.Y * M[1][2] + V.Z * M[2][2]);
+        }
+        FVector InverseTransformPosition(const FVector& V) const { return Inverse().TransformPosition(V); }
+
+        // Planes transform by the inverse transpose, so the normal stays perpendicular under non-uniform scale.
+        // The plane is the row vector (X, Y, Z, -W), multiplied like a point.
+        FPlane TransformPlane(const FPlane& Plane) const
+        {
+            FMatrix InverseTransposed = Inverse().GetTransposed();
+            float X = Plane.X, Y = Plane.Y, Z = Plane.Z, W = -Plane.W;
+            FPlane Result(X * InverseTransposed.M[0][0] + Y * InverseTransposed.M[1][0] + Z * InverseTransposed.M[2][0] + W * InverseTransposed.M[3][0],
+                          X * InverseTransposed.M[0][1] + Y * InverseTransposed.M[1][1] + Z * InverseTransposed.M[2][1] + W * InverseTransposed.M[3][1],
+                          X * InverseTransposed.M[0][2] + Y * InverseTransposed.M[1][2] + Z * InverseTransposed.M[2][2] + W * InverseTransposed.M[3][2],
+                          -(X * InverseTransposed.M[0][3] + Y * InverseTransposed.M[1][3] + Z * InverseTransposed.M[2][3] + W * InverseTransposed.M[3][3]));
+            float Length = Result.GetNormal().Size();
+            return Length > 0.0f ? FPlane(Result.X / Length, Result.Y / Length, Result.Z / Length, Result.W / Length) : Result;
+        }
+
+        FMatrix GetTransposed() const
+        {
+            FMatrix Result;
+            for (int32 i = 0; i < 4; ++i)
+            {
+                for (int32 j = 0; j < 4; ++j)
+                {
+                    Result.M[i][j] = M[j][i];
+                }
+            }
+            return Result;
+        }
+
+        float Determinant() const
+        {
+            return M[0][0] * (M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) + M[3][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]))
+                 - M[1][0] * (M[0][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][1] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][1] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]))
+                 + M[2][0] * (M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) - M[1][1] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][1] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]))
+                 - M[3][0] * (M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) - M[1][1] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]) + M[2][1] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
+        }
+
+        // General inverse, identity for singular matrices
+        FMatrix Inverse() const;
+
+        // Scale and axes
+        FVector GetOrigin() const { return FVector(M[3][0], M[3][1], M[3][2]); }
+        void SetOrigin(const FVector& Origin) { M[3][0] = Origin.X; M[3][1] = Origin.Y; M[3][2] = Origin.Z; }
+        FVector GetScaledAxis(int32 Axis) const { return FVector(M[Axis][0], M[Axis][1], M[Axis][2]); }
+        FVector GetScaleVector(float Tolerance = 1e-8f) const
+        {
+            FVector Scale;
+            float* Components[3] = { &Scale.X, &Scale.Y, &Scale.Z };
+            for (int32 i = 0; i < 3; ++i)
+            {
+                float SizeSquared = GetScaledAxis(i).SizeSquared();
+                *Components[i] = SizeSquared > Tolerance ? std::sqrt(SizeSquared) : 0.0f;
+            }
+            return Scale;
+        }
+        void RemoveScaling(float Tolerance = 1e-8f)
+        {
+            for (int32 i = 0; i < 3; ++i)
+            {
+                float SizeSquared = GetScaledAxis(i).SizeSquared();
+                float Scale = SizeSquared > Tolerance ? 1.0f / std::sqrt(SizeSquared) : 1.0f;
+                M[i][0] *= Scale;
+                M[i][1] *= Scale;
+                M[i][2] *= Scale;
+            }
+        }
+
+        // Rotation part as a quaternion, the matrix must have no scale
+        FQuat ToQuat() const;
+
+        FString ToString() const;
+
+        // Static constants
+        static const FMatrix Identity;
+    };
+
+    // Batch kernel - matrix times many points, four per iteration. In and Out may be the same array.
+    inline void TransformPositions(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Count)
+    {
+        VectorRegister M00 = VectorSetFloat1(Matrix.M[0][0]), M01 = VectorSetFloat1(Matrix.M[0][1]), M02 = VectorSetFloat1(Matrix.M[0][2]);
+        VectorRegister M10 = VectorSetFloat1(Matrix.M[1][0]), M11 = VectorSetFloat1(Matrix.M[1][1]), M12 = VectorSetFloat1(Matrix.M[1][2]);
+        VectorRegister M20 = VectorSetFloat1(Matrix.M[2][0]), M21 = VectorSetFloat1(Matrix.M[2][1]), M22 = VectorSetFloat1(Matrix.M[2][2]);
+        VectorRegister M30 = VectorSetFloat1(Matrix.M[3][0]), M31 = VectorSetFloat1(Matrix.M[3][1]), M32 = VectorSetFloat1(Matrix.M[3][2]);
+
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V = VectorLoadTransposed(In + i);
+            VectorRegister3x4 Result;
+            Result.X = VectorMultiplyAdd(V.Z, M20, VectorMultiplyAdd(V.Y, M10, VectorMultiplyAdd(V.X, M00, M30)));
+            Result.Y = VectorMultiplyAdd(V.Z, M21, VectorMultiplyAdd(V.Y, M11, VectorMultiplyAdd(V.X, M01, M31)));
+            Result.Z = VectorMultiplyAdd(V.Z, M22, VectorMultiplyAdd(V.Y, M12, VectorMultiplyAdd(V.X, M02, M32)));
+            VectorStoreTransposed(Result, Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = Matrix.TransformPosition(In[i]);
+        }
+    }
+}
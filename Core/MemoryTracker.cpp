@@ -0,0 +1,559 @@
+/*
+ * UE4 Memory Tracker Implementation - Self-contained per-subsystem memory accounting implementation
+ * Vibe coder approved ✨
+ */
+
+#include "MemoryTracker.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Call stacks come from CaptureStackBackTrace on Windows and backtrace() on glibc and Apple platforms
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #define UE4SDK_MEMORY_STACKS 1
+#elif defined(__GLIBC__) || defined(__APPLE__)
+    #include <execinfo.h>
+    #define UE4SDK_MEMORY_STACKS 1
+#else
+    #define UE4SDK_MEMORY_STACKS 0
+#endif
+
+namespace UE4SDK
+{
+    namespace
+    {
+        const int64 DefaultSampleInterval = 512 * 1024;
+        const double RateSmoothing = 0.1;
+        const float BudgetWarningInterval = 1.0f; // Seconds between over-budget warnings
+        const int32 SkippedStackFrames = 2;        // CaptureStack and SampleStack
+
+        // Set once the thread's shard is handed back, later allocations on the thread go to the shared shard
+        thread_local bool t_bShardReleased = false;
+
+        // Hands the thread's shard back when the thread exits
+        struct ThreadShardRelease
+        {
+            MemoryThreadShard* Shard = nullptr;
+
+            ~ThreadShardRelease()
+            {
+                if (Shard)
+                {
+                    MemoryTracker::Get().RetireThreadShard(*Shard);
+                }
+            }
+        };
+
+        thread_local ThreadShardRelease t_ShardRelease;
+
+        int32 CaptureStack(void** Frames, int32 MaxFrames)
+        {
+#if UE4SDK_MEMORY_STACKS && defined(_WIN32)
+            return static_cast<int32>(CaptureStackBackTrace(SkippedStackFrames, static_cast<DWORD>(MaxFrames), Frames, nullptr));
+#elif UE4SDK_MEMORY_STACKS
+            void* Captured[MemoryTracker::MaxStackFrames + SkippedStackFrames];
+            int32 Count = backtrace(Captured, MaxFrames + SkippedStackFrames) - SkippedStackFrames;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Frames[i] = Captured[i + SkippedStackFrames];
+            }
+            return Count > 0 ? Count : 0;
+#else
+            return 0;
+#endif
+        }
+
+        uint64 HashStack(EMemoryTag Tag, void* const* Frames, int32 FrameCount)
+        {
+            // FNV-1a over the tag and the return addresses
+            uint64 Hash = 14695981039346656037ull ^ static_cast<uint64>(Tag);
+            for (int32 i = 0; i < FrameCount; ++i)
+            {
+                Hash = (Hash ^ static_cast<uint64>(reinterpret_cast<uintptr_t>(Frames[i]))) * 1099511628211ull;
+            }
+            return Hash;
+        }
+    }
+
+    const char* GetMemoryTagName(EMemoryTag Tag)
+    {
+        switch (Tag)
+        {
+        case EMemoryTag::Default: return "Default";
+        case EMemoryTag::UObject: return "UObject";
+        case EMemoryTag::AI: return "AI";
+        case EMemoryTag::Blackboard: return "Blackboard";
+        case EMemoryTag::Navigation: return "Navigation";
+        case EMemoryTag::Replication: return "Replication";
+        case EMemoryTag::Network: return "Network";
+        case EMemoryTag::Tasks: return "Tasks";
+        case EMemoryTag::Diagnostics: return "Diagnostics";
+        case EMemoryTag::Count: break;
+        }
+        return "Unknown";
+    }
+
+    // Container and UObject hooks declared in Types.h
+    void TrackMemoryAllocation(EMemoryTag Tag, std::size_t Size)
+    {
+        MemoryTracker::RecordAllocation(Tag, static_cast<int64>(Size));
+    }
+
+    void TrackMemoryFree(EMemoryTag Tag, std::size_t Size)
+    {
+        MemoryTracker::RecordFree(Tag, static_cast<int64>(Size));
+    }
+
+    // MemoryThreadShard implementation
+    MemoryThreadShard::MemoryThreadShard(bool bShared)
+        : m_BytesUntilSample(0)
+        , m_RandomState(0)
+        , m_bShared(bShared)
+        , m_bRetired(false)
+    {
+        for (int32 i = 0; i < TagCount; ++i)
+        {
+            m_AllocatedBytes[i].store(0, std::memory_order_relaxed);
+            m_FreedBytes[i].store(0, std::memory_order_relaxed);
+            m_Allocations[i].store(0, std::memory_order_relaxed);
+            m_Frees[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // MemoryTracker implementation
+    std::atomic<int64> MemoryTracker::s_SampleInterval(DefaultSampleInterval);
+    thread_local MemoryThreadShard* MemoryTracker::t_Shard = nullptr;
+
+    MemoryTracker& MemoryTracker::Get()
+    {
+        // Allocations arrive from any thread as early as static init, so this one can't be created lazily
+        // through an unguarded s_Instance like the other singletons
+        static MemoryTracker* Instance = new MemoryTracker();
+        return *Instance;
+    }
+
+    MemoryTracker::MemoryTracker()
+        : m_SharedShard(new MemoryThreadShard(true))
+        , m_FrameNumber(0)
+        , m_FrameAllocations(0)
+        , m_FrameAllocationBudget(0)
+        , m_TimeSinceBudgetWarning(BudgetWarningInterval)
+        , m_bStatsRegistered(false)
+        , m_DroppedStackSamples(0)
+    {
+        for (int32 i = 0; i < TagCount; ++i)
+        {
+            m_PeakBytes[i] = 0;
+            m_FrameAllocationsByTag[i] = 0;
+            m_FrameBytesByTag[i] = 0;
+            m_AllocationsPerSecond[i] = 0.0;
+            m_BytesPerSecond[i] = 0.0;
+        }
+        m_Shards.reserve(64);
+    }
+
+    void MemoryTracker::RecordAllocation(EMemoryTag Tag, int64 Size)
+    {
+        int32 Index = static_cast<int32>(Tag);
+        MemoryThreadShard& Shard = GetThreadShard();
+        Shard.Add(Shard.m_AllocatedBytes[Index], Size);
+        Shard.Add(Shard.m_Allocations[Index], 1);
+
+        if (Shard.m_bShared)
+        {
+            return;
+        }
+
+        Shard.m_BytesUntilSample -= Size;
+        if (Shard.m_BytesUntilSample <= 0)
+        {
+            // An allocation larger than the interval counts once for every interval it spans
+            int64 Samples = 0;
+            do
+            {
+                ++Samples;
+                Shard.m_BytesUntilSample += NextSampleDistance(Shard);
+            }
+            while (Shard.m_BytesUntilSample <= 0);
+
+            if (GetSampleInterval() > 0)
+            {
+                Get().SampleStack(Tag, Samples);
+            }
+        }
+    }
+
+    void MemoryTracker::RecordFree(EMemoryTag Tag, int64 Size)
+    {
+        int32 Index = static_cast<int32>(Tag);
+        MemoryThreadShard& Shard = GetThreadShard();
+        Shard.Add(Shard.m_FreedBytes[Index], Size);
+        Shard.Add(Shard.m_Frees[Index], 1);
+    }
+
+    int64 MemoryTracker::NextSampleDistance(MemoryThreadShard& Shard)
+    {
+        // Jittered to half to one and a half intervals, so allocation patterns that repeat on a fixed
+        // byte period don't always land the sample on the same call site
+        int64 Interval = GetSampleInterval();
+        if (Interval <= 0)
+        {
+            // Sampling is off - check again after a default interval in case it gets turned on
+            return DefaultSampleInterval;
+        }
+
+        uint64 State = Shard.m_RandomState;
+        State ^= State << 13;
+        State ^= State >> 7;
+        State ^= State << 17;
+        Shard.m_RandomState = State;
+        return Interval / 2 + static_cast<int64>(State % static_cast<uint64>(Interval)) + 1;
+    }
+
+    void MemoryTracker::SetSampleInterval(int64 Bytes)
+    {
+        s_SampleInterval.store(std::max<int64>(0, Bytes), std::memory_order_relaxed);
+    }
+
+    MemoryThreadShard& MemoryTracker::AcquireThreadShard()
+    {
+        if (t_bShardReleased)
+        {
+            return *m_SharedShard;
+        }
+
+        std::lock_guard<std::mutex> Lock(m_ShardMutex);
+        MemoryThreadShard* Shard = nullptr;
+        for (const std::unique_ptr<MemoryThreadShard>& Existing : m_Shards)
+        {
+            if (Existing->m_bRetired)
+            {
+                Shard = Existing.get();
+                break;
+            }
+        }
+
+        if (!Shard)
+        {
+            m_Shards.push_back(std::make_unique<MemoryThreadShard>(false));
+            Shard = m_Shards.back().get();
+        }
+
+        Shard->m_bRetired = false;
+        Shard->m_RandomState = static_cast<uint64>(reinterpret_cast<uintptr_t>(&t_ShardRelease)) | 1;
+        Shard->m_BytesUntilSample = NextSampleDistance(*Shard);
+        t_Shard = Shard;
+        t_ShardRelease.Shard = Shard;
+        return *Shard;
+    }
+
+    void MemoryTracker::RetireThreadShard(MemoryThreadShard& Shard)
+    {
+        // Counters stay put - they're cumulative, so the next owner just keeps adding
+        std::lock_guard<std::mutex> Lock(m_ShardMutex);
+        Shard.m_bRetired = true;
+        t_Shard = nullptr;
+        t_bShardReleased = true;
+    }
+
+    void MemoryTracker::SumShards(TagTotals* OutTotals) const
+    {
+        std::lock_guard<std::mutex> Lock(m_ShardMutex);
+        auto AddShard = [OutTotals](const MemoryThreadShard& Shard)
+        {
+            for (int32 i = 0; i < TagCount; ++i)
+            {
+                OutTotals[i].AllocatedBytes += Shard.m_AllocatedBytes[i].load(std::memory_order_relaxed);
+                OutTotals[i].FreedBytes += Shard.m_FreedBytes[i].load(std::memory_order_relaxed);
+                OutTotals[i].Allocations += Shard.m_Allocations[i].load(std::memory_order_relaxed);
+                OutTotals[i].Frees += Shard.m_Frees[i].load(std::memory_order_relaxed);
+            }
+        };
+
+        for (const std::unique_ptr<MemoryThreadShard>& Shard : m_Shards)
+        {
+            AddShard(*Shard);
+        }
+        AddShard(*m_SharedShard);
+    }
+
+    void MemoryTracker::MergeTag(EMemoryTag Tag, const TagTotals& Totals, MemoryTagStats& OutStats) const
+    {
+        // Shards are read one after another, so a free can be seen before its allocation - clamp the difference
+        int32 Index = static_cast<int32>(Tag);
+        OutStats.Tag = Tag;
+        OutStats.Name = GetMemoryTagName(Tag);
+        OutStats.LiveBytes = std::max<int64>(0, Totals.AllocatedBytes - Totals.FreedBytes);
+        OutStats.LiveAllocations = std::max<int64>(0, Totals.Allocations - Totals.Frees);
+        OutStats.TotalAllocations = Totals.Allocations;
+        OutStats.TotalBytes = Totals.AllocatedBytes;
+
+        m_PeakBytes[Index] = std::max(m_PeakBytes[Index], OutStats.LiveBytes);
+        OutStats.PeakBytes = m_PeakBytes[Index];
+        OutStats.FrameAllocations = m_FrameAllocationsByTag[Index];
+        OutStats.FrameBytes = m_FrameBytesByTag[Index];
+        OutStats.AllocationsPerSecond = m_AllocationsPerSecond[Index];
+        OutStats.BytesPerSecond = m_BytesPerSecond[Index];
+    }
+
+    void MemoryTracker::EndFrame(float DeltaTime)
+    {
+        if (!m_bStatsRegistered)
+        {
+            m_bStatsRegistered = true;
+            for (int32 i = 0; i < TagCount; ++i)
+            {
+                m_LiveBytesStats[i] = STATS.RegisterGauge(FString("Memory.") + GetMemoryTagName(static_cast<EMemoryTag>(i)) + FString(".LiveBytes"));
+            }
+            m_FrameAllocationsStat = STATS.RegisterCounter(TEXT("Memory.Allocations"));
+        }
+
+        TagTotals Totals[TagCount];
+        SumShards(Totals);
+
+        int64 LiveBytes[TagCount];
+        int32 WorstTag = 0;
+        int64 FrameAllocations = 0;
+        bool bFirstFrame;
+        {
+            std::lock_guard<std::mutex> Lock(m_StateMutex);
+            bFirstFrame = m_FrameNumber == 0;
+
+            for (int32 i = 0; i < TagCount; ++i)
+            {
+                const TagTotals& Now = Totals[i];
+                TagTotals& Start = m_FrameStart[i];
+                m_FrameAllocationsByTag[i] = Now.Allocations - Start.Allocations;
+                m_FrameBytesByTag[i] = Now.AllocatedBytes - Start.AllocatedBytes;
+                Start = Now;
+
+                if (DeltaTime > 0.0f)
+                {
+                    double Allocations = m_FrameAllocationsByTag[i] / static_cast<double>(DeltaTime);
+                    double Bytes = m_FrameBytesByTag[i] / static_cast<double>(DeltaTime);
+                    m_AllocationsPerSecond[i] = bFirstFrame ? Allocations : m_AllocationsPerSecond[i] + (Allocations - m_AllocationsPerSecond[i]) * RateSmoothing;
+                    m_BytesPerSecond[i] = bFirstFrame ? Bytes : m_BytesPerSecond[i] + (Bytes - m_BytesPerSecond[i]) * RateSmoothing;
+                }
+
+                LiveBytes[i] = std::max<int64>(0, Now.AllocatedBytes - Now.FreedBytes);
+                m_PeakBytes[i] = std::max(m_PeakBytes[i], LiveBytes[i]);
+
+                FrameAllocations += m_FrameAllocationsByTag[i];
+                WorstTag = m_FrameAllocationsByTag[i] > m_FrameAllocationsByTag[WorstTag] ? i : WorstTag;
+            }
+
+            m_FrameAllocations = FrameAllocations;
+            ++m_FrameNumber;
+        }
+
+        for (int32 i = 0; i < TagCount; ++i)
+        {
+            STATS.SetGauge(m_LiveBytesStats[i], static_cast<double>(LiveBytes[i]));
+        }
+        StatsRegistry::AddCounter(m_FrameAllocationsStat, FrameAllocations);
+
+        // The first frame also counts everything allocated at startup, so the budget starts with the second
+        m_TimeSinceBudgetWarning += DeltaTime;
+        if (m_FrameAllocationBudget > 0 && !bFirstFrame && FrameAllocations > m_FrameAllocationBudget && m_TimeSinceBudgetWarning >= BudgetWarningInterval)
+        {
+            m_TimeSinceBudgetWarning = 0.0f;
+
+            char Line[256];
+            std::snprintf(Line, sizeof(Line), "Memory: frame %llu made %lld allocations (budget %lld), most under %s (%lld)",
+                static_cast<unsigned long long>(m_FrameNumber), static_cast<long long>(FrameAllocations), static_cast<long long>(m_FrameAllocationBudget),
+                GetMemoryTagName(static_cast<EMemoryTag>(WorstTag)), static_cast<long long>(m_FrameAllocationsByTag[WorstTag]));
+            Utils::Get().LogWarning(FString(Line));
+        }
+    }
+
+    MemoryTagStats MemoryTracker::GetTagStats(EMemoryTag Tag) const
+    {
+        TagTotals Totals[TagCount];
+        SumShards(Totals);
+
+        MemoryTagStats Stats;
+        std::lock_guard<std::mutex> Lock(m_StateMutex);
+        MergeTag(Tag, Totals[static_cast<int32>(Tag)], Stats);
+        return Stats;
+    }
+
+    void MemoryTracker::GetAllTagStats(TArray<MemoryTagStats>& OutStats) const
+    {
+        TagTotals Totals[TagCount];
+        SumShards(Totals);
+
+        MemoryTagStats Merged[TagCount];
+        {
+            std::lock_guard<std::mutex> Lock(m_StateMutex);
+            for (int32 i = 0; i < TagCount; ++i)
+            {
+                MergeTag(static_cast<EMemoryTag>(i), Totals[i], Merged[i]);
+            }
+        }
+
+        // Filled outside the lock, since growing OutStats is itself a tracked allocation
+        OutStats.Empty();
+        OutStats.Reserve(TagCount);
+        for (const MemoryTagStats& Stats : Merged)
+        {
+            OutStats.Add(Stats);
+        }
+    }
+
+    int64 MemoryTracker::GetTotalLiveBytes() const
+    {
+        TagTotals Totals[TagCount];
+        SumShards(Totals);
+
+        int64 LiveBytes = 0;
+        for (const TagTotals& Tag : Totals)
+        {
+            LiveBytes += Tag.AllocatedBytes - Tag.FreedBytes;
+        }
+        return std::max<int64>(0, LiveBytes);
+    }
+
+    FString MemoryTracker::GetReportJson() const
+    {
+        TArray<MemoryTagStats> AllStats;
+        GetAllTagStats(AllStats);
+
+        std::string Json;
+        char Buffer[512];
+        std::snprintf(Buffer, sizeof(Buffer), "{\"frame\":%llu,\"frame_allocations\":%lld,\"sample_interval\":%lld,\"tags\":[",
+            static_cast<unsigned long long>(m_FrameNumber), static_cast<long long>(m_FrameAllocations), static_cast<long long>(GetSampleInterval()));
+        Json += Buffer;
+
+        for (int32 i = 0; i < AllStats.Num(); ++i)
+        {
+            const MemoryTagStats& Stats = AllStats[i];
+            std::snprintf(Buffer, sizeof(Buffer),
+                "%s{\"name\":\"%s\",\"live_bytes\":%lld,\"peak_bytes\":%lld,\"live_allocations\":%lld,\"total_allocations\":%lld,\"total_bytes\":%lld,"
+                "\"frame_allocations\":%lld,\"frame_bytes\":%lld,\"allocations_per_second\":%.3f,\"bytes_per_second\":%.3f}",
+                i == 0 ? "" : ",", *Stats.Name, static_cast<long long>(Stats.LiveBytes), static_cast<long long>(Stats.PeakBytes),
+                static_cast<long long>(Stats.LiveAllocations), static_cast<long long>(Stats.TotalAllocations), static_cast<long long>(Stats.TotalBytes),
+                static_cast<long long>(Stats.FrameAllocations), static_cast<long long>(Stats.FrameBytes), Stats.AllocationsPerSecond, Stats.BytesPerSecond);
+            Json += Buffer;
+        }
+
+        Json += "]}";
+        return FString(Json.c_str());
+    }
+
+    void MemoryTracker::LogReport() const
+    {
+        TArray<MemoryTagStats> AllStats;
+        GetAllTagStats(AllStats);
+
+        char Line[256];
+        std::snprintf(Line, sizeof(Line), "Memory frame %llu - %lld allocations last frame",
+            static_cast<unsigned long long>(m_FrameNumber), static_cast<long long>(m_FrameAllocations));
+        Utils::Get().LogInfo(FString(Line));
+
+        for (const MemoryTagStats& Stats : AllStats)
+        {
+            std::snprintf(Line, sizeof(Line), "  %-12s live %10.1f KB (peak %10.1f KB) in %lld allocations, last frame %lld, %.1f/s, %.1f KB/s",
+                *Stats.Name, Stats.LiveBytes / 1024.0, Stats.PeakBytes / 1024.0, static_cast<long long>(Stats.LiveAllocations),
+                static_cast<long long>(Stats.FrameAllocations), Stats.AllocationsPerSecond, Stats.BytesPerSecond / 1024.0);
+            Utils::Get().LogInfo(FString(Line));
+        }
+    }
+
+    void MemoryTracker::SampleStack(EMemoryTag Tag, int64 SampleCount)
+    {
+        StackEntry Entry;
+        Entry.Tag = Tag;
+        Entry.FrameCount = CaptureStack(Entry.Frames, MaxStackFrames);
+        Entry.SampleCount = SampleCount;
+        uint64 Hash = HashStack(Tag, Entry.Frames, Entry.FrameCount);
+
+        std::lock_guard<std::mutex> Lock(m_SampleMutex);
+        auto It = m_StackSamples.find(Hash);
+        if (It != m_StackSamples.end())
+        {
+            It->second.SampleCount += SampleCount;
+        }
+        else if (static_cast<int32>(m_StackSamples.size()) < MaxStackSamples)
+        {
+            m_StackSamples.emplace(Hash, Entry);
+        }
+        else
+        {
+            m_DroppedStackSamples += SampleCount;
+        }
+    }
+
+    void MemoryTracker::GetTopStackSamples(EMemoryTag Tag, int32 MaxCount, TArray<MemoryStackSample>& OutSamples) const
+    {
+        std::vector<StackEntry> Entries;
+        {
+            std::lock_guard<std::mutex> Lock(m_SampleMutex);
+            for (const auto& Pair : m_StackSamples)
+            {
+                if (Pair.second.Tag == Tag)
+                {
+                    Entries.push_back(Pair.second);
+                }
+            }
+        }
+
+        std::sort(Entries.begin(), Entries.end(), [](const StackEntry& A, const StackEntry& B) { return A.SampleCount > B.SampleCount; });
+        if (static_cast<int32>(Entries.size()) > MaxCount)
+        {
+            Entries.resize(static_cast<std::size_t>(std::max(0, MaxCount)));
+        }
+
+        OutSamples.Empty();
+        int64 Interval = GetSampleInterval();
+        for (const StackEntry& Entry : Entries)
+        {
+            MemoryStackSample& Sample = OutSamples.Emplace();
+            Sample.Tag = Entry.Tag;
+            Sample.SampleCount = Entry.SampleCount;
+            Sample.EstimatedBytes = Entry.SampleCount * Interval;
+
+#if UE4SDK_MEMORY_STACKS && !defined(_WIN32)
+            char** Symbols = backtrace_symbols(Entry.Frames, Entry.FrameCount);
+            for (int32 i = 0; i < Entry.FrameCount; ++i)
+            {
+                if (Symbols)
+                {
+                    Sample.Frames.Add(FString(Symbols[i]));
+                    continue;
+                }
+
+                char Address[32];
+                std::snprintf(Address, sizeof(Address), "%p", Entry.Frames[i]);
+                Sample.Frames.Add(FString(Address));
+            }
+            std::free(Symbols);
+#else
+            for (int32 i = 0; i < Entry.FrameCount; ++i)
+            {
+                char Address[32];
+                std::snprintf(Address, sizeof(Address), "%p", Entry.Frames[i]);
+                Sample.Frames.Add(FString(Address));
+            }
+#endif
+        }
+    }
+
+    int64 MemoryTracker::GetDroppedStackSamples() const
+    {
+        std::lock_guard<std::mutex> Lock(m_SampleMutex);
+        return m_DroppedStackSamples;
+    }
+
+    void MemoryTracker::ClearStackSamples()
+    {
+        std::lock_guard<std::mutex> Lock(m_SampleMutex);
+        m_StackSamples.clear();
+        m_DroppedStackSamples = 0;
+    }
+}
@@ -0,0 +1,226 @@
+/*
+ * UE4 Memory Tracker - Self-contained per-subsystem memory accounting
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "Stats.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace UE4SDK
+{
+    const char* GetMemoryTagName(EMemoryTag Tag);
+
+    // Merged view of one tag, as of the last EndFrame or report call
+    struct MemoryTagStats
+    {
+        EMemoryTag Tag = EMemoryTag::Default;
+        FString Name;
+
+        int64 LiveBytes = 0;
+        int64 PeakBytes = 0;            // Highest LiveBytes seen at a merge, not an exact high-water mark
+        int64 LiveAllocations = 0;
+        int64 TotalAllocations = 0;     // Since startup
+        int64 TotalBytes = 0;
+
+        // Last completed frame, and smoothed over recent frames
+        int64 FrameAllocations = 0;
+        int64 FrameBytes = 0;
+        double AllocationsPerSecond = 0.0;
+        double BytesPerSecond = 0.0;
+    };
+
+    // One sampled call stack - each sample stands for roughly one sample interval of allocated bytes
+    struct MemoryStackSample
+    {
+        EMemoryTag Tag = EMemoryTag::Default;
+        int64 SampleCount = 0;
+        int64 EstimatedBytes = 0;
+        TArray<FString> Frames;         // Symbolised where the platform can, raw addresses otherwise
+    };
+
+    // Per-thread counters - only the owning thread writes them, merges and reports read them.
+    // The shared shard takes allocations from threads that already released theirs, and is the
+    // only one updated with read-modify-writes.
+    class MemoryThreadShard
+    {
+    public:
+        explicit MemoryThreadShard(bool bShared);
+
+        void Add(std::atomic<int64>& Counter, int64 Delta)
+        {
+            if (m_bShared)
+            {
+                Counter.fetch_add(Delta, std::memory_order_relaxed);
+            }
+            else
+            {
+                Counter.store(Counter.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        friend class MemoryTracker;
+
+        static constexpr int32 TagCount = static_cast<int32>(EMemoryTag::Count);
+
+        // Cumulative, so a reused shard just keeps adding
+        std::atomic<int64> m_AllocatedBytes[TagCount];
+        std::atomic<int64> m_FreedBytes[TagCount];
+        std::atomic<int64> m_Allocations[TagCount];
+        std::atomic<int64> m_Frees[TagCount];
+
+        // Stack sampling - owner only
+        int64 m_BytesUntilSample;
+        uint64 m_RandomState;
+
+        const bool m_bShared;
+        bool m_bRetired; // Owning thread exited, the next new thread takes the shard over
+    };
+
+    // MemoryTracker - counts live bytes, peaks and allocation rates per EMemoryTag.
+    // TArray, TMap, TSet and UObject allocations report here; the counters are thread-local so the
+    // cost per allocation is a few relaxed stores, plus a call-stack capture once per sample interval.
+    class MemoryTracker
+    {
+    public:
+        static constexpr int32 TagCount = static_cast<int32>(EMemoryTag::Count);
+        static constexpr int32 MaxStackFrames = 16;
+        static constexpr int32 MaxStackSamples = 4096; // Distinct stacks kept, later ones are counted as dropped
+
+        static MemoryTracker& Get();
+
+        // Recording - safe from any thread, the containers and UObject call these
+        static void RecordAllocation(EMemoryTag Tag, int64 Size);
+        static void RecordFree(EMemoryTag Tag, int64 Size);
+
+        // Call once per frame from the game thread - merges the shards and updates the frame counts and rates
+        void EndFrame(float DeltaTime);
+        uint64 GetFrameNumber() const { return m_FrameNumber; }
+        int64 GetFrameAllocationCount() const { return m_FrameAllocations; } // All tags, last completed frame
+
+        // Warns when a frame allocates more than Count times, 0 turns it off
+        void SetFrameAllocationBudget(int64 Count) { m_FrameAllocationBudget = Count; }
+        int64 GetFrameAllocationBudget() const { return m_FrameAllocationBudget; }
+
+        // Reports - each call merges the shards first, so live bytes are current
+        MemoryTagStats GetTagStats(EMemoryTag Tag) const;
+        void GetAllTagStats(TArray<MemoryTagStats>& OutStats) const;
+        int64 GetTotalLiveBytes() const;
+        FString GetReportJson() const;
+        void LogReport() const;
+
+        // Call-stack sampling - about one stack per Bytes allocated on each thread, 0 turns it off
+        static void SetSampleInterval(int64 Bytes);
+        static int64 GetSampleInterval() { return s_SampleInterval.load(std::memory_order_relaxed); }
+        void GetTopStackSamples(EMemoryTag Tag, int32 MaxCount, TArray<MemoryStackSample>& OutSamples) const;
+        int64 GetDroppedStackSamples() const;
+        void ClearStackSamples();
+
+        // Threads
+        void RetireThreadShard(MemoryThreadShard& Shard); // Called on thread exit, frees the shard for reuse
+
+    private:
+        MemoryTracker();
+        ~MemoryTracker() = default;
+
+        MemoryTracker(const MemoryTracker&) = delete;
+        MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+        // Counter totals over every shard
+        struct TagTotals
+        {
+            int64 AllocatedBytes = 0;
+            int64 FreedBytes = 0;
+            int64 Allocations = 0;
+            int64 Frees = 0;
+        };
+
+        struct StackEntry
+        {
+            EMemoryTag Tag;
+            int32 FrameCount;
+            void* Frames[MaxStackFrames];
+            int64 SampleCount;
+        };
+
+        // Shards - never freed. Nothing in here may allocate through a tracked container, or a
+        // thread's first allocation would recurse into its own registration.
+        mutable std::mutex m_ShardMutex;
+        std::vector<std::unique_ptr<MemoryThreadShard>> m_Shards;
+        std::unique_ptr<MemoryThreadShard> m_SharedShard;
+
+        // Merged state
+        mutable std::mutex m_StateMutex;
+        mutable int64 m_PeakBytes[TagCount];
+        TagTotals m_FrameStart[TagCount];
+        int64 m_FrameAllocationsByTag[TagCount];
+        int64 m_FrameBytesByTag[TagCount];
+        double m_AllocationsPerSecond[TagCount];
+        double m_BytesPerSecond[TagCount];
+        uint64 m_FrameNumber;
+        int64 m_FrameAllocations;
+        int64 m_FrameAllocationBudget;
+        float m_TimeSinceBudgetWarning;
+
+        // Stats registry gauges, registered on the first EndFrame
+        bool m_bStatsRegistered;
+        StatId m_LiveBytesStats[TagCount];
+        StatId m_FrameAllocationsStat;
+
+        // Stack samples keyed by a hash of the tag and frames
+        mutable std::mutex m_SampleMutex;
+        std::unordered_map<uint64, StackEntry> m_StackSamples;
+        int64 m_DroppedStackSamples;
+
+        // Helper functions
+        MemoryThreadShard& AcquireThreadShard();
+        void SumShards(TagTotals* OutTotals) const;
+        void MergeTag(EMemoryTag Tag, const TagTotals& Totals, MemoryTagStats& OutStats) const;
+        void SampleStack(EMemoryTag Tag, int64 SampleCount);
+
+        static MemoryThreadShard& GetThreadShard()
+        {
+            MemoryThreadShard* Shard = t_Shard;
+            return Shard ? *Shard : Get().AcquireThreadShard();
+        }
+
+        static int64 NextSampleDistance(MemoryThreadShard& Shard);
+
+        static std::atomic<int64> s_SampleInterval;
+        static thread_local MemoryThreadShard* t_Shard;
+    };
+
+    // Charges every tracked allocation made on this thread while it's alive to one tag
+    class MemoryTagScope
+    {
+    public:
+        explicit MemoryTagScope(EMemoryTag Tag) : m_PreviousTag(t_MemoryTag) { t_MemoryTag = Tag; }
+        ~MemoryTagScope() { t_MemoryTag = m_PreviousTag; }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    private:
+        EMemoryTag m_PreviousTag;
+    };
+}
+
+// Global access macros
+#define MEMORY_TRACKER UE4SDK::MemoryTracker::Get()
+#define MEMORY_END_FRAME(DeltaTime) UE4SDK::MemoryTracker::Get().EndFrame(DeltaTime)
+
+#define UE4SDK_MEMORY_CONCAT_INNER(A, B) A##B
+#define UE4SDK_MEMORY_CONCAT(A, B) UE4SDK_MEMORY_CONCAT_INNER(A, B)
+
+#if UE4SDK_ENABLE_MEMORY_TRACKING
+    #define MEMORY_TAG_SCOPE(Tag) UE4SDK::MemoryTagScope UE4SDK_MEMORY_CONCAT(MemoryTagScope_, __LINE__)(UE4SDK::EMemoryTag::Tag)
+#else
+    #define MEMORY_TAG_SCOPE(Tag)
+#endif
@@ -5,6 +5,7 @@
 
 #include "Navigation.h"
 #include "Utils.h"
+#include "MemoryTracker.h"
 #include <algorithm>
 
 namespace UE4SDK
@@ -104,6 +105,7 @@ namespace UE4SDK
 
     void NavMesh::AddNavMeshPolygon(const NavMeshPolygon& Polygon)
     {
+        MEMORY_TAG_SCOPE(Navigation);
         m_Polygons.Add(Polygon);
     }
 
@@ -166,7 +168,7 @@ namespace UE4SDK
     {
         // Simulate navmesh building
         m_bIsValid = true;
-        Utils::Get().LogInfo(TEXT("NavMesh built: ") + m_MeshName + TEXT(" with ") + FString::FromInt(m_Polygons.Num()) + TEXT(" polygons"));
+        LOG_INFO(TEXT("NavMesh built: ") + m_MeshName + TEXT(" with ") + FString::FromInt(m_Polygons.Num()) + TEXT(" polygons"));
     }
 
     void NavMesh::RebuildNavMesh()
@@ -691,7 +693,7 @@ namespace UE4SDK
         if (Mesh && !m_NavMeshes.Contains(Mesh))
         {
             m_NavMeshes.Add(Mesh);
-            Utils::Get().LogInfo(TEXT("NavMesh registered: ") + Mesh->GetMeshName());
+            LOG_INFO(TEXT("NavMesh registered: ") + Mesh->GetMeshName());
         }
     }
 
@@ -700,7 +702,7 @@ namespace UE4SDK
         if (Mesh)
         {
             m_NavMeshes.Remove(Mesh);
-            Utils::Get().LogInfo(TEXT("NavMesh unregistered: ") + Mesh->GetMeshName());
+            LOG_INFO(TEXT("NavMesh unregistered: ") + Mesh->GetMeshName());
         }
     }
 
@@ -709,7 +711,7 @@ namespace UE4SDK
         if (Path && !m_NavPaths.Contains(Path))
         {
             m_NavPaths.Add(Path);
-            Utils::Get().LogInfo(TEXT("NavPath registered: ") + Path->GetPathName());
+            LOG_INFO(TEXT("NavPath registered: ") + Path->GetPathName());
         }
     }
 
@@ -718,7 +720,7 @@ namespace UE4SDK
         if (Path)
         {
             m_NavPaths.Remove(Path);
-            Utils::Get().LogInfo(TEXT("NavPath unregistered: ") + Path->GetPathName());
+            LOG_INFO(TEXT("NavPath unregistered: ") + Path->GetPathName());
         }
     }
 
@@ -727,7 +729,7 @@ namespace UE4SDK
         if (Filter && !m_QueryFilters.Contains(Filter))
         {
             m_QueryFilters.Add(Filter);
-            Utils::Get().LogInfo(TEXT("NavQueryFilter registered: ") + Filter->GetFilterName());
+            LOG_INFO(TEXT("NavQueryFilter registered: ") + Filter->GetFilterName());
         }
     }
 
@@ -736,7 +738,7 @@ namespace UE4SDK
         if (Filter)
         {
             m_QueryFilters.Remove(Filter);
-            Utils::Get().LogInfo(TEXT("NavQueryFilter unregistered: ") + Filter->GetFilterName());
+            LOG_INFO(TEXT("NavQueryFilter unregistered: ") + Filter->GetFilterName());
         }
     }
 
@@ -793,6 +795,7 @@ namespace UE4SDK
 
     NavPath* NavigationSystem::FindPath(const FVector& Start, const FVector& End, NavQueryFilter* Filter)
     {
+        MEMORY_TAG_SCOPE(Navigation);
         if (!m_bIsInitialized)
         {
             return nullptr;
@@ -822,11 +825,11 @@ namespace UE4SDK
         if (bValidPath)
         {
             RegisterNavPath(Path);
-            Utils::Get().LogInfo(TEXT("Path found from ") + Start.ToString() + TEXT(" to ") + End.ToString());
+            LOG_INFO(TEXT("Path found from ") + Start.ToString() + TEXT(" to ") + End.ToString());
         }
         else
         {
-            Utils::Get().LogWarning(TEXT("Path not found from ") + Start.ToString() + TEXT(" to ") + End.ToString());
+            LOG_WARNING(TEXT("Path not found from ") + Start.ToString() + TEXT(" to ") + End.ToString());
         }
         
         return Path;
@@ -891,6 +894,7 @@ namespace UE4SDK
     {
         if (!s_Instance)
         {
+            MEMORY_TAG_SCOPE(Navigation);
             s_Instance = new NavigationSystemManager();
         }
         return *s_Instance;
@@ -945,6 +949,7 @@ namespace UE4SDK
 
     NavigationSystem* NavigationSystemManager::CreateNavigationSystem(const FString& SystemName)
     {
+        MEMORY_TAG_SCOPE(Navigation);
         auto NewSystem = std::make_unique<NavigationSystem>();
         NewSystem->SetSystemName(SystemName);
         NewSystem->Initialize();
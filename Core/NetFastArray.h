@@ -0,0 +1,342 @@
+/*
+ * UE4 Net Fast Array - Self-contained element-level delta replication for arrays
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "NetSerialization.h"
+#include <functional>
+
+namespace UE4SDK
+{
+    // Fast array - a replicated array that only sends the elements that were added, changed or removed.
+    // Every element gets a replication ID when it's added and a key that's bumped whenever it changes.
+    // A connection's shadow is just the ID/key list it was last sent, so tracking costs a few bytes per element.
+    // Register with ReplicationInfo::AddFastArrayProperty. Deltas are written against what was sent; when the
+    // transport reports an unreliable packet lost, the shadow its delta was diffed against is merged back in,
+    // so the next delta repeats whatever removals and changes went missing.
+    template<typename T>
+    class TFastArray
+    {
+    public:
+        // Server side - every change bumps the element's key and marks the property dirty
+        int32 Add(const T& Value)
+        {
+            // IDs only grow, so appending keeps the elements sorted by ID
+            Element& NewElement = m_Elements.Emplace();
+            NewElement.ReplicationID = m_NextReplicationID++;
+            NewElement.ReplicationKey = 1;
+            NewElement.Value = Value;
+            MarkArrayDirty();
+            return NewElement.ReplicationID;
+        }
+
+        bool Remove(int32 ReplicationID)
+        {
+            int32 Index = FindIndex(ReplicationID);
+            if (Index < 0)
+            {
+                return false;
+            }
+
+            m_Elements.RemoveAt(Index);
+            MarkArrayDirty();
+            return true;
+        }
+
+        // Element for writing - marks it changed, so only call it for elements that are actually being edited
+        T* Edit(int32 ReplicationID)
+        {
+            int32 Index = FindIndex(ReplicationID);
+            if (Index < 0)
+            {
+                return nullptr;
+            }
+
+            m_Elements[Index].ReplicationKey++;
+            MarkArrayDirty();
+            return &m_Elements[Index].Value;
+        }
+
+        void Empty()
+        {
+            if (m_Elements.Num() > 0)
+            {
+                m_Elements.Empty();
+                MarkArrayDirty();
+            }
+        }
+
+        // Access - elements are kept in replication ID order on both sides
+        int32 Num() const { return m_Elements.Num(); }
+        const T& Get(int32 Index) const { return m_Elements[Index].Value; }
+        int32 GetReplicationID(int32 Index) const { return m_Elements[Index].ReplicationID; }
+
+        const T* Find(int32 ReplicationID) const
+        {
+            int32 Index = FindIndex(ReplicationID);
+            return Index >= 0 ? &m_Elements[Index].Value : nullptr;
+        }
+
+        int32 FindIndex(int32 ReplicationID) const
+        {
+            int32 Index = LowerBound(ReplicationID);
+            return Index < m_Elements.Num() && m_Elements[Index].ReplicationID == ReplicationID ? Index : -1;
+        }
+
+        // Client side events, fired as a received delta is applied. Removed fires before the element goes away.
+        void SetOnItemAddedCallback(std::function<void(int32, const T&)> Callback) { m_OnItemAddedCallback = Callback; }
+        void SetOnItemChangedCallback(std::function<void(int32, const T&)> Callback) { m_OnItemChangedCallback = Callback; }
+        void SetOnItemRemovedCallback(std::function<void(int32, const T&)> Callback) { m_OnItemRemovedCallback = Callback; }
+
+        // Replication hooks - set up by ReplicationInfo::AddFastArrayProperty
+        void SetOnDirtyCallback(std::function<void()> Callback) { m_OnDirtyCallback = Callback; }
+
+        // State is the ID/key list. Writing it also refreshes the cached bits of changed elements,
+        // so it runs once per frame on the game thread and every connection's delta shares the cache.
+        void SerializeState(FBitWriter& Writer)
+        {
+            Writer.WriteVarUInt(static_cast<uint32>(m_Elements.Num()));
+            for (Element& Entry : m_Elements)
+            {
+                Writer.WriteVarUInt(static_cast<uint32>(Entry.ReplicationID));
+                Writer.WriteVarUInt(static_cast<uint32>(Entry.ReplicationKey));
+
+                if (Entry.CachedKey != Entry.ReplicationKey)
+                {
+                    Entry.CachedValue.Reset();
+                    NetSerialize(Entry.CachedValue, Entry.Value);
+                    Entry.CachedKey = Entry.ReplicationKey;
+                }
+            }
+        }
+
+        // Delta layout: RemovedCount | ID gaps | ChangedCount | per element: ID gap, value bits.
+        // Only reads the array and its cache, so connections can write deltas in parallel.
+        void SerializeDelta(const FBitWriter& ShadowState, FBitWriter& Writer) const
+        {
+            FBitReader Shadow(ShadowState.GetData(), ShadowState.GetNumBits());
+            uint32 ShadowCount = ShadowState.GetNumBits() > 0 ? Shadow.ReadVarUInt() : 0;
+
+            // Both lists are in ID order, so one merge walk finds everything
+            TArray<int32> Removed;
+            TArray<int32> Changed; // Element indices
+            int32 Index = 0;
+            for (uint32 i = 0; i < ShadowCount && !Shadow.IsError(); ++i)
+            {
+                int32 ShadowID = static_cast<int32>(Shadow.ReadVarUInt());
+                int32 ShadowKey = static_cast<int32>(Shadow.ReadVarUInt());
+
+                while (Index < m_Elements.Num() && m_Elements[Index].ReplicationID < ShadowID)
+                {
+                    Changed.Add(Index++);
+                }
+
+                if (Index < m_Elements.Num() && m_Elements[Index].ReplicationID == ShadowID)
+                {
+                    if (m_Elements[Index].ReplicationKey != ShadowKey)
+                    {
+                        Changed.Add(Index);
+                    }
+                    Index++;
+                }
+                else
+                {
+                    Removed.Add(ShadowID);
+                }
+            }
+            while (Index < m_Elements.Num())
+            {
+                Changed.Add(Index++);
+            }
+
+            int32 PreviousID = 0;
+            Writer.WriteVarUInt(static_cast<uint32>(Removed.Num()));
+            for (int32 ReplicationID : Removed)
+            {
+                Writer.WriteVarUInt(static_cast<uint32>(ReplicationID - PreviousID));
+                PreviousID = ReplicationID;
+            }
+
+            PreviousID = 0;
+            Writer.WriteVarUInt(static_cast<uint32>(Changed.Num()));
+            for (int32 ChangedIndex : Changed)
+            {
+                const Element& Entry = m_Elements[ChangedIndex];
+                Writer.WriteVarUInt(static_cast<uint32>(Entry.ReplicationID - PreviousID));
+                Writer.WriteBits(Entry.CachedValue);
+                PreviousID = Entry.ReplicationID;
+            }
+        }
+
+        // Rollback for a lost delta written against LostBase. Keeps every ID from both lists and zeroes the key
+        // wherever they disagree - keys start at 1, so those elements are resent and lost removals go out again.
+        static void MergeLostShadow(const FBitWriter& LostBase, FBitWriter& ShadowState)
+        {
+            FBitReader Base(LostBase.GetData(), LostBase.GetNumBits());
+            FBitReader Shadow(ShadowState.GetData(), ShadowState.GetNumBits());
+            uint32 BaseLeft = LostBase.GetNumBits() > 0 ? Base.ReadVarUInt() : 0;
+            uint32 ShadowLeft = ShadowState.GetNumBits() > 0 ? Shadow.ReadVarUInt() : 0;
+
+            auto ReadEntry = [](FBitReader& Reader, uint32& Left, int32& ID, int32& Key)
+            {
+                if (Left == 0 || Reader.IsError())
+                {
+                    return false;
+                }
+                Left--;
+                ID = static_cast<int32>(Reader.ReadVarUInt());
+                Key = static_cast<int32>(Reader.ReadVarUInt());
+                return true;
+            };
+
+            TArray<int32> Merged; // ID, key pairs in ID order
+            int32 BaseID = 0, BaseKey = 0, ShadowID = 0, ShadowKey = 0;
+            bool bHaveBase = ReadEntry(Base, BaseLeft, BaseID, BaseKey);
+            bool bHaveShadow = ReadEntry(Shadow, ShadowLeft, ShadowID, ShadowKey);
+            while (bHaveBase || bHaveShadow)
+            {
+                if (bHaveBase && bHaveShadow && BaseID == ShadowID)
+                {
+                    Merged.Add(BaseID);
+                    Merged.Add(BaseKey == ShadowKey ? ShadowKey : 0);
+                    bHaveBase = ReadEntry(Base, BaseLeft, BaseID, BaseKey);
+                    bHaveShadow = ReadEntry(Shadow, ShadowLeft, ShadowID, ShadowKey);
+                }
+                else if (bHaveBase && (!bHaveShadow || BaseID < ShadowID))
+                {
+                    Merged.Add(BaseID);
+                    Merged.Add(0);
+                    bHaveBase = ReadEntry(Base, BaseLeft, BaseID, BaseKey);
+                }
+                else
+                {
+                    Merged.Add(ShadowID);
+                    Merged.Add(0);
+                    bHaveShadow = ReadEntry(Shadow, ShadowLeft, ShadowID, ShadowKey);
+                }
+            }
+
+            ShadowState.Reset();
+            ShadowState.WriteVarUInt(static_cast<uint32>(Merged.Num() / 2));
+            for (int32 Value : Merged)
+            {
+                ShadowState.WriteVarUInt(static_cast<uint32>(Value));
+            }
+        }
+
+        bool DeserializeDelta(FBitReader& Reader)
+        {
+            // Every entry takes at least a byte, so a count past that is a malformed packet
+            uint32 RemovedCount = Reader.ReadVarUInt();
+            if (Reader.IsError() || RemovedCount > static_cast<uint32>(Reader.GetBitsLeft() / 8))
+            {
+                Reader.SetError();
+                return false;
+            }
+
+            int32 ReplicationID = 0;
+            for (uint32 i = 0; i < RemovedCount; ++i)
+            {
+                ReplicationID += static_cast<int32>(Reader.ReadVarUInt());
+                int32 Index = FindIndex(ReplicationID);
+                if (Index >= 0)
+                {
+                    if (m_OnItemRemovedCallback)
+                    {
+                        m_OnItemRemovedCallback(ReplicationID, m_Elements[Index].Value);
+                    }
+                    m_Elements.RemoveAt(Index);
+                }
+            }
+
+            uint32 ChangedCount = Reader.ReadVarUInt();
+            if (Reader.IsError() || ChangedCount > static_cast<uint32>(Reader.GetBitsLeft() / 8))
+            {
+                Reader.SetError();
+                return false;
+            }
+
+            ReplicationID = 0;
+            for (uint32 i = 0; i < ChangedCount; ++i)
+            {
+                ReplicationID += static_cast<int32>(Reader.ReadVarUInt());
+                T Value;
+                if (!NetDeserialize(Reader, Value))
+                {
+                    return false;
+                }
+
+                // A lost add can turn up later as a change, so new elements are inserted in ID order
+                int32 Index = LowerBound(ReplicationID);
+                if (Index < m_Elements.Num() && m_Elements[Index].ReplicationID == ReplicationID)
+                {
+                    m_Elements[Index].Value = std::move(Value);
+                    if (m_OnItemChangedCallback)
+                    {
+                        m_OnItemChangedCallback(ReplicationID, m_Elements[Index].Value);
+                    }
+                    continue;
+                }
+
+                Element NewElement;
+                NewElement.ReplicationID = ReplicationID;
+                NewElement.Value = std::move(Value);
+                Element& Inserted = m_Elements.Insert(std::move(NewElement), Index);
+                if (m_OnItemAddedCallback)
+                {
+                    m_OnItemAddedCallback(ReplicationID, Inserted.Value);
+                }
+            }
+
+            return !Reader.IsError();
+        }
+
+    private:
+        struct Element
+        {
+            int32 ReplicationID = 0;
+            int32 ReplicationKey = 0;
+            T Value = T();
+            FBitWriter CachedValue;
+            int32 CachedKey = 0; // Key the cached bits were written at, 0 = never
+        };
+
+        TArray<Element> m_Elements;
+        int32 m_NextReplicationID = 1;
+
+        std::function<void()> m_OnDirtyCallback;
+        std::function<void(int32, const T&)> m_OnItemAddedCallback;
+        std::function<void(int32, const T&)> m_OnItemChangedCallback;
+        std::function<void(int32, const T&)> m_OnItemRemovedCallback;
+
+        void MarkArrayDirty()
+        {
+            if (m_OnDirtyCallback)
+            {
+                m_OnDirtyCallback();
+            }
+        }
+
+        int32 LowerBound(int32 ReplicationID) const
+        {
+            int32 Low = 0;
+            int32 High = m_Elements.Num();
+            while (Low < High)
+            {
+                int32 Mid = (Low + High) / 2;
+                if (m_Elements[Mid].ReplicationID < ReplicationID)
+                {
+                    Low = Mid + 1;
+                }
+                else
+                {
+                    High = Mid;
+                }
+            }
+            return Low;
+        }
+    };
+}
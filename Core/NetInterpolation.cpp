@@ -0,0 +1,377 @@
+/*
+ * UE4 Net Interpolation Implementation - Self-contained client-side smoothing implementation
+ * Vibe coder approved ✨
+ */
+
+#include "NetInterpolation.h"
+#include "Replication.h"
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        constexpr int32 ProxyBatchSize = 256;
+
+        // Per-proxy evaluation state
+        constexpr uint8 StateInterpolating = 0;
+        constexpr uint8 StateExtrapolating = 1;
+        constexpr uint8 StateStarved = 2; // Past MaxExtrapolationTime, holding the furthest predicted point
+    }
+
+    NetInterpolation::NetInterpolation()
+        : m_Time(0.0)
+        , m_ActiveCount(0)
+        , m_InterpolatingCount(0)
+        , m_ExtrapolatingCount(0)
+        , m_StarvedCount(0)
+    {
+    }
+
+    int32 NetInterpolation::AddProxy()
+    {
+        int32 ProxyID;
+        if (m_FreeProxies.Num() > 0)
+        {
+            ProxyID = m_FreeProxies[m_FreeProxies.Num() - 1];
+            m_FreeProxies.RemoveAt(m_FreeProxies.Num() - 1);
+        }
+        else
+        {
+            ProxyID = m_Active.Num();
+            GrowProxies(ProxyID + 1);
+        }
+
+        m_Active[ProxyID] = 1;
+        m_Heads[ProxyID] = 0;
+        m_Counts[ProxyID] = 0;
+        m_Extrapolating[ProxyID] = StateInterpolating;
+
+        // Identity until the first snapshot arrives
+        m_OutPositionX[ProxyID] = m_OutPositionY[ProxyID] = m_OutPositionZ[ProxyID] = 0.0f;
+        m_OutRotationX[ProxyID] = m_OutRotationY[ProxyID] = m_OutRotationZ[ProxyID] = 0.0f;
+        m_OutRotationW[ProxyID] = 1.0f;
+        m_OutScaleX[ProxyID] = m_OutScaleY[ProxyID] = m_OutScaleZ[ProxyID] = 1.0f;
+
+        m_ActiveCount++;
+        return ProxyID;
+    }
+
+    int32 NetInterpolation::AddProxy(ReplicationInfo* Info, const FString& PropertyName, const FTransform* Transform)
+    {
+        int32 ProxyID = AddProxy();
+        if (!Info || !Transform)
+        {
+            return ProxyID;
+        }
+
+        // Chain onto whatever was listening before, so gameplay callbacks keep working
+        std::function<void(const FString&)> Previous = Info->GetOnReplicationReceivedCallback();
+        Info->SetOnReplicationReceivedCallback([this, ProxyID, PropertyName, Transform, Previous](const FString& Received)
+        {
+            if (Received == PropertyName && IsValidProxy(ProxyID))
+            {
+                AddSnapshot(ProxyID, *Transform);
+            }
+            if (Previous)
+            {
+                Previous(Received);
+            }
+        });
+        return ProxyID;
+    }
+
+    void NetInterpolation::RemoveProxy(int32 ProxyID)
+    {
+        if (!IsValidProxy(ProxyID))
+        {
+            return;
+        }
+
+        m_Active[ProxyID] = 0;
+        m_Counts[ProxyID] = 0;
+        m_FreeProxies.Add(ProxyID);
+        m_ActiveCount--;
+    }
+
+    void NetInterpolation::ResetProxy(int32 ProxyID)
+    {
+        if (IsValidProxy(ProxyID))
+        {
+            m_Counts[ProxyID] = 0;
+            m_Extrapolating[ProxyID] = StateInterpolating;
+        }
+    }
+
+    bool NetInterpolation::IsValidProxy(int32 ProxyID) const
+    {
+        return ProxyID >= 0 && ProxyID < m_Active.Num() && m_Active[ProxyID] != 0;
+    }
+
+    void NetInterpolation::AddSnapshot(int32 ProxyID, double Time, const FTransform& Transform)
+    {
+        if (!IsValidProxy(ProxyID))
+        {
+            return;
+        }
+
+        int32 Base = ProxyID * SnapshotCapacity;
+        int32& Head = m_Heads[ProxyID];
+        int32& Count = m_Counts[ProxyID];
+
+        if (Count > 0)
+        {
+            double NewestTime = m_SnapshotTimes[Base + Head];
+            if (Time < NewestTime)
+            {
+                // Older than what's buffered, the proxy has already moved past it
+                return;
+            }
+            if (Time == NewestTime)
+            {
+                // Several updates in one frame, only the latest matters
+                WriteSlot(Base + Head, Time, Transform);
+                return;
+            }
+        }
+
+        Head = (Head + 1) % SnapshotCapacity;
+        Count = std::min(Count + 1, SnapshotCapacity);
+        WriteSlot(Base + Head, Time, Transform);
+    }
+
+    void NetInterpolation::Update(float DeltaTime)
+    {
+        m_Time += DeltaTime;
+        Evaluate(GetRenderTime());
+    }
+
+    void NetInterpolation::Evaluate(double RenderTime)
+    {
+        int32 ProxyCount = m_Active.Num();
+        JobSystem::Get().ParallelFor(ProxyCount, ProxyBatchSize, [this, RenderTime](int32 Begin, int32 End)
+        {
+            SampleRange(Begin, End, RenderTime);
+            BlendRange(Begin, End);
+        });
+
+        m_InterpolatingCount = 0;
+        m_ExtrapolatingCount = 0;
+        m_StarvedCount = 0;
+        for (int32 i = 0; i < ProxyCount; ++i)
+        {
+            if (m_From[i] < 0)
+            {
+                continue;
+            }
+
+            switch (m_Extrapolating[i])
+            {
+            case StateExtrapolating: m_ExtrapolatingCount++; break;
+            case StateStarved: m_StarvedCount++; break;
+            default: m_InterpolatingCount++; break;
+            }
+
+            if (m_OnProxyUpdatedCallback)
+            {
+                m_OnProxyUpdatedCallback(i, GetTransform(i));
+            }
+        }
+    }
+
+    FTransform NetInterpolation::GetTransform(int32 ProxyID) const
+    {
+        if (!IsValidProxy(ProxyID))
+        {
+            return FTransform::Identity;
+        }
+
+        return FTransform(FQuat(m_OutRotationX[ProxyID], m_OutRotationY[ProxyID], m_OutRotationZ[ProxyID], m_OutRotationW[ProxyID]),
+                          FVector(m_OutPositionX[ProxyID], m_OutPositionY[ProxyID], m_OutPositionZ[ProxyID]),
+                          FVector(m_OutScaleX[ProxyID], m_OutScaleY[ProxyID], m_OutScaleZ[ProxyID]));
+    }
+
+    // Helper functions
+    void NetInterpolation::GrowProxies(int32 NewCount)
+    {
+        m_Active.SetNum(NewCount, 0);
+        m_Heads.SetNum(NewCount, 0);
+        m_Counts.SetNum(NewCount, 0);
+
+        int32 SlotCount = NewCount * SnapshotCapacity;
+        m_SnapshotTimes.SetNum(SlotCount, 0.0);
+        for (TArray<float>* Column : { &m_PositionX, &m_PositionY, &m_PositionZ,
+                                       &m_RotationX, &m_RotationY, &m_RotationZ, &m_RotationW,
+                                       &m_ScaleX, &m_ScaleY, &m_ScaleZ })
+        {
+            Column->SetNum(SlotCount, 0.0f);
+        }
+
+        m_From.SetNum(NewCount, -1);
+        m_To.SetNum(NewCount, -1);
+        m_Alpha.SetNum(NewCount, 0.0f);
+        m_Extrapolating.SetNum(NewCount, StateInterpolating);
+        for (TArray<float>* Column : { &m_OutPositionX, &m_OutPositionY, &m_OutPositionZ,
+                                       &m_OutRotationX, &m_OutRotationY, &m_OutRotationZ, &m_OutRotationW,
+                                       &m_OutScaleX, &m_OutScaleY, &m_OutScaleZ })
+        {
+            Column->SetNum(NewCount, 0.0f);
+        }
+    }
+
+    void NetInterpolation::WriteSlot(int32 Slot, double Time, const FTransform& Transform)
+    {
+        m_SnapshotTimes[Slot] = Time;
+        m_PositionX[Slot] = Transform.Translation.X;
+        m_PositionY[Slot] = Transform.Translation.Y;
+        m_PositionZ[Slot] = Transform.Translation.Z;
+        m_RotationX[Slot] = Transform.Rotation.X;
+        m_RotationY[Slot] = Transform.Rotation.Y;
+        m_RotationZ[Slot] = Transform.Rotation.Z;
+        m_RotationW[Slot] = Transform.Rotation.W;
+        m_ScaleX[Slot] = Transform.Scale3D.X;
+        m_ScaleY[Slot] = Transform.Scale3D.Y;
+        m_ScaleZ[Slot] = Transform.Scale3D.Z;
+    }
+
+    void NetInterpolation::SampleRange(int32 Begin, int32 End, double RenderTime)
+    {
+        float TeleportDistanceSquared = m_Settings.TeleportDistance * m_Settings.TeleportDistance;
+
+        for (int32 i = Begin; i < End; ++i)
+        {
+            int32 Count = m_Counts[i];
+            if (m_Active[i] == 0 || Count == 0)
+            {
+                m_From[i] = -1;
+                continue;
+            }
+
+            int32 Base = i * SnapshotCapacity;
+            int32 Head = m_Heads[i];
+            int32 Newest = Base + Head;
+            m_Extrapolating[i] = StateInterpolating;
+
+            if (m_Settings.Mode == ENetSmoothingMode::Disabled || Count == 1)
+            {
+                m_From[i] = m_To[i] = Newest;
+                m_Alpha[i] = 0.0f;
+                continue;
+            }
+
+            int32 From;
+            int32 To;
+            float Alpha;
+            if (RenderTime >= m_SnapshotTimes[Newest])
+            {
+                // Ran out of snapshots - a late packet. Extrapolate along the last segment, bounded.
+                To = Newest;
+                From = Base + (Head + SnapshotCapacity - 1) % SnapshotCapacity;
+                Alpha = 0.0f;
+                if (m_Settings.Mode == ENetSmoothingMode::Extrapolate)
+                {
+                    double Overshoot = RenderTime - m_SnapshotTimes[Newest];
+                    m_Extrapolating[i] = Overshoot > m_Settings.MaxExtrapolationTime ? StateStarved : StateExtrapolating;
+                    Overshoot = std::min(Overshoot, static_cast<double>(m_Settings.MaxExtrapolationTime));
+
+                    double Segment = m_SnapshotTimes[To] - m_SnapshotTimes[From];
+                    Alpha = Segment > 0.0 ? static_cast<float>(1.0 + Overshoot / Segment) : 0.0f;
+                }
+                if (Alpha == 0.0f)
+                {
+                    From = To;
+                }
+            }
+            else
+            {
+                // Newest to oldest, the bracket is almost always the first or second step back
+                To = Newest;
+                From = Newest;
+                for (int32 Step = 1; Step < Count; ++Step)
+                {
+                    From = Base + (Head + SnapshotCapacity - Step) % SnapshotCapacity;
+                    if (m_SnapshotTimes[From] <= RenderTime)
+                    {
+                        break;
+                    }
+                    To = From;
+                }
+
+                double Segment = m_SnapshotTimes[To] - m_SnapshotTimes[From];
+                if (m_SnapshotTimes[From] > RenderTime || Segment <= 0.0)
+                {
+                    // Render time is before everything buffered, hold the oldest
+                    To = From;
+                    Alpha = 0.0f;
+                }
+                else
+                {
+                    Alpha = static_cast<float>((RenderTime - m_SnapshotTimes[From]) / Segment);
+                }
+            }
+
+            // Teleports snap to the newer snapshot instead of sliding across the map
+            float DeltaX = m_PositionX[To] - m_PositionX[From];
+            float DeltaY = m_PositionY[To] - m_PositionY[From];
+            float DeltaZ = m_PositionZ[To] - m_PositionZ[From];
+            if (DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ > TeleportDistanceSquared)
+            {
+                From = To;
+                Alpha = 0.0f;
+                m_Extrapolating[i] = StateInterpolating;
+            }
+
+            m_From[i] = From;
+            m_To[i] = To;
+            m_Alpha[i] = Alpha;
+        }
+    }
+
+    void NetInterpolation::BlendRange(int32 Begin, int32 End)
+    {
+        // Translation and scale are plain lerps over the component arrays
+        const int32* From = m_From.GetData();
+        const int32* To = m_To.GetData();
+        const float* Alpha = m_Alpha.GetData();
+
+        auto LerpColumn = [Begin, End, From, To, Alpha](const TArray<float>& Source, TArray<float>& Out)
+        {
+            const float* Values = Source.GetData();
+            float* Results = Out.GetData();
+            for (int32 i = Begin; i < End; ++i)
+            {
+                if (From[i] >= 0)
+                {
+                    float A = Values[From[i]];
+                    Results[i] = A + (Values[To[i]] - A) * Alpha[i];
+                }
+            }
+        };
+
+        LerpColumn(m_PositionX, m_OutPositionX);
+        LerpColumn(m_PositionY, m_OutPositionY);
+        LerpColumn(m_PositionZ, m_OutPositionZ);
+        LerpColumn(m_ScaleX, m_OutScaleX);
+        LerpColumn(m_ScaleY, m_OutScaleY);
+        LerpColumn(m_ScaleZ, m_OutScaleZ);
+
+        for (int32 i = Begin; i < End; ++i)
+        {
+            if (From[i] < 0)
+            {
+                continue;
+            }
+
+            int32 A = From[i];
+            int32 B = To[i];
+            FQuat Rotation = FQuat::Slerp(FQuat(m_RotationX[A], m_RotationY[A], m_RotationZ[A], m_RotationW[A]),
+                                          FQuat(m_RotationX[B], m_RotationY[B], m_RotationZ[B], m_RotationW[B]),
+                                          Alpha[i]);
+            m_OutRotationX[i] = Rotation.X;
+            m_OutRotationY[i] = Rotation.Y;
+            m_OutRotationZ[i] = Rotation.Z;
+            m_OutRotationW[i] = Rotation.W;
+        }
+    }
+}
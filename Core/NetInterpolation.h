@@ -0,0 +1,119 @@
+/*
+ * UE4 Net Interpolation - Self-contained client-side smoothing for replicated transforms
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <functional>
+
+namespace UE4SDK
+{
+    // Forward declarations
+    class ReplicationInfo;
+
+    // How proxies are placed between snapshots
+    enum class ENetSmoothingMode : uint8
+    {
+        Disabled = 0,       // Snap to the newest snapshot
+        Interpolate = 1,    // Blend between snapshots, hold the newest when they run out
+        Extrapolate = 2     // Interpolate, and keep moving along the last velocity for a while when they run out
+    };
+
+    // Smoothing settings - the delay should cover a couple of send intervals plus jitter,
+    // so one lost or late packet is bridged by interpolation instead of extrapolation.
+    struct NetInterpolationSettings
+    {
+        ENetSmoothingMode Mode = ENetSmoothingMode::Extrapolate;
+        float InterpolationDelay = 0.1f;    // Seconds behind the local clock proxies are rendered at
+        float MaxExtrapolationTime = 0.25f; // Seconds past the newest snapshot before a proxy holds still
+        float TeleportDistance = 1000.0f;   // Snapshots further apart than this snap instead of sliding
+    };
+
+    // Net interpolation - snapshot buffers for every simulated proxy, evaluated together once per frame.
+    // Snapshots and results are stored as structure of arrays, so a frame's evaluation walks flat
+    // float arrays instead of chasing one buffer object per actor.
+    class NetInterpolation
+    {
+    public:
+        static constexpr int32 SnapshotCapacity = 8; // Per proxy, the oldest is overwritten
+
+        NetInterpolation();
+
+        void SetSettings(const NetInterpolationSettings& Settings) { m_Settings = Settings; }
+        const NetInterpolationSettings& GetSettings() const { return m_Settings; }
+
+        // Proxies - IDs are reused after removal
+        int32 AddProxy();
+        void RemoveProxy(int32 ProxyID);
+        void ResetProxy(int32 ProxyID); // Drops buffered snapshots, the next one snaps
+        bool IsValidProxy(int32 ProxyID) const;
+        int32 GetProxyCount() const { return m_ActiveCount; }
+
+        // Proxy fed by replication - every time PropertyName is received, Transform is buffered as a snapshot.
+        // Transform is the replicated value and must outlive the proxy. Earlier received callbacks still run.
+        int32 AddProxy(ReplicationInfo* Info, const FString& PropertyName, const FTransform* Transform);
+
+        // Snapshots - without a time they're stamped with the local clock on arrival
+        void AddSnapshot(int32 ProxyID, const FTransform& Transform) { AddSnapshot(ProxyID, m_Time, Transform); }
+        void AddSnapshot(int32 ProxyID, double Time, const FTransform& Transform);
+        int32 GetSnapshotCount(int32 ProxyID) const { return IsValidProxy(ProxyID) ? m_Counts[ProxyID] : 0; }
+
+        // Advances the local clock and evaluates every proxy at the render time
+        void Update(float DeltaTime);
+        void Evaluate(double RenderTime);
+        double GetTime() const { return m_Time; }
+        double GetRenderTime() const { return m_Time - m_Settings.InterpolationDelay; }
+
+        // Results of the last evaluation
+        FTransform GetTransform(int32 ProxyID) const;
+        bool IsExtrapolating(int32 ProxyID) const { return IsValidProxy(ProxyID) && m_Extrapolating[ProxyID] != 0; }
+        void SetOnProxyUpdatedCallback(std::function<void(int32, const FTransform&)> Callback) { m_OnProxyUpdatedCallback = Callback; }
+
+        // Stats from the last evaluation
+        int32 GetInterpolatingCount() const { return m_InterpolatingCount; }
+        int32 GetExtrapolatingCount() const { return m_ExtrapolatingCount; }
+        int32 GetStarvedCount() const { return m_StarvedCount; } // Past the extrapolation limit, holding still
+
+    private:
+        NetInterpolationSettings m_Settings;
+        double m_Time;
+
+        // Proxy state, one entry per proxy ID
+        TArray<uint8> m_Active;
+        TArray<int32> m_Heads;  // Ring index of the newest snapshot
+        TArray<int32> m_Counts;
+        TArray<int32> m_FreeProxies;
+        int32 m_ActiveCount;
+
+        // Snapshots, SnapshotCapacity slots per proxy
+        TArray<double> m_SnapshotTimes;
+        TArray<float> m_PositionX, m_PositionY, m_PositionZ;
+        TArray<float> m_RotationX, m_RotationY, m_RotationZ, m_RotationW;
+        TArray<float> m_ScaleX, m_ScaleY, m_ScaleZ;
+
+        // Evaluation - the sample pass picks the two slots and alpha, the blend pass applies them
+        TArray<int32> m_From;
+        TArray<int32> m_To;
+        TArray<float> m_Alpha;
+        TArray<uint8> m_Extrapolating;
+
+        // Results, one entry per proxy ID
+        TArray<float> m_OutPositionX, m_OutPositionY, m_OutPositionZ;
+        TArray<float> m_OutRotationX, m_OutRotationY, m_OutRotationZ, m_OutRotationW;
+        TArray<float> m_OutScaleX, m_OutScaleY, m_OutScaleZ;
+
+        int32 m_InterpolatingCount;
+        int32 m_ExtrapolatingCount;
+        int32 m_StarvedCount;
+
+        std::function<void(int32, const FTransform&)> m_OnProxyUpdatedCallback;
+
+        // Helper functions
+        void GrowProxies(int32 NewCount);
+        void WriteSlot(int32 Slot, double Time, const FTransform& Transform);
+        void SampleRange(int32 Begin, int32 End, double RenderTime);
+        void BlendRange(int32 Begin, int32 End);
+    };
+}
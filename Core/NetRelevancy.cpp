@@ -0,0 +1,280 @@
+/*
+ * UE4 Net Relevancy Implementation - Self-contained interest management implementation
+ * Vibe coder approved ✨
+ */
+
+#include "NetRelevancy.h"
+#include "Replication.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // Connections per job - each one runs a grid query and a sort
+        constexpr int32 ConnectionBatchSize = 4;
+    }
+
+    NetRelevancy::NetRelevancy()
+        : m_GridStamp(0)
+        , m_LastRelevantPairCount(0)
+    {
+    }
+
+    void NetRelevancy::SetSpatialSettings(const SpatialOctreeSettings& Settings)
+    {
+        // Everything is re-inserted on the next update
+        m_Grid.SetSettings(Settings);
+        m_GridHandles.clear();
+    }
+
+    void NetRelevancy::RemoveConnection(int32 ConnectionID)
+    {
+        m_Views.Remove(ConnectionID);
+        m_RelevantSets.Remove(ConnectionID);
+        m_NewlyRelevantSets.Remove(ConnectionID);
+    }
+
+    void NetRelevancy::Update(ReplicationManager* Manager, const TArray<int32>& Connections)
+    {
+        if (!Manager)
+        {
+            return;
+        }
+
+        UpdateGrid(Manager);
+
+        // Drop connections that have gone away, keep the rest so their storage is reused
+        TArray<int32> StaleConnections;
+        for (const auto& pair : m_RelevantSets)
+        {
+            if (!Connections.Contains(pair.first))
+            {
+                StaleConnections.Add(pair.first);
+            }
+        }
+        for (const auto& pair : m_Views)
+        {
+            if (!Connections.Contains(pair.first) && !m_RelevantSets.Contains(pair.first))
+            {
+                StaleConnections.Add(pair.first);
+            }
+        }
+        for (int32 ConnectionID : StaleConnections)
+        {
+            RemoveConnection(ConnectionID);
+        }
+
+        // Map nodes are stable, so workers can each fill their own set without locking
+        TArray<TArray<UObject*>*> Sets;
+        TArray<TArray<UObject*>*> NewlyRelevantSets;
+        Sets.Reserve(Connections.Num());
+        NewlyRelevantSets.Reserve(Connections.Num());
+        for (int32 ConnectionID : Connections)
+        {
+            Sets.Add(&m_RelevantSets.FindOrAdd(ConnectionID));
+            NewlyRelevantSets.Add(&m_NewlyRelevantSets.FindOrAdd(ConnectionID));
+        }
+
+        JobSystem::Get().ParallelFor(Connections.Num(), ConnectionBatchSize, [this, &Connections, &Sets, &NewlyRelevantSets](int32 Begin, int32 End)
+        {
+            for (int32 i = Begin; i < End; ++i)
+            {
+                BuildRelevantSet(Connections[i], *Sets[i], *NewlyRelevantSets[i]);
+            }
+        });
+
+        m_LastRelevantPairCount = 0;
+        for (TArray<UObject*>* Set : Sets)
+        {
+            m_LastRelevantPairCount += Set->Num();
+        }
+    }
+
+    const TArray<UObject*>& NetRelevancy::GetRelevantActors(int32 ConnectionID) const
+    {
+        static const TArray<UObject*> EmptySet;
+        const TArray<UObject*>* Set = m_RelevantSets.Find(ConnectionID);
+        return Set ? *Set : EmptySet;
+    }
+
+    const TArray<UObject*>& NetRelevancy::GetNewlyRelevantActors(int32 ConnectionID) const
+    {
+        static const TArray<UObject*> EmptySet;
+        const TArray<UObject*>* Set = m_NewlyRelevantSets.Find(ConnectionID);
+        return Set ? *Set : EmptySet;
+    }
+
+    bool NetRelevancy::IsRelevant(UObject* Object, ReplicationInfo* Info, int32 ConnectionID) const
+    {
+        const TArray<UObject*>* Set = m_RelevantSets.Find(ConnectionID);
+        if (Set && std::binary_search(Set->begin(), Set->end(), Object))
+        {
+            return true;
+        }
+
+        // Not in the last update - could be new since then, so check it directly
+        return EvaluateRelevancy(Info, ConnectionID, GetConnectionView(ConnectionID));
+    }
+
+    bool NetRelevancy::EvaluateRelevancy(ReplicationInfo* Info, int32 ConnectionID, const NetConnectionView* View)
+    {
+        if (!Info || !Info->IsValidForReplication())
+        {
+            return false;
+        }
+
+        if (!Info->IsRelevantToConnection(ConnectionID))
+        {
+            return false;
+        }
+
+        // Dormant actors stay as they are on clients that already have them
+        if (Info->IsDormant() && Info->HasShadowState(ConnectionID))
+        {
+            return false;
+        }
+
+        if (Info->IsAlwaysRelevant() || !Info->HasNetLocation() || Info->GetOwnerConnection() == ConnectionID)
+        {
+            return true;
+        }
+
+        if (!View)
+        {
+            return false;
+        }
+
+        float CullDistance = Info->GetNetCullDistance();
+        return (Info->GetNetLocation() - View->Location).SizeSquared() <= CullDistance * CullDistance;
+    }
+
+    void NetRelevancy::UpdateGrid(ReplicationManager* Manager)
+    {
+        ++m_GridStamp;
+        m_GridObjects.Empty();
+        m_GridInfos.Empty();
+        m_GlobalObjects.Empty();
+        m_GlobalInfos.Empty();
+        m_OwnedObjects.Empty();
+
+        for (UObject* Object : Manager->GetReplicatedObjects())
+        {
+            ReplicationInfo* Info = Manager->GetReplicationInfo(Object);
+            if (!Info || !Info->IsValidForReplication())
+            {
+                continue;
+            }
+
+            // Location getters are gameplay code, so they're only called here on the game thread
+            Info->UpdateNetLocation();
+
+            if (Info->IsAlwaysRelevant() || !Info->HasNetLocation())
+            {
+                m_GlobalObjects.Add(Object);
+                m_GlobalInfos.Add(Info);
+                continue;
+            }
+
+            int32 Index = m_GridObjects.Num();
+            m_GridObjects.Add(Object);
+            m_GridInfos.Add(Info);
+
+            // Actors that haven't left their cell only get their entry rewritten
+            GridHandle& Entry = m_GridHandles[Object];
+            if (Entry.Handle == SpatialOctree::InvalidHandle)
+            {
+                Entry.Handle = m_Grid.Insert(Index, Info->GetNetLocation(), Info->GetNetCullDistance());
+            }
+            else
+            {
+                m_Grid.Update(Entry.Handle, Info->GetNetLocation(), Info->GetNetCullDistance());
+                m_Grid.SetUserId(Entry.Handle, Index);
+            }
+            Entry.Stamp = m_GridStamp;
+
+            if (Info->GetOwnerConnection() != -1)
+            {
+                m_OwnedObjects.FindOrAdd(Info->GetOwnerConnection()).Add(Index);
+            }
+        }
+
+        // Drop actors that stopped replicating or became global since the last update
+        for (auto It = m_GridHandles.begin(); It != m_GridHandles.end();)
+        {
+            if (It->second.Stamp != m_GridStamp)
+            {
+                m_Grid.Remove(It->second.Handle);
+                It = m_GridHandles.erase(It);
+            }
+            else
+            {
+                ++It;
+            }
+        }
+    }
+
+    void NetRelevancy::BuildRelevantSet(int32 ConnectionID, TArray<UObject*>& OutSet, TArray<UObject*>& OutNewlyRelevant) const
+    {
+        PROFILE_SCOPE("NetRelevancy::BuildRelevantSet");
+        MEMORY_TAG_SCOPE(Replication);
+
+        TArray<UObject*> PreviousSet = std::move(OutSet);
+        OutSet.Empty();
+        const NetConnectionView* View = m_Views.Find(ConnectionID);
+
+        for (int32 i = 0; i < m_GlobalObjects.Num(); ++i)
+        {
+            if (EvaluateRelevancy(m_GlobalInfos[i], ConnectionID, View))
+            {
+                OutSet.Add(m_GlobalObjects[i]);
+            }
+        }
+
+        // Owned actors are relevant to their owner wherever they are
+        const TArray<int32>* Owned = m_OwnedObjects.Find(ConnectionID);
+        if (Owned)
+        {
+            for (int32 Index : *Owned)
+            {
+                if (EvaluateRelevancy(m_GridInfos[Index], ConnectionID, View))
+                {
+                    OutSet.Add(m_GridObjects[Index]);
+                }
+            }
+        }
+
+        if (View && m_Grid.Num() > 0)
+        {
+            // Every actor whose cull sphere contains the view
+            m_Grid.QuerySphere(View->Location, 0.0f, [this, ConnectionID, View, &OutSet](int32, const SpatialEntry& Entry)
+            {
+                ReplicationInfo* Info = m_GridInfos[Entry.UserId];
+                if (Info->GetOwnerConnection() != ConnectionID && EvaluateRelevancy(Info, ConnectionID, View))
+                {
+                    OutSet.Add(m_GridObjects[Entry.UserId]);
+                }
+            });
+        }
+
+        std::sort(OutSet.begin(), OutSet.end());
+
+        // Both sets are sorted, so the difference is a single merge walk
+        OutNewlyRelevant.Empty();
+        int32 PreviousIndex = 0;
+        for (UObject* Object : OutSet)
+        {
+            while (PreviousIndex < PreviousSet.Num() && PreviousSet[PreviousIndex] < Object)
+            {
+                PreviousIndex++;
+            }
+            if (PreviousIndex >= PreviousSet.Num() || PreviousSet[PreviousIndex] != Object)
+            {
+                OutNewlyRelevant.Add(Object);
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * UE4 Net Relevancy - Self-contained per-connection interest management
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "SpatialIndex.h"
+#include <unordered_map>
+
+namespace UE4SDK
+{
+    // Forward declarations
+    class UObject;
+    class ReplicationInfo;
+    class ReplicationManager;
+
+    // Connection view - where a client is looking from, reported by gameplay code
+    struct NetConnectionView
+    {
+        FVector Location;
+        FVector Forward = FVector(1.0f, 0.0f, 0.0f);
+    };
+
+    // Net relevancy - builds each connection's relevant actor set from a shared spatial index.
+    // Each actor is a sphere of its cull distance, so a view only has to find the spheres it's inside.
+    // Actors without a net location are treated as always relevant.
+    class NetRelevancy
+    {
+    public:
+        NetRelevancy();
+
+        // Connection views - connections without a view only get always relevant and owned actors
+        void SetConnectionView(int32 ConnectionID, const NetConnectionView& View) { m_Views.Add(ConnectionID, View); }
+        const NetConnectionView* GetConnectionView(int32 ConnectionID) const { return m_Views.Find(ConnectionID); }
+        void RemoveConnection(int32 ConnectionID);
+
+        // Spatial index settings
+        void SetSpatialSettings(const SpatialOctreeSettings& Settings);
+        const SpatialOctree& GetSpatialIndex() const { return m_Grid; }
+
+        // Updates the index and rebuilds every connection's relevant set, connections run in parallel
+        void Update(ReplicationManager* Manager, const TArray<int32>& Connections);
+
+        // Results - sets are sorted by pointer, so membership is a binary search
+        const TArray<UObject*>& GetRelevantActors(int32 ConnectionID) const;
+        const TArray<UObject*>& GetNewlyRelevantActors(int32 ConnectionID) const; // Relevant now but not in the previous update
+        bool IsRelevant(UObject* Object, ReplicationInfo* Info, int32 ConnectionID) const;
+        bool HasRelevantSet(int32 ConnectionID) const { return m_RelevantSets.Contains(ConnectionID); }
+
+        // Stats
+        int32 GetGridActorCount() const { return m_Grid.Num(); }
+        int32 GetLastRelevantPairCount() const { return m_LastRelevantPairCount; }
+
+        // Single actor check against a connection, used for actors outside the last update
+        static bool EvaluateRelevancy(ReplicationInfo* Info, int32 ConnectionID, const NetConnectionView* View);
+
+    private:
+        struct GridHandle
+        {
+            int32 Handle = SpatialOctree::InvalidHandle;
+            uint32 Stamp = 0; // Last update the object was seen in
+        };
+
+        SpatialOctree m_Grid; // User ids index m_GridObjects
+        std::unordered_map<UObject*, GridHandle> m_GridHandles;
+        uint32 m_GridStamp;
+        TArray<UObject*> m_GridObjects;
+        TArray<ReplicationInfo*> m_GridInfos;
+        TArray<UObject*> m_GlobalObjects;
+        TArray<ReplicationInfo*> m_GlobalInfos;
+        TMap<int32, TArray<int32>> m_OwnedObjects; // Grid indices by owning connection
+
+        TMap<int32, NetConnectionView> m_Views;
+        TMap<int32, TArray<UObject*>> m_RelevantSets;
+        TMap<int32, TArray<UObject*>> m_NewlyRelevantSets;
+        int32 m_LastRelevantPairCount;
+
+        // Helper functions
+        void UpdateGrid(ReplicationManager* Manager);
+        void BuildRelevantSet(int32 ConnectionID, TArray<UObject*>& OutSet, TArray<UObject*>& OutNewlyRelevant) const;
+    };
+}
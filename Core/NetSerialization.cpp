@@ -0,0 +1,485 @@
+/*
+ * UE4 Net Serialization Implementation - Self-contained bit stream implementation
+ * Vibe coder approved ✨
+ */
+
+#include "NetSerialization.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        constexpr float InvSqrt2 = 0.70710678118f;
+
+        // Bits needed to hold values in [0, ValueMax)
+        int32 CeilLogTwo(uint32 ValueMax)
+        {
+            int32 Bits = 0;
+            while (Bits < 32 && (static_cast<uint64>(1) << Bits) < ValueMax)
+            {
+                Bits++;
+            }
+            return Bits;
+        }
+
+        float NormalizeAxis(float Angle)
+        {
+            Angle = std::fmod(Angle, 360.0f);
+            return Angle < 0.0f ? Angle + 360.0f : Angle;
+        }
+
+        float DenormalizeAxis(float Angle)
+        {
+            return Angle > 180.0f ? Angle - 360.0f : Angle;
+        }
+
+        void WriteCompressedAxis(FBitWriter& Writer, float Angle, int32 NumBits)
+        {
+            uint32 Steps = 1u << NumBits;
+            uint32 Compressed = static_cast<uint32>(std::lround(NormalizeAxis(Angle) * Steps / 360.0f)) & (Steps - 1);
+            Writer.WriteBit(Compressed != 0);
+            if (Compressed != 0)
+            {
+                Writer.WriteBits(Compressed, NumBits);
+            }
+        }
+
+        float ReadCompressedAxis(FBitReader& Reader, int32 NumBits)
+        {
+            if (!Reader.ReadBit())
+            {
+                return 0.0f;
+            }
+            uint32 Compressed = Reader.ReadBits(NumBits);
+            return DenormalizeAxis(Compressed * 360.0f / static_cast<float>(1u << NumBits));
+        }
+    }
+
+    // FBitWriter implementation
+    FBitWriter::FBitWriter()
+        : m_NumBits(0)
+    {
+    }
+
+    FBitWriter::FBitWriter(int32 ReserveBytes)
+        : m_NumBits(0)
+    {
+        m_Buffer.Reserve(ReserveBytes);
+    }
+
+    void FBitWriter::WriteBit(bool bValue)
+    {
+        WriteBits(bValue ? 1u : 0u, 1);
+    }
+
+    void FBitWriter::WriteBits(uint32 Value, int32 NumBits)
+    {
+        while (NumBits > 0)
+        {
+            int32 BitOffset = m_NumBits & 7;
+            if (BitOffset == 0)
+            {
+                m_Buffer.Add(0);
+            }
+
+            int32 Take = std::min(8 - BitOffset, NumBits);
+            uint32 Mask = (1u << Take) - 1;
+            m_Buffer[m_NumBits >> 3] |= static_cast<uint8>((Value & Mask) << BitOffset);
+
+            Value = Take < 32 ? Value >> Take : 0;
+            m_NumBits += Take;
+            NumBits -= Take;
+        }
+    }
+
+    void FBitWriter::WriteBits(const uint8* Data, int32 NumBits)
+    {
+        if (!Data || NumBits <= 0)
+        {
+            return;
+        }
+
+        int32 FullBytes = NumBits >> 3;
+        if ((m_NumBits & 7) == 0 && FullBytes > 0)
+        {
+            // Byte aligned - copy whole bytes straight in
+            int32 Start = m_Buffer.Num();
+            m_Buffer.SetNum(Start + FullBytes);
+            std::memcpy(&m_Buffer[Start], Data, FullBytes);
+            m_NumBits += FullBytes * 8;
+        }
+        else
+        {
+            for (int32 i = 0; i < FullBytes; ++i)
+            {
+                WriteBits(Data[i], 8);
+            }
+        }
+
+        int32 RemainingBits = NumBits & 7;
+        if (RemainingBits > 0)
+        {
+            WriteBits(Data[FullBytes], RemainingBits);
+        }
+    }
+
+    void FBitWriter::WriteBytes(const uint8* Data, int32 NumBytes)
+    {
+        WriteBits(Data, NumBytes * 8);
+    }
+
+    void FBitWriter::SerializeInt(uint32 Value, uint32 ValueMax)
+    {
+        if (ValueMax == 0)
+        {
+            return;
+        }
+
+        WriteBits(std::min(Value, ValueMax - 1), CeilLogTwo(ValueMax));
+    }
+
+    void FBitWriter::WriteVarUInt(uint32 Value)
+    {
+        while (Value >= 0x80)
+        {
+            WriteBits((Value & 0x7F) | 0x80, 8);
+            Value >>= 7;
+        }
+        WriteBits(Value, 8);
+    }
+
+    void FBitWriter::WriteVarInt(int32 Value)
+    {
+        // Zigzag so small negative numbers stay small
+        uint32 Encoded = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+        WriteVarUInt(Encoded);
+    }
+
+    void FBitWriter::WriteFloat(float Value)
+    {
+        uint32 Bits;
+        std::memcpy(&Bits, &Value, sizeof(Bits));
+        WriteBits(Bits, 32);
+    }
+
+    void FBitWriter::WriteString(const FString& Value)
+    {
+        WriteVarUInt(static_cast<uint32>(Value.Len()));
+        WriteBytes(reinterpret_cast<const uint8*>(*Value), Value.Len());
+    }
+
+    void FBitWriter::WritePackedVector(const FVector& Value, int32 ScaleFactor, int32 MaxBitsPerComponent)
+    {
+        MaxBitsPerComponent = std::max(1, std::min(MaxBitsPerComponent, 31));
+
+        int64 Scaled[3] = {
+            std::llround(static_cast<double>(Value.X) * ScaleFactor),
+            std::llround(static_cast<double>(Value.Y) * ScaleFactor),
+            std::llround(static_cast<double>(Value.Z) * ScaleFactor)
+        };
+
+        uint64 MaxAbs = 0;
+        for (int64 Component : Scaled)
+        {
+            MaxAbs = std::max(MaxAbs, static_cast<uint64>(Component < 0 ? -Component : Component));
+        }
+
+        // One sign bit plus enough magnitude bits for the largest component
+        int32 Bits = 1;
+        while (Bits < MaxBitsPerComponent && (static_cast<uint64>(1) << (Bits - 1)) < MaxAbs + 1)
+        {
+            Bits++;
+        }
+
+        int64 Bias = static_cast<int64>(1) << (Bits - 1);
+        int64 Limit = Bias - 1;
+
+        WriteBits(static_cast<uint32>(Bits), 5);
+        for (int64 Component : Scaled)
+        {
+            Component = std::max(-Bias, std::min(Component, Limit));
+            WriteBits(static_cast<uint32>(Component + Bias), Bits);
+        }
+    }
+
+    void FBitWriter::WriteRotatorShort(const FRotator& Value)
+    {
+        WriteCompressedAxis(*this, Value.Pitch, 16);
+        WriteCompressedAxis(*this, Value.Yaw, 16);
+        WriteCompressedAxis(*this, Value.Roll, 16);
+    }
+
+    void FBitWriter::WriteRotatorByte(const FRotator& Value)
+    {
+        WriteCompressedAxis(*this, Value.Pitch, 8);
+        WriteCompressedAxis(*this, Value.Yaw, 8);
+        WriteCompressedAxis(*this, Value.Roll, 8);
+    }
+
+    void FBitWriter::WriteQuat(const FQuat& Value, int32 BitsPerComponent)
+    {
+        float Components[4] = { Value.X, Value.Y, Value.Z, Value.W };
+
+        float LengthSquared = 0.0f;
+        int32 LargestIndex = 0;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            LengthSquared += Components[i] * Components[i];
+            if (std::fabs(Components[i]) > std::fabs(Components[LargestIndex]))
+            {
+                LargestIndex = i;
+            }
+        }
+
+        // Normalize, and flip so the dropped component is positive (q and -q are the same rotation)
+        float Scale = LengthSquared > 0.0f ? 1.0f / std::sqrt(LengthSquared) : 0.0f;
+        if (Components[LargestIndex] < 0.0f)
+        {
+            Scale = -Scale;
+        }
+
+        uint32 MaxValue = (1u << BitsPerComponent) - 1;
+        WriteBits(static_cast<uint32>(LargestIndex), 2);
+        for (int32 i = 0; i < 4; ++i)
+        {
+            if (i == LargestIndex)
+            {
+                continue;
+            }
+
+            // Remaining components lie in [-1/sqrt(2), 1/sqrt(2)]
+            float Normalized = (Components[i] * Scale / InvSqrt2 + 1.0f) * 0.5f;
+            Normalized = std::max(0.0f, std::min(Normalized, 1.0f));
+            WriteBits(static_cast<uint32>(std::lround(Normalized * MaxValue)), BitsPerComponent);
+        }
+    }
+
+    void FBitWriter::Reset()
+    {
+        m_Buffer.Empty();
+        m_NumBits = 0;
+    }
+
+    TArray<uint8> FBitWriter::ReleaseBuffer()
+    {
+        TArray<uint8> Buffer = std::move(m_Buffer);
+        m_Buffer = TArray<uint8>();
+        m_NumBits = 0;
+        return Buffer;
+    }
+
+    bool FBitWriter::operator==(const FBitWriter& Other) const
+    {
+        if (m_NumBits != Other.m_NumBits)
+        {
+            return false;
+        }
+
+        // Unused trailing bits are always zero, so whole bytes compare cleanly
+        return m_NumBits == 0 || std::memcmp(GetData(), Other.GetData(), GetNumBytes()) == 0;
+    }
+
+    // FBitReader implementation
+    FBitReader::FBitReader(const uint8* Data, int32 NumBits)
+        : m_Data(Data)
+        , m_NumBits(Data ? NumBits : 0)
+        , m_PosBits(0)
+        , m_bError(false)
+    {
+    }
+
+    FBitReader::FBitReader(const TArray<uint8>& Buffer)
+        : m_Data(Buffer.Num() > 0 ? &Buffer[0] : nullptr)
+        , m_NumBits(Buffer.Num() * 8)
+        , m_PosBits(0)
+        , m_bError(false)
+    {
+    }
+
+    bool FBitReader::ReadBit()
+    {
+        return ReadBits(1) != 0;
+    }
+
+    uint32 FBitReader::ReadBits(int32 NumBits)
+    {
+        if (m_bError || NumBits > GetBitsLeft())
+        {
+            m_bError = true;
+            return 0;
+        }
+
+        uint32 Value = 0;
+        int32 Shift = 0;
+        while (NumBits > 0)
+        {
+            int32 BitOffset = m_PosBits & 7;
+            int32 Take = std::min(8 - BitOffset, NumBits);
+            uint32 Mask = (1u << Take) - 1;
+            Value |= ((static_cast<uint32>(m_Data[m_PosBits >> 3]) >> BitOffset) & Mask) << Shift;
+
+            Shift += Take;
+            m_PosBits += Take;
+            NumBits -= Take;
+        }
+        return Value;
+    }
+
+    void FBitReader::ReadBytes(uint8* OutData, int32 NumBytes)
+    {
+        if (m_bError || NumBytes * 8 > GetBitsLeft())
+        {
+            m_bError = true;
+            return;
+        }
+
+        if ((m_PosBits & 7) == 0)
+        {
+            std::memcpy(OutData, m_Data + (m_PosBits >> 3), NumBytes);
+            m_PosBits += NumBytes * 8;
+            return;
+        }
+
+        for (int32 i = 0; i < NumBytes; ++i)
+        {
+            OutData[i] = static_cast<uint8>(ReadBits(8));
+        }
+    }
+
+    void FBitReader::SkipBits(int32 NumBits)
+    {
+        if (m_bError || NumBits < 0 || NumBits > GetBitsLeft())
+        {
+            m_bError = true;
+            return;
+        }
+        m_PosBits += NumBits;
+    }
+
+    uint32 FBitReader::SerializeInt(uint32 ValueMax)
+    {
+        if (ValueMax == 0)
+        {
+            return 0;
+        }
+
+        uint32 Value = ReadBits(CeilLogTwo(ValueMax));
+        if (Value >= ValueMax)
+        {
+            m_bError = true;
+            return 0;
+        }
+        return Value;
+    }
+
+    uint32 FBitReader::ReadVarUInt()
+    {
+        uint32 Value = 0;
+        for (int32 Shift = 0; Shift < 35; Shift += 7)
+        {
+            uint32 Byte = ReadBits(8);
+            Value |= (Byte & 0x7F) << Shift;
+            if (!(Byte & 0x80) || m_bError)
+            {
+                return Value;
+            }
+        }
+
+        // More than five groups can't come from WriteVarUInt
+        m_bError = true;
+        return 0;
+    }
+
+    int32 FBitReader::ReadVarInt()
+    {
+        uint32 Encoded = ReadVarUInt();
+        return static_cast<int32>((Encoded >> 1) ^ (~(Encoded & 1) + 1));
+    }
+
+    float FBitReader::ReadFloat()
+    {
+        uint32 Bits = ReadBits(32);
+        float Value;
+        std::memcpy(&Value, &Bits, sizeof(Value));
+        return Value;
+    }
+
+    FString FBitReader::ReadString()
+    {
+        uint32 Length = ReadVarUInt();
+        if (m_bError || static_cast<int64>(Length) * 8 > GetBitsLeft())
+        {
+            m_bError = true;
+            return FString();
+        }
+
+        std::string Value(Length, '\0');
+        ReadBytes(reinterpret_cast<uint8*>(&Value[0]), static_cast<int32>(Length));
+        return FString(Value);
+    }
+
+    FVector FBitReader::ReadPackedVector(int32 ScaleFactor, int32 MaxBitsPerComponent)
+    {
+        int32 Bits = static_cast<int32>(ReadBits(5));
+        if (m_bError || Bits == 0 || Bits > MaxBitsPerComponent || ScaleFactor == 0)
+        {
+            m_bError = true;
+            return FVector();
+        }
+
+        int64 Bias = static_cast<int64>(1) << (Bits - 1);
+        float InvScale = 1.0f / static_cast<float>(ScaleFactor);
+
+        float X = static_cast<float>(static_cast<int64>(ReadBits(Bits)) - Bias) * InvScale;
+        float Y = static_cast<float>(static_cast<int64>(ReadBits(Bits)) - Bias) * InvScale;
+        float Z = static_cast<float>(static_cast<int64>(ReadBits(Bits)) - Bias) * InvScale;
+        return FVector(X, Y, Z);
+    }
+
+    FRotator FBitReader::ReadRotatorShort()
+    {
+        float Pitch = ReadCompressedAxis(*this, 16);
+        float Yaw = ReadCompressedAxis(*this, 16);
+        float Roll = ReadCompressedAxis(*this, 16);
+        return FRotator(Pitch, Yaw, Roll);
+    }
+
+    FRotator FBitReader::ReadRotatorByte()
+    {
+        float Pitch = ReadCompressedAxis(*this, 8);
+        float Yaw = ReadCompressedAxis(*this, 8);
+        float Roll = ReadCompressedAxis(*this, 8);
+        return FRotator(Pitch, Yaw, Roll);
+    }
+
+    FQuat FBitReader::ReadQuat(int32 BitsPerComponent)
+    {
+        int32 LargestIndex = static_cast<int32>(ReadBits(2));
+        float MaxValue = static_cast<float>((1u << BitsPerComponent) - 1);
+
+        float Components[4];
+        float SumSquares = 0.0f;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            if (i == LargestIndex)
+            {
+                continue;
+            }
+
+            float Normalized = static_cast<float>(ReadBits(BitsPerComponent)) / MaxValue;
+            Components[i] = (Normalized * 2.0f - 1.0f) * InvSqrt2;
+            SumSquares += Components[i] * Components[i];
+        }
+
+        if (m_bError)
+        {
+            return FQuat(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        Components[LargestIndex] = std::sqrt(std::max(0.0f, 1.0f - SumSquares));
+        return FQuat(Components[0], Components[1], Components[2], Components[3]);
+    }
+}
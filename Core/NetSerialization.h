@@ -0,0 +1,203 @@
+/*
+ * UE4 Net Serialization - Self-contained bit streams and quantized network encodings
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+
+namespace UE4SDK
+{
+    // Bit writer - appends bits LSB first into a growing byte buffer
+    class FBitWriter
+    {
+    public:
+        FBitWriter();
+        explicit FBitWriter(int32 ReserveBytes);
+
+        // Raw bits
+        void WriteBit(bool bValue);
+        void WriteBits(uint32 Value, int32 NumBits);
+        void WriteBits(const uint8* Data, int32 NumBits);
+        void WriteBits(const FBitWriter& Other) { WriteBits(Other.GetData(), Other.GetNumBits()); }
+        void WriteBytes(const uint8* Data, int32 NumBytes);
+
+        // Packed integers - SerializeInt uses just enough bits for values in [0, ValueMax)
+        void SerializeInt(uint32 Value, uint32 ValueMax);
+        void WriteVarUInt(uint32 Value);
+        void WriteVarInt(int32 Value);
+        void WriteFloat(float Value);
+        void WriteString(const FString& Value);
+
+        // Quantized math types
+        void WritePackedVector(const FVector& Value, int32 ScaleFactor = 10, int32 MaxBitsPerComponent = 24);
+        void WriteRotatorShort(const FRotator& Value);
+        void WriteRotatorByte(const FRotator& Value);
+        void WriteQuat(const FQuat& Value, int32 BitsPerComponent = 15);
+
+        // Buffer access
+        const uint8* GetData() const { return m_Buffer.Num() > 0 ? &m_Buffer[0] : nullptr; }
+        const TArray<uint8>& GetBuffer() const { return m_Buffer; }
+        int32 GetNumBits() const { return m_NumBits; }
+        int32 GetNumBytes() const { return (m_NumBits + 7) >> 3; }
+        void Reset();
+        TArray<uint8> ReleaseBuffer(); // Moves the bytes out and resets, for handing a finished packet off without a copy
+
+        bool operator==(const FBitWriter& Other) const;
+        bool operator!=(const FBitWriter& Other) const { return !(*this == Other); }
+
+    private:
+        TArray<uint8> m_Buffer;
+        int32 m_NumBits;
+    };
+
+    // Bit reader - mirrors FBitWriter, sets the error flag instead of reading past the end
+    class FBitReader
+    {
+    public:
+        FBitReader(const uint8* Data, int32 NumBits);
+        explicit FBitReader(const TArray<uint8>& Buffer);
+
+        // Raw bits
+        bool ReadBit();
+        uint32 ReadBits(int32 NumBits);
+        void ReadBytes(uint8* OutData, int32 NumBytes);
+        void SkipBits(int32 NumBits);
+
+        // Packed integers
+        uint32 SerializeInt(uint32 ValueMax);
+        uint32 ReadVarUInt();
+        int32 ReadVarInt();
+        float ReadFloat();
+        FString ReadString();
+
+        // Quantized math types
+        FVector ReadPackedVector(int32 ScaleFactor = 10, int32 MaxBitsPerComponent = 24);
+        FRotator ReadRotatorShort();
+        FRotator ReadRotatorByte();
+        FQuat ReadQuat(int32 BitsPerComponent = 15);
+
+        // State
+        bool IsError() const { return m_bError; }
+        void SetError() { m_bError = true; }
+        int32 GetPosBits() const { return m_PosBits; }
+        int32 GetBitsLeft() const { return m_NumBits - m_PosBits; }
+        bool AtEnd() const { return m_PosBits >= m_NumBits; }
+
+    private:
+        const uint8* m_Data;
+        int32 m_NumBits;
+        int32 m_PosBits;
+        bool m_bError;
+    };
+
+    // Net serializer - customization point for NetSerialize/NetDeserialize.
+    // Game structs opt in with member functions, or by specializing TNetSerializer.
+    template<typename T>
+    struct TNetSerializer
+    {
+        static void Write(FBitWriter& Writer, const T& Value) { Value.NetSerialize(Writer); }
+        static bool Read(FBitReader& Reader, T& Value) { return Value.NetDeserialize(Reader) && !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<bool>
+    {
+        static void Write(FBitWriter& Writer, const bool& Value) { Writer.WriteBit(Value); }
+        static bool Read(FBitReader& Reader, bool& Value) { Value = Reader.ReadBit(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<uint8>
+    {
+        static void Write(FBitWriter& Writer, const uint8& Value) { Writer.WriteBits(Value, 8); }
+        static bool Read(FBitReader& Reader, uint8& Value) { Value = static_cast<uint8>(Reader.ReadBits(8)); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<int32>
+    {
+        static void Write(FBitWriter& Writer, const int32& Value) { Writer.WriteVarInt(Value); }
+        static bool Read(FBitReader& Reader, int32& Value) { Value = Reader.ReadVarInt(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<uint32>
+    {
+        static void Write(FBitWriter& Writer, const uint32& Value) { Writer.WriteVarUInt(Value); }
+        static bool Read(FBitReader& Reader, uint32& Value) { Value = Reader.ReadVarUInt(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<float>
+    {
+        static void Write(FBitWriter& Writer, const float& Value) { Writer.WriteFloat(Value); }
+        static bool Read(FBitReader& Reader, float& Value) { Value = Reader.ReadFloat(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<FString>
+    {
+        static void Write(FBitWriter& Writer, const FString& Value) { Writer.WriteString(Value); }
+        static bool Read(FBitReader& Reader, FString& Value) { Value = Reader.ReadString(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<FVector>
+    {
+        static void Write(FBitWriter& Writer, const FVector& Value) { Writer.WritePackedVector(Value); }
+        static bool Read(FBitReader& Reader, FVector& Value) { Value = Reader.ReadPackedVector(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<FRotator>
+    {
+        static void Write(FBitWriter& Writer, const FRotator& Value) { Writer.WriteRotatorShort(Value); }
+        static bool Read(FBitReader& Reader, FRotator& Value) { Value = Reader.ReadRotatorShort(); return !Reader.IsError(); }
+    };
+
+    template<>
+    struct TNetSerializer<FQuat>
+    {
+        static void Write(FBitWriter& Writer, const FQuat& Value) { Writer.WriteQuat(Value); }
+        static bool Read(FBitReader& Reader, FQuat& Value) { Value = Reader.ReadQuat(); return !Reader.IsError(); }
+    };
+
+    // Transforms - scale is almost always one, so it costs a single bit unless it isn't
+    template<>
+    struct TNetSerializer<FTransform>
+    {
+        static void Write(FBitWriter& Writer, const FTransform& Value)
+        {
+            Writer.WriteQuat(Value.Rotation);
+            Writer.WritePackedVector(Value.Translation);
+            bool bUnitScale = Value.Scale3D == FVector::OneVector;
+            Writer.WriteBit(!bUnitScale);
+            if (!bUnitScale)
+            {
+                Writer.WritePackedVector(Value.Scale3D, 100);
+            }
+        }
+
+        static bool Read(FBitReader& Reader, FTransform& Value)
+        {
+            Value.Rotation = Reader.ReadQuat();
+            Value.Translation = Reader.ReadPackedVector();
+            Value.Scale3D = Reader.ReadBit() ? Reader.ReadPackedVector(100) : FVector::OneVector;
+            return !Reader.IsError();
+        }
+    };
+
+    template<typename T>
+    void NetSerialize(FBitWriter& Writer, const T& Value)
+    {
+        TNetSerializer<T>::Write(Writer, Value);
+    }
+
+    template<typename T>
+    bool NetDeserialize(FBitReader& Reader, T& Value)
+    {
+        return TNetSerializer<T>::Read(Reader, Value);
+    }
+}
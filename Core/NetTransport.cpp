@@ -0,0 +1,1198 @@
+/*
+ * UE4 Net Transport Implementation - Self-contained UDP transport implementation
+ * Vibe coder approved ✨
+ */
+
+#include "NetTransport.h"
+#include "Utils.h"
+#include "Profiler.h"
+#include "Stats.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #pragma comment(lib, "ws2_32.lib")
+#else
+    #include <sys/types.h>
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+namespace UE4SDK
+{
+    namespace
+    {
+#if defined(_WIN32)
+        using NativeSocket = SOCKET;
+        using NativeAddressLength = int;
+
+        // Winsock is started once, the first time a socket is opened
+        struct WinsockScope
+        {
+            WinsockScope() { WSADATA Data; WSAStartup(MAKEWORD(2, 2), &Data); }
+            ~WinsockScope() { WSACleanup(); }
+        };
+
+        bool WouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+        void CloseNativeSocket(NativeSocket Socket) { closesocket(Socket); }
+        bool SetNonBlocking(NativeSocket Socket) { u_long Mode = 1; return ioctlsocket(Socket, FIONBIO, &Mode) == 0; }
+#else
+        using NativeSocket = int;
+        using NativeAddressLength = socklen_t;
+
+        bool WouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+        void CloseNativeSocket(NativeSocket Socket) { close(Socket); }
+        bool SetNonBlocking(NativeSocket Socket)
+        {
+            int Flags = fcntl(Socket, F_GETFL, 0);
+            return Flags >= 0 && fcntl(Socket, F_SETFL, Flags | O_NONBLOCK) == 0;
+        }
+#endif
+
+        constexpr std::intptr_t InvalidSocket = -1;
+        constexpr int32 BatchSize = 64;          // Datagrams per sendmmsg/recvmmsg call
+        constexpr int32 ReceiveSlotSize = 1500;  // Anything larger than an Ethernet frame isn't ours
+        constexpr int32 SocketBufferSize = 1 << 20;
+
+        // Packet header: Magic (2) | Flags (1) | Sequence (2) | Ack (2) | AckBits (4)
+        constexpr uint16 ProtocolMagic = 0x5545;
+        constexpr uint8 FlagDisconnect = 1 << 0;
+        constexpr uint8 FlagHasAck = 1 << 1;
+
+        // Message header: Type (1) | MessageID (2, reliable only) | Length (2)
+        constexpr uint8 ReliableBit = 0x80;
+
+        constexpr float KeepAliveInterval = 0.5f;
+        constexpr float InitialRetransmitTimeout = 0.5f;
+        constexpr float MinRetransmitTimeout = 0.05f;
+        constexpr float MaxRetransmitTimeout = 2.0f;
+        constexpr int32 InitialCongestionPackets = 10;
+        constexpr float MaxCongestionWindow = 256.0f * 1024.0f;
+
+        NativeSocket ToNative(std::intptr_t Socket) { return static_cast<NativeSocket>(Socket); }
+
+        sockaddr_in ToSockAddr(const NetAddress& Address)
+        {
+            sockaddr_in Result;
+            std::memset(&Result, 0, sizeof(Result));
+            Result.sin_family = AF_INET;
+            Result.sin_addr.s_addr = htonl(Address.IP);
+            Result.sin_port = htons(Address.Port);
+            return Result;
+        }
+
+        NetAddress FromSockAddr(const sockaddr_in& Address)
+        {
+            NetAddress Result;
+            Result.IP = ntohl(Address.sin_addr.s_addr);
+            Result.Port = ntohs(Address.sin_port);
+            return Result;
+        }
+
+        // Wire format is little endian regardless of host
+        void WriteU16(uint8* Out, uint16 Value)
+        {
+            Out[0] = static_cast<uint8>(Value);
+            Out[1] = static_cast<uint8>(Value >> 8);
+        }
+
+        void WriteU32(uint8* Out, uint32 Value)
+        {
+            WriteU16(Out, static_cast<uint16>(Value));
+            WriteU16(Out + 2, static_cast<uint16>(Value >> 16));
+        }
+
+        uint16 ReadU16(const uint8* In)
+        {
+            return static_cast<uint16>(In[0] | (In[1] << 8));
+        }
+
+        uint32 ReadU32(const uint8* In)
+        {
+            return static_cast<uint32>(ReadU16(In)) | (static_cast<uint32>(ReadU16(In + 2)) << 16);
+        }
+
+        // Wrap-safe comparison - A is newer when it's less than half the sequence space ahead of B
+        bool SequenceGreater(uint16 A, uint16 B)
+        {
+            return A != B && static_cast<uint16>(A - B) < 32768;
+        }
+
+        int32 WriteMessage(uint8* Out, int32 Offset, bool bReliable, uint16 MessageID, uint8 Channel, const TArray<uint8>& Payload)
+        {
+            Out[Offset++] = static_cast<uint8>(Channel & ~ReliableBit) | (bReliable ? ReliableBit : 0);
+            if (bReliable)
+            {
+                WriteU16(Out + Offset, MessageID);
+                Offset += 2;
+            }
+            WriteU16(Out + Offset, static_cast<uint16>(Payload.Num()));
+            Offset += 2;
+            if (Payload.Num() > 0)
+            {
+                std::memcpy(Out + Offset, Payload.GetData(), Payload.Num());
+            }
+            return Offset + Payload.Num();
+        }
+
+        // Wire-level totals, headers and resends included
+        const StatId StatWireBytesSent = StatsRegistry::Get().RegisterCounter(TEXT("Net.Transport.BytesSent"));
+        const StatId StatWireBytesReceived = StatsRegistry::Get().RegisterCounter(TEXT("Net.Transport.BytesReceived"));
+        const StatId StatDatagramsSent = StatsRegistry::Get().RegisterCounter(TEXT("Net.Transport.DatagramsSent"));
+    }
+
+    // NetAddress implementation
+    NetAddress NetAddress::FromString(const FString& Address, int32 Port)
+    {
+        NetAddress Result;
+        const char* Chars = (Address == TEXT("localhost")) ? "127.0.0.1" : *Address;
+
+        in_addr Parsed;
+        if (inet_pton(AF_INET, Chars, &Parsed) != 1 || Port <= 0 || Port > 65535)
+        {
+            return Result;
+        }
+
+        Result.IP = ntohl(Parsed.s_addr);
+        Result.Port = static_cast<uint16>(Port);
+        return Result;
+    }
+
+    FString NetAddress::ToString() const
+    {
+        return FString::FromInt(static_cast<int32>((IP >> 24) & 0xFF)) + TEXT(".") +
+            FString::FromInt(static_cast<int32>((IP >> 16) & 0xFF)) + TEXT(".") +
+            FString::FromInt(static_cast<int32>((IP >> 8) & 0xFF)) + TEXT(".") +
+            FString::FromInt(static_cast<int32>(IP & 0xFF));
+    }
+
+    // NetTransport implementation
+    NetTransport::NetTransport()
+        : m_Socket(InvalidSocket)
+        , m_LocalPort(0)
+        , m_UsedSendBuffers(0)
+        , m_ConnectionTimeout(10.0f)
+        , m_TotalBytesSent(0)
+        , m_TotalBytesReceived(0)
+    {
+        SetSimulation(NetSimulationSettings());
+    }
+
+    NetTransport::~NetTransport()
+    {
+        Close();
+    }
+
+    bool NetTransport::Open(int32 Port)
+    {
+        Close();
+
+#if defined(_WIN32)
+        static WinsockScope Winsock;
+#endif
+
+        NativeSocket Socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (static_cast<std::intptr_t>(Socket) == InvalidSocket)
+        {
+            Utils::Get().LogError(TEXT("NetTransport::Open - Failed to create socket"));
+            return false;
+        }
+
+        sockaddr_in Bind = ToSockAddr(NetAddress());
+        Bind.sin_addr.s_addr = htonl(INADDR_ANY);
+        Bind.sin_port = htons(static_cast<uint16>(Port));
+        if (bind(Socket, reinterpret_cast<const sockaddr*>(&Bind), sizeof(Bind)) != 0 || !SetNonBlocking(Socket))
+        {
+            Utils::Get().LogError(TEXT("NetTransport::Open - Failed to bind port ") + FString::FromInt(Port));
+            CloseNativeSocket(Socket);
+            return false;
+        }
+
+        // Batched sends arrive in bursts, so give the kernel room to queue them
+        int BufferSize = SocketBufferSize;
+        setsockopt(Socket, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&BufferSize), sizeof(BufferSize));
+        setsockopt(Socket, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&BufferSize), sizeof(BufferSize));
+
+        sockaddr_in Bound;
+        NativeAddressLength BoundLength = sizeof(Bound);
+        getsockname(Socket, reinterpret_cast<sockaddr*>(&Bound), &BoundLength);
+
+        m_Socket = static_cast<std::intptr_t>(Socket);
+        m_LocalPort = ntohs(Bound.sin_port);
+        m_ReceiveBuffer.SetNum(BatchSize * ReceiveSlotSize);
+
+        Utils::Get().LogInfo(TEXT("NetTransport opened on port ") + FString::FromInt(m_LocalPort));
+        return true;
+    }
+
+    void NetTransport::Close()
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        // Let peers know now rather than waiting for them to time out
+        TArray<int32> ConnectionIDs;
+        for (const auto& pair : m_Peers)
+        {
+            ConnectionIDs.Add(pair.first);
+        }
+        for (int32 ConnectionID : ConnectionIDs)
+        {
+            RemovePeer(ConnectionID, true);
+        }
+        SendBatch(GetTime());
+
+        CloseNativeSocket(ToNative(m_Socket));
+        m_Socket = InvalidSocket;
+        m_LocalPort = 0;
+        m_Delayed.Empty();
+        m_Inbox.Empty();
+        m_InboxData.Empty();
+        m_Disconnected.Empty();
+        m_DeliveryNotices.Empty();
+    }
+
+    bool NetTransport::IsOpen() const
+    {
+        return m_Socket != InvalidSocket;
+    }
+
+    void NetTransport::AddPeer(int32 ConnectionID, const NetAddress& Address)
+    {
+        Peer* Existing = FindPeer(ConnectionID);
+        if (Existing && Existing->Address == Address)
+        {
+            return;
+        }
+        if (Existing)
+        {
+            RemovePeer(ConnectionID, false);
+        }
+
+        AddPeerInternal(ConnectionID, Address, GetTime());
+    }
+
+    void NetTransport::RemovePeer(int32 ConnectionID, bool bNotifyRemote)
+    {
+        Peer* Target = FindPeer(ConnectionID);
+        if (!Target)
+        {
+            return;
+        }
+
+        // Untracked and unreliable - if it's lost the remote side times out instead
+        if (bNotifyRemote && IsOpen())
+        {
+            const uint8* Data = BeginDatagram(*Target, FlagDisconnect);
+            QueueDatagram(Target->Address, Data, PacketHeaderSize, GetTime());
+        }
+
+        // Nothing is coming back for whatever is still in flight or queued
+        for (SentPacket& Packet : Target->SentPackets)
+        {
+            if (Packet.bInUse)
+            {
+                NotifyReceipts(ConnectionID, Packet.Receipts, false);
+            }
+        }
+        for (const UnreliableMessage& Message : Target->UnreliableQueue)
+        {
+            if (Message.Receipt != 0)
+            {
+                m_DeliveryNotices.Add({ ConnectionID, Message.Receipt, false });
+            }
+        }
+
+        m_PeersByAddress.Remove(Target->Address);
+        m_Peers.Remove(ConnectionID);
+    }
+
+    const NetAddress* NetTransport::GetPeerAddress(int32 ConnectionID) const
+    {
+        const Peer* Target = m_Peers.Find(ConnectionID);
+        return Target ? &Target->Address : nullptr;
+    }
+
+    bool NetTransport::Send(int32 ConnectionID, uint8 Channel, const NetPacketBuffer& Payload, bool bReliable, uint32 Receipt)
+    {
+        Peer* Target = FindPeer(ConnectionID);
+        if (!Target || !Payload)
+        {
+            return false;
+        }
+
+        if (Payload->Num() > MaxMessageSize)
+        {
+            Utils::Get().LogWarning(TEXT("NetTransport::Send - Message too large (") + FString::FromInt(Payload->Num()) + TEXT(" bytes) for connection ") + FString::FromInt(ConnectionID));
+            return false;
+        }
+
+        if (bReliable)
+        {
+            Target->ReliableQueue.push_back({ Target->NextReliableID++, Channel, Payload, -1.0, 0, false });
+        }
+        else
+        {
+            Target->UnreliableQueue.Add({ Channel, Payload, Receipt });
+        }
+        return true;
+    }
+
+    void NetTransport::Receive()
+    {
+        PROFILE_SCOPE("NetTransport::Receive");
+        MEMORY_TAG_SCOPE(Network);
+
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        double Now = GetTime();
+        NativeSocket Socket = ToNative(m_Socket);
+        uint8* Slots = m_ReceiveBuffer.GetData();
+
+#if defined(__linux__)
+        mmsghdr Messages[BatchSize];
+        iovec Vectors[BatchSize];
+        sockaddr_in Addresses[BatchSize];
+
+        for (;;)
+        {
+            for (int32 i = 0; i < BatchSize; ++i)
+            {
+                Vectors[i].iov_base = Slots + i * ReceiveSlotSize;
+                Vectors[i].iov_len = ReceiveSlotSize;
+                std::memset(&Messages[i], 0, sizeof(mmsghdr));
+                Messages[i].msg_hdr.msg_name = &Addresses[i];
+                Messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                Messages[i].msg_hdr.msg_iov = &Vectors[i];
+                Messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            int Count = recvmmsg(Socket, Messages, BatchSize, MSG_DONTWAIT, nullptr);
+            if (Count <= 0)
+            {
+                break;
+            }
+
+            for (int32 i = 0; i < Count; ++i)
+            {
+                ProcessDatagram(FromSockAddr(Addresses[i]), Slots + i * ReceiveSlotSize, static_cast<int32>(Messages[i].msg_len), Now);
+            }
+
+            if (Count < BatchSize)
+            {
+                break;
+            }
+        }
+#else
+        for (;;)
+        {
+            sockaddr_in From;
+            NativeAddressLength FromLength = sizeof(From);
+            int Received = recvfrom(Socket, reinterpret_cast<char*>(Slots), ReceiveSlotSize, 0, reinterpret_cast<sockaddr*>(&From), &FromLength);
+            if (Received < 0)
+            {
+#if defined(_WIN32)
+                // An ICMP port unreachable from an earlier send, not a problem with this socket
+                if (WSAGetLastError() == WSAECONNRESET)
+                {
+                    continue;
+                }
+#endif
+                break;
+            }
+
+            ProcessDatagram(FromSockAddr(From), Slots, Received, Now);
+        }
+#endif
+
+        // Peers that have gone quiet for too long
+        TArray<int32> TimedOut;
+        for (const auto& pair : m_Peers)
+        {
+            if (Now - pair.second.LastReceiveTime > m_ConnectionTimeout)
+            {
+                TimedOut.Add(pair.first);
+            }
+        }
+        for (int32 ConnectionID : TimedOut)
+        {
+            Utils::Get().LogWarning(TEXT("NetTransport - Connection timed out: ") + FString::FromInt(ConnectionID));
+            RemovePeer(ConnectionID, false);
+            m_Disconnected.Add(ConnectionID);
+        }
+
+        DeliverInbox();
+    }
+
+    void NetTransport::Flush()
+    {
+        PROFILE_SCOPE("NetTransport::Flush");
+        MEMORY_TAG_SCOPE(Network);
+
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        double Now = GetTime();
+        for (auto& pair : m_Peers)
+        {
+            DetectLosses(pair.second, Now);
+            BuildPackets(pair.second, Now);
+            UpdateStats(pair.second);
+        }
+
+        SendBatch(Now);
+        DeliverNotices();
+    }
+
+    void NetTransport::SetSimulation(const NetSimulationSettings& Settings)
+    {
+        m_Simulation = Settings;
+        m_SimulationRandom.seed(Settings.Seed != 0 ? Settings.Seed : std::random_device()());
+    }
+
+    const NetTransportStats* NetTransport::GetStats(int32 ConnectionID) const
+    {
+        const Peer* Target = m_Peers.Find(ConnectionID);
+        return Target ? &Target->Stats : nullptr;
+    }
+
+    int32 NetTransport::GetSendRate(int32 ConnectionID) const
+    {
+        const Peer* Target = m_Peers.Find(ConnectionID);
+        if (!Target || !Target->bHasRTT)
+        {
+            return 0;
+        }
+
+        // One congestion window per round trip
+        return static_cast<int32>(Target->CongestionWindow / std::max(Target->SmoothedRTT, 0.001f));
+    }
+
+    double NetTransport::GetTime() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    NetTransport::Peer* NetTransport::FindPeer(int32 ConnectionID)
+    {
+        return m_Peers.Find(ConnectionID);
+    }
+
+    NetTransport::Peer* NetTransport::AddPeerInternal(int32 ConnectionID, const NetAddress& Address, double Now)
+    {
+        Peer& Target = m_Peers.FindOrAdd(ConnectionID);
+        Target = Peer();
+        Target.ConnectionID = ConnectionID;
+        Target.Address = Address;
+        Target.SentPackets.SetNum(SentPacketSlots);
+        Target.ReceiveBuffer.SetNum(ReliableWindow);
+        Target.LastReceiveTime = Now;
+        Target.LastSendTime = Now;
+        Target.CongestionWindow = static_cast<float>(InitialCongestionPackets * MaxPacketSize);
+        Target.SlowStartThreshold = MaxCongestionWindow;
+        UpdateStats(Target);
+
+        m_PeersByAddress.Add(Address, ConnectionID);
+        return &Target;
+    }
+
+    void NetTransport::ProcessDatagram(const NetAddress& From, const uint8* Data, int32 Size, double Now)
+    {
+        if (Size < PacketHeaderSize || ReadU16(Data) != ProtocolMagic)
+        {
+            return;
+        }
+
+        uint8 Flags = Data[2];
+        uint16 Sequence = ReadU16(Data + 3);
+        uint16 Ack = ReadU16(Data + 5);
+        uint32 AckBits = ReadU32(Data + 7);
+        m_TotalBytesReceived += Size;
+        StatsRegistry::AddCounter(StatWireBytesReceived, Size);
+
+        const int32* KnownID = m_PeersByAddress.Find(From);
+        Peer* Target = KnownID ? FindPeer(*KnownID) : nullptr;
+        if (!Target)
+        {
+            if ((Flags & FlagDisconnect) || !m_OnUnknownPeerCallback)
+            {
+                return;
+            }
+
+            int32 ConnectionID = m_OnUnknownPeerCallback(From);
+            if (ConnectionID < 0)
+            {
+                return;
+            }
+
+            // The callback may already have added the peer through AddPeer
+            Target = FindPeer(ConnectionID);
+            if (!Target)
+            {
+                Target = AddPeerInternal(ConnectionID, From, Now);
+            }
+        }
+
+        if (Flags & FlagDisconnect)
+        {
+            int32 ConnectionID = Target->ConnectionID;
+            RemovePeer(ConnectionID, false);
+            m_Disconnected.Add(ConnectionID);
+            return;
+        }
+
+        Target->LastReceiveTime = Now;
+        Target->Stats.PacketsReceived++;
+
+        if (Flags & FlagHasAck)
+        {
+            ProcessAcks(*Target, Ack, AckBits, Now);
+        }
+
+        // Duplicates and packets too old to ack are dropped - reliable data in them gets resent
+        bool bOutOfOrder = Target->bReceivedAny && !SequenceGreater(Sequence, Target->RemoteSequence);
+        if (!AcceptSequence(*Target, Sequence))
+        {
+            return;
+        }
+        Target->bAckPending = true;
+        bool bDroppedStale = false;
+
+        int32 Offset = PacketHeaderSize;
+        while (Offset < Size)
+        {
+            uint8 Type = Data[Offset++];
+            bool bReliable = (Type & ReliableBit) != 0;
+            uint8 Channel = static_cast<uint8>(Type & ~ReliableBit);
+
+            uint16 MessageID = 0;
+            if (bReliable)
+            {
+                if (Offset + 2 > Size)
+                {
+                    break;
+                }
+                MessageID = ReadU16(Data + Offset);
+                Offset += 2;
+            }
+
+            if (Offset + 2 > Size)
+            {
+                break;
+            }
+            int32 Length = ReadU16(Data + Offset);
+            Offset += 2;
+
+            // Malformed - keep whatever came before it
+            if (Offset + Length > Size)
+            {
+                break;
+            }
+
+            if (bReliable)
+            {
+                ReceiveReliable(*Target, MessageID, Channel, Data + Offset, Length);
+            }
+            else if (bOutOfOrder)
+            {
+                // Would overwrite whatever the newer packet already delivered
+                Target->Stats.UnreliableStale++;
+                bDroppedStale = true;
+            }
+            else
+            {
+                QueueInboxMessage(Target->ConnectionID, Channel, Data + Offset, Length);
+            }
+            Offset += Length;
+        }
+        
+        // Leave the packet unacked so the sender declares it lost and reports its receipts that way.
+        // Its reliable messages were taken, the resends are dropped as duplicates.
+        if (bDroppedStale)
+        {
+            uint16 Distance = static_cast<uint16>(Target->RemoteSequence - Sequence);
+            Target->ReceivedBits &= ~(1u << (Distance - 1));
+        }
+    }
+
+    bool NetTransport::AcceptSequence(Peer& Target, uint16 Sequence)
+    {
+        if (!Target.bReceivedAny)
+        {
+            Target.bReceivedAny = true;
+            Target.RemoteSequence = Sequence;
+            Target.ReceivedBits = 0;
+            return true;
+        }
+
+        if (SequenceGreater(Sequence, Target.RemoteSequence))
+        {
+            // Slide the window forward, the old newest sequence becomes a bit
+            uint16 Shift = static_cast<uint16>(Sequence - Target.RemoteSequence);
+            Target.ReceivedBits = Shift >= 32 ? 0 : (Target.ReceivedBits << Shift);
+            if (Shift <= 32)
+            {
+                Target.ReceivedBits |= 1u << (Shift - 1);
+            }
+            Target.RemoteSequence = Sequence;
+            return true;
+        }
+
+        uint16 Distance = static_cast<uint16>(Target.RemoteSequence - Sequence);
+        if (Distance == 0 || Distance > 32)
+        {
+            return false;
+        }
+
+        uint32 Bit = 1u << (Distance - 1);
+        if (Target.ReceivedBits & Bit)
+        {
+            return false;
+        }
+        Target.ReceivedBits |= Bit;
+        return true;
+    }
+
+    void NetTransport::ProcessAcks(Peer& Target, uint16 Ack, uint32 AckBits, double Now)
+    {
+        AckPacket(Target, Ack, Now);
+        for (int32 i = 0; i < 32; ++i)
+        {
+            if (AckBits & (1u << i))
+            {
+                AckPacket(Target, static_cast<uint16>(Ack - 1 - i), Now);
+            }
+        }
+    }
+
+    void NetTransport::AckPacket(Peer& Target, uint16 Sequence, double Now)
+    {
+        SentPacket& Packet = Target.SentPackets[Sequence % SentPacketSlots];
+        if (!Packet.bInUse || Packet.Sequence != Sequence)
+        {
+            return;
+        }
+
+        Packet.bInUse = false;
+        auto It = std::find(Target.InFlight.begin(), Target.InFlight.end(), Sequence);
+        if (It != Target.InFlight.end())
+        {
+            Target.InFlight.erase(It);
+        }
+        Target.Stats.BytesInFlight -= Packet.Size;
+        Target.Stats.PacketLoss *= 0.95f;
+
+        // RTT and variation (RFC 6298) - every send has its own sequence, so samples are never ambiguous
+        float Sample = static_cast<float>(Now - Packet.SendTime);
+        if (!Target.bHasRTT)
+        {
+            Target.SmoothedRTT = Sample;
+            Target.RTTVariance = Sample * 0.5f;
+            Target.bHasRTT = true;
+        }
+        else
+        {
+            Target.RTTVariance = 0.75f * Target.RTTVariance + 0.25f * std::fabs(Target.SmoothedRTT - Sample);
+            Target.SmoothedRTT = 0.875f * Target.SmoothedRTT + 0.125f * Sample;
+        }
+
+        // Reliable messages carried by this packet are delivered
+        for (uint16 MessageID : Packet.ReliableIDs)
+        {
+            if (Target.ReliableQueue.empty())
+            {
+                break;
+            }
+            uint16 Index = static_cast<uint16>(MessageID - Target.ReliableQueue.front().MessageID);
+            if (Index < Target.ReliableQueue.size())
+            {
+                Target.ReliableQueue[Index].bAcked = true;
+            }
+        }
+        while (!Target.ReliableQueue.empty() && Target.ReliableQueue.front().bAcked)
+        {
+            Target.ReliableQueue.pop_front();
+        }
+        Packet.ReliableIDs.Empty();
+        NotifyReceipts(Target.ConnectionID, Packet.Receipts, true);
+
+        // Congestion window - slow start grows it by what was acked, after that about one packet per round trip
+        if (Target.bInRecovery && !SequenceGreater(Target.RecoverySequence, Sequence))
+        {
+            Target.bInRecovery = false;
+        }
+        if (Target.CongestionWindow < Target.SlowStartThreshold)
+        {
+            Target.CongestionWindow += static_cast<float>(Packet.Size);
+        }
+        else
+        {
+            Target.CongestionWindow += static_cast<float>(MaxPacketSize) * Packet.Size / Target.CongestionWindow;
+        }
+        Target.CongestionWindow = std::min(Target.CongestionWindow, MaxCongestionWindow);
+    }
+
+    void NetTransport::ReceiveReliable(Peer& Target, uint16 MessageID, uint8 Channel, const uint8* Data, int32 Size)
+    {
+        // Behind the window means already delivered (a resend whose ack was lost)
+        uint16 Distance = static_cast<uint16>(MessageID - Target.NextReceiveID);
+        if (Distance >= ReliableWindow)
+        {
+            return;
+        }
+
+        if (Distance > 0)
+        {
+            ReceivedReliable& Slot = Target.ReceiveBuffer[MessageID % ReliableWindow];
+            if (!Slot.bValid)
+            {
+                Slot.bValid = true;
+                Slot.Channel = Channel;
+                Slot.Data.SetNum(Size);
+                if (Size > 0)
+                {
+                    std::memcpy(Slot.Data.GetData(), Data, Size);
+                }
+            }
+            return;
+        }
+
+        QueueInboxMessage(Target.ConnectionID, Channel, Data, Size);
+        Target.NextReceiveID++;
+
+        // Anything that arrived early and was waiting on this one
+        for (;;)
+        {
+            ReceivedReliable& Slot = Target.ReceiveBuffer[Target.NextReceiveID % ReliableWindow];
+            if (!Slot.bValid)
+            {
+                break;
+            }
+            QueueInboxMessage(Target.ConnectionID, Slot.Channel, Slot.Data.GetData(), Slot.Data.Num());
+            Slot.bValid = false;
+            Target.NextReceiveID++;
+        }
+    }
+
+    void NetTransport::QueueInboxMessage(int32 ConnectionID, uint8 Channel, const uint8* Data, int32 Size)
+    {
+        int32 Offset = m_InboxData.Num();
+        m_InboxData.SetNum(Offset + Size);
+        if (Size > 0)
+        {
+            std::memcpy(m_InboxData.GetData() + Offset, Data, Size);
+        }
+        m_Inbox.Add({ ConnectionID, Channel, Offset, Size });
+    }
+
+    void NetTransport::DeliverInbox()
+    {
+        if (m_OnMessageCallback)
+        {
+            for (const InboxMessage& Message : m_Inbox)
+            {
+                m_OnMessageCallback(Message.ConnectionID, Message.Channel, m_InboxData.GetData() + Message.Offset, Message.Size);
+            }
+        }
+        m_Inbox.Empty();
+        m_InboxData.Empty();
+
+        if (m_OnPeerDisconnectedCallback)
+        {
+            for (int32 ConnectionID : m_Disconnected)
+            {
+                m_OnPeerDisconnectedCallback(ConnectionID);
+            }
+        }
+        m_Disconnected.Empty();
+
+        DeliverNotices();
+    }
+
+    void NetTransport::DeliverNotices()
+    {
+        if (m_OnDeliveryCallback)
+        {
+            for (const DeliveryNotice& Notice : m_DeliveryNotices)
+            {
+                m_OnDeliveryCallback(Notice.ConnectionID, Notice.Receipt, Notice.bDelivered);
+            }
+        }
+        m_DeliveryNotices.Empty();
+    }
+
+    void NetTransport::NotifyReceipts(int32 ConnectionID, TArray<uint32>& Receipts, bool bDelivered)
+    {
+        for (uint32 Receipt : Receipts)
+        {
+            m_DeliveryNotices.Add({ ConnectionID, Receipt, bDelivered });
+        }
+        Receipts.Empty();
+    }
+
+    void NetTransport::DetectLosses(Peer& Target, double Now)
+    {
+        // In-flight packets are in send order, so everything past the first recent one is recent too
+        float Timeout = GetRetransmitTimeout(Target);
+        while (!Target.InFlight.empty())
+        {
+            SentPacket& Packet = Target.SentPackets[Target.InFlight.front() % SentPacketSlots];
+            if (Now - Packet.SendTime < Timeout)
+            {
+                break;
+            }
+            Target.InFlight.pop_front();
+            OnPacketLost(Target, Packet);
+        }
+    }
+
+    void NetTransport::OnPacketLost(Peer& Target, SentPacket& Packet)
+    {
+        Packet.bInUse = false;
+        Target.Stats.BytesInFlight -= Packet.Size;
+        Target.Stats.PacketsLost++;
+        Target.Stats.PacketLoss = Target.Stats.PacketLoss * 0.95f + 0.05f;
+
+        // Reliable messages that haven't been acked through another packet go out again
+        if (!Target.ReliableQueue.empty())
+        {
+            uint16 FrontID = Target.ReliableQueue.front().MessageID;
+            for (uint16 MessageID : Packet.ReliableIDs)
+            {
+                uint16 Index = static_cast<uint16>(MessageID - FrontID);
+                if (Index < Target.ReliableQueue.size() && !Target.ReliableQueue[Index].bAcked)
+                {
+                    Target.ReliableQueue[Index].LastSendTime = -1.0;
+                }
+            }
+        }
+        Packet.ReliableIDs.Empty();
+        NotifyReceipts(Target.ConnectionID, Packet.Receipts, false);
+
+        // Multiplicative decrease, once per window - losses from packets sent before the cut don't count again
+        if (!Target.bInRecovery || !SequenceGreater(Target.RecoverySequence, Packet.Sequence))
+        {
+            Target.SlowStartThreshold = std::max(Target.CongestionWindow * 0.5f, static_cast<float>(2 * MaxPacketSize));
+            Target.CongestionWindow = Target.SlowStartThreshold;
+            Target.RecoverySequence = Target.LocalSequence;
+            Target.bInRecovery = true;
+        }
+    }
+
+    void NetTransport::BuildPackets(Peer& Target, double Now)
+    {
+        float Timeout = GetRetransmitTimeout(Target);
+        int32 ReliableLimit = std::min(static_cast<int32>(Target.ReliableQueue.size()), ReliableWindow);
+        int32 ReliableCursor = 0;
+        int32 UnreliableCursor = 0;
+        bool bSentAny = false;
+
+        // Reliable messages go when first queued and again whenever they've gone a timeout without an ack
+        auto SkipToDueReliable = [&]()
+        {
+            while (ReliableCursor < ReliableLimit)
+            {
+                const ReliableMessage& Message = Target.ReliableQueue[ReliableCursor];
+                if (!Message.bAcked && (Message.LastSendTime < 0.0 || Now - Message.LastSendTime > Timeout))
+                {
+                    break;
+                }
+                ReliableCursor++;
+            }
+        };
+        SkipToDueReliable();
+
+        while (ReliableCursor < ReliableLimit || UnreliableCursor < Target.UnreliableQueue.Num())
+        {
+            // Window full - reliable messages wait for acks, unreliable ones are dropped below
+            if (Target.Stats.BytesInFlight >= static_cast<int32>(Target.CongestionWindow))
+            {
+                break;
+            }
+
+            uint8* Out = BeginDatagram(Target, FlagHasAck);
+            int32 Size = PacketHeaderSize;
+            m_PacketReliableIDs.Empty();
+            m_PacketReceipts.Empty();
+
+            while (ReliableCursor < ReliableLimit)
+            {
+                ReliableMessage& Message = Target.ReliableQueue[ReliableCursor];
+                if (Size + MaxMessageHeaderSize + Message.Payload->Num() > MaxPacketSize)
+                {
+                    break;
+                }
+
+                Size = WriteMessage(Out, Size, true, Message.MessageID, Message.Channel, *Message.Payload);
+                if (Message.SendCount > 0)
+                {
+                    Target.Stats.ReliableResends++;
+                }
+                Message.SendCount++;
+                Message.LastSendTime = Now;
+                m_PacketReliableIDs.Add(Message.MessageID);
+
+                ReliableCursor++;
+                SkipToDueReliable();
+            }
+
+            while (UnreliableCursor < Target.UnreliableQueue.Num())
+            {
+                const UnreliableMessage& Message = Target.UnreliableQueue[UnreliableCursor];
+                if (Size + MaxMessageHeaderSize - 2 + Message.Payload->Num() > MaxPacketSize)
+                {
+                    break;
+                }
+
+                Size = WriteMessage(Out, Size, false, 0, Message.Channel, *Message.Payload);
+                if (Message.Receipt != 0)
+                {
+                    m_PacketReceipts.Add(Message.Receipt);
+                }
+                UnreliableCursor++;
+            }
+
+            FinishDatagram(Target, Out, Size, Now);
+            bSentAny = true;
+        }
+
+        Target.Stats.UnreliableDropped += Target.UnreliableQueue.Num() - UnreliableCursor;
+        for (int32 i = UnreliableCursor; i < Target.UnreliableQueue.Num(); ++i)
+        {
+            if (Target.UnreliableQueue[i].Receipt != 0)
+            {
+                m_DeliveryNotices.Add({ Target.ConnectionID, Target.UnreliableQueue[i].Receipt, false });
+            }
+        }
+        Target.UnreliableQueue.Empty();
+
+        // Nothing else went out - acks and keepalives still need a packet
+        if (!bSentAny && (Target.bAckPending || Now - Target.LastSendTime > KeepAliveInterval))
+        {
+            m_PacketReliableIDs.Empty();
+            m_PacketReceipts.Empty();
+            FinishDatagram(Target, BeginDatagram(Target, FlagHasAck), PacketHeaderSize, Now);
+        }
+    }
+
+    uint8* NetTransport::BeginDatagram(Peer& Target, uint8 Flags)
+    {
+        // Pooled buffers keep their storage, so pointers stay valid until the batch is sent
+        if (m_UsedSendBuffers == m_SendBuffers.Num())
+        {
+            m_SendBuffers.Emplace().SetNum(MaxPacketSize);
+        }
+        uint8* Out = m_SendBuffers[m_UsedSendBuffers++].GetData();
+
+        if (!Target.bReceivedAny)
+        {
+            Flags &= ~FlagHasAck;
+        }
+
+        WriteU16(Out, ProtocolMagic);
+        Out[2] = Flags;
+        WriteU16(Out + 3, Target.LocalSequence);
+        WriteU16(Out + 5, Target.RemoteSequence);
+        WriteU32(Out + 7, Target.ReceivedBits);
+        return Out;
+    }
+
+    void NetTransport::FinishDatagram(Peer& Target, const uint8* Data, int32 Size, double Now)
+    {
+        uint16 Sequence = Target.LocalSequence++;
+        SentPacket& Packet = Target.SentPackets[Sequence % SentPacketSlots];
+
+        // A whole slot ring in flight - the oldest packet is as good as lost
+        if (Packet.bInUse)
+        {
+            auto It = std::find(Target.InFlight.begin(), Target.InFlight.end(), Packet.Sequence);
+            if (It != Target.InFlight.end())
+            {
+                Target.InFlight.erase(It);
+            }
+            OnPacketLost(Target, Packet);
+        }
+
+        Packet.Sequence = Sequence;
+        Packet.bInUse = true;
+        Packet.SendTime = Now;
+        Packet.Size = Size;
+        Packet.ReliableIDs = m_PacketReliableIDs;
+        Packet.Receipts = m_PacketReceipts;
+
+        Target.InFlight.push_back(Sequence);
+        Target.Stats.BytesInFlight += Size;
+        Target.Stats.PacketsSent++;
+        Target.LastSendTime = Now;
+        Target.bAckPending = false;
+
+        QueueDatagram(Target.Address, Data, Size, Now);
+    }
+
+    void NetTransport::QueueDatagram(const NetAddress& Address, const uint8* Data, int32 Size, double Now)
+    {
+        if (!m_Simulation.IsEnabled())
+        {
+            m_Outgoing.Add({ Address, Data, Size });
+            return;
+        }
+
+        std::uniform_real_distribution<float> Roll(0.0f, 1.0f);
+        if (Roll(m_SimulationRandom) < m_Simulation.PacketLoss)
+        {
+            return;
+        }
+
+        int32 Copies = Roll(m_SimulationRandom) < m_Simulation.Duplicate ? 2 : 1;
+        for (int32 i = 0; i < Copies; ++i)
+        {
+            float Delay = m_Simulation.Latency + m_Simulation.Jitter * Roll(m_SimulationRandom);
+            if (Roll(m_SimulationRandom) < m_Simulation.Reorder)
+            {
+                Delay += m_Simulation.ReorderDelay;
+            }
+            if (Delay <= 0.0f)
+            {
+                m_Outgoing.Add({ Address, Data, Size });
+                continue;
+            }
+
+            // Delayed packets outlive the pooled buffer, so they keep a copy
+            DelayedDatagram& Delayed = m_Delayed.Emplace();
+            Delayed.ReleaseTime = Now + Delay;
+            Delayed.Address = Address;
+            Delayed.Data.SetNum(Size);
+            std::memcpy(Delayed.Data.GetData(), Data, Size);
+        }
+    }
+
+    void NetTransport::SendBatch(double Now)
+    {
+        // Simulated packets whose delay is up join this batch
+        int32 DueCount = 0;
+        for (DelayedDatagram& Delayed : m_Delayed)
+        {
+            if (Delayed.ReleaseTime <= Now)
+            {
+                m_Outgoing.Add({ Delayed.Address, Delayed.Data.GetData(), Delayed.Data.Num() });
+                DueCount++;
+            }
+        }
+
+        NativeSocket Socket = ToNative(m_Socket);
+        int32 Count = m_Outgoing.Num();
+        int64 BytesSentBefore = m_TotalBytesSent;
+
+#if defined(__linux__)
+        mmsghdr Messages[BatchSize];
+        iovec Vectors[BatchSize];
+        sockaddr_in Addresses[BatchSize];
+
+        for (int32 Start = 0; Start < Count; Start += BatchSize)
+        {
+            int32 ChunkCount = std::min(BatchSize, Count - Start);
+            for (int32 i = 0; i < ChunkCount; ++i)
+            {
+                const OutgoingDatagram& Datagram = m_Outgoing[Start + i];
+                Addresses[i] = ToSockAddr(Datagram.Address);
+                Vectors[i].iov_base = const_cast<uint8*>(Datagram.Data);
+                Vectors[i].iov_len = Datagram.Size;
+                std::memset(&Messages[i], 0, sizeof(mmsghdr));
+                Messages[i].msg_hdr.msg_name = &Addresses[i];
+                Messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                Messages[i].msg_hdr.msg_iov = &Vectors[i];
+                Messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            int32 Sent = 0;
+            while (Sent < ChunkCount)
+            {
+                int Result = sendmmsg(Socket, Messages + Sent, ChunkCount - Sent, 0);
+                if (Result < 0)
+                {
+                    // Kernel queue full - the rest of the chunk is lost like any other dropped datagram
+                    if (WouldBlock())
+                    {
+                        break;
+                    }
+                    Sent++;
+                    continue;
+                }
+                for (int32 i = 0; i < Result; ++i)
+                {
+                    m_TotalBytesSent += m_Outgoing[Start + Sent + i].Size;
+                }
+                Sent += Result;
+            }
+        }
+#else
+        for (const OutgoingDatagram& Datagram : m_Outgoing)
+        {
+            sockaddr_in To = ToSockAddr(Datagram.Address);
+            int Result = sendto(Socket, reinterpret_cast<const char*>(Datagram.Data), Datagram.Size, 0, reinterpret_cast<const sockaddr*>(&To), sizeof(To));
+            if (Result > 0)
+            {
+                m_TotalBytesSent += Result;
+            }
+        }
+#endif
+
+        StatsRegistry::AddCounter(StatWireBytesSent, m_TotalBytesSent - BytesSentBefore);
+        StatsRegistry::AddCounter(StatDatagramsSent, Count);
+        m_Outgoing.Empty();
+        m_UsedSendBuffers = 0;
+
+        if (DueCount > 0)
+        {
+            int32 Kept = 0;
+            for (int32 i = 0; i < m_Delayed.Num(); ++i)
+            {
+                if (m_Delayed[i].ReleaseTime > Now)
+                {
+                    if (Kept != i)
+                    {
+                        m_Delayed[Kept] = std::move(m_Delayed[i]);
+                    }
+                    Kept++;
+                }
+            }
+            m_Delayed.SetNum(Kept);
+        }
+    }
+
+    float NetTransport::GetRetransmitTimeout(const Peer& Target) const
+    {
+        if (!Target.bHasRTT)
+        {
+            return InitialRetransmitTimeout;
+        }
+        return std::max(MinRetransmitTimeout, std::min(Target.SmoothedRTT + 4.0f * Target.RTTVariance, MaxRetransmitTimeout));
+    }
+
+    void NetTransport::UpdateStats(Peer& Target)
+    {
+        Target.Stats.RoundTripTime = Target.SmoothedRTT;
+        Target.Stats.Jitter = Target.RTTVariance;
+        Target.Stats.CongestionWindow = static_cast<int32>(Target.CongestionWindow);
+        Target.Stats.ReliablePending = static_cast<int32>(Target.ReliableQueue.size());
+    }
+}
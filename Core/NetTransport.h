@@ -0,0 +1,282 @@
+/*
+ * UE4 Net Transport - Self-contained UDP transport with reliability and congestion control
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <memory>
+#include <functional>
+#include <random>
+#include <deque>
+
+namespace UE4SDK
+{
+    // Shared packet payload - one buffer can be queued for many connections without a copy each
+    using NetPacketBuffer = std::shared_ptr<const TArray<uint8>>;
+
+    // IPv4 endpoint in host byte order
+    struct NetAddress
+    {
+        uint32 IP = 0;
+        uint16 Port = 0;
+
+        static NetAddress FromString(const FString& Address, int32 Port); // Dotted quad or "localhost"
+        FString ToString() const;
+        bool IsValid() const { return Port != 0; }
+
+        bool operator==(const NetAddress& Other) const { return IP == Other.IP && Port == Other.Port; }
+        bool operator!=(const NetAddress& Other) const { return !(*this == Other); }
+        bool operator<(const NetAddress& Other) const { return IP != Other.IP ? IP < Other.IP : Port < Other.Port; }
+    };
+
+    // Network conditions applied to outgoing packets, for testing over loopback
+    struct NetSimulationSettings
+    {
+        float PacketLoss = 0.0f; // 0-1 chance a packet is dropped
+        float Latency = 0.0f;    // Seconds added to every packet
+        float Jitter = 0.0f;     // Up to this many extra seconds, so packets can arrive out of order
+        float Duplicate = 0.0f;  // 0-1 chance a packet is sent twice
+        float Reorder = 0.0f;    // 0-1 chance a packet is held back by ReorderDelay, so the ones after it overtake it
+        float ReorderDelay = 0.02f;
+        uint32 Seed = 0;         // 0 picks a random seed
+
+        bool IsEnabled() const { return PacketLoss > 0.0f || Latency > 0.0f || Jitter > 0.0f || Duplicate > 0.0f || Reorder > 0.0f; }
+    };
+
+    // Per-connection transport stats
+    struct NetTransportStats
+    {
+        float RoundTripTime = 0.0f; // Smoothed, seconds
+        float Jitter = 0.0f;        // Round trip variation, seconds
+        float PacketLoss = 0.0f;    // Smoothed fraction of packets declared lost
+        int32 CongestionWindow = 0; // Bytes allowed in flight
+        int32 BytesInFlight = 0;
+        int32 PacketsSent = 0;
+        int32 PacketsReceived = 0;
+        int32 PacketsLost = 0;
+        int32 ReliableResends = 0;
+        int32 ReliablePending = 0;   // Reliable messages queued or waiting on an ack
+        int32 UnreliableDropped = 0; // Dropped because the congestion window was full
+        int32 UnreliableStale = 0;   // Received behind a newer packet and dropped
+    };
+
+    // Net transport - non-blocking UDP socket with sequenced packets, ack bitfields, ordered reliable
+    // messages, RTT/jitter estimation and AIMD congestion control. Sends and receives are batched
+    // (sendmmsg/recvmmsg on Linux). Peers are keyed by connection IDs the owner assigns; tick from one thread.
+    class NetTransport
+    {
+    public:
+        static constexpr int32 MaxPacketSize = 1200; // Stays under common path MTUs, packets are never fragmented
+        static constexpr int32 PacketHeaderSize = 11;
+        static constexpr int32 MaxMessageHeaderSize = 5;
+        static constexpr int32 MaxMessageSize = MaxPacketSize - PacketHeaderSize - MaxMessageHeaderSize;
+
+        NetTransport();
+        ~NetTransport();
+
+        NetTransport(const NetTransport&) = delete;
+        NetTransport& operator=(const NetTransport&) = delete;
+
+        // Socket - port 0 binds an ephemeral port
+        bool Open(int32 Port);
+        void Close();
+        bool IsOpen() const;
+        int32 GetLocalPort() const { return m_LocalPort; }
+
+        // Peers - RemovePeer sends a best-effort disconnect unless told not to
+        void AddPeer(int32 ConnectionID, const NetAddress& Address);
+        void RemovePeer(int32 ConnectionID, bool bNotifyRemote = true);
+        bool HasPeer(int32 ConnectionID) const { return m_Peers.Contains(ConnectionID); }
+        const NetAddress* GetPeerAddress(int32 ConnectionID) const;
+
+        // Sending - queued until the next flush. Reliable messages arrive exactly once and in order;
+        // unreliable ones are dropped on loss, when the congestion window is full, or when they arrive behind
+        // a newer packet - that packet is left unacked so it counts as lost. A non-zero Receipt on an
+        // unreliable message is reported once through the delivery callback - delivered when its packet is
+        // acked, lost when the packet is lost, the message is dropped or the peer is removed. Close reports nothing.
+        bool Send(int32 ConnectionID, uint8 Channel, const NetPacketBuffer& Payload, bool bReliable, uint32 Receipt = 0);
+
+        // Receive reads everything waiting on the socket; Flush resends lost reliable messages
+        // and writes every queued packet in one batch. Tick does both.
+        void Receive();
+        void Flush();
+        void Tick() { Receive(); Flush(); }
+
+        // Settings
+        void SetSimulation(const NetSimulationSettings& Settings);
+        const NetSimulationSettings& GetSimulation() const { return m_Simulation; }
+        void SetConnectionTimeout(float Seconds) { m_ConnectionTimeout = Seconds; }
+        float GetConnectionTimeout() const { return m_ConnectionTimeout; }
+
+        // Stats - send rate is what the congestion window allows per second, 0 before the first RTT sample
+        const NetTransportStats* GetStats(int32 ConnectionID) const;
+        int32 GetSendRate(int32 ConnectionID) const;
+        int64 GetTotalBytesSent() const { return m_TotalBytesSent; }
+        int64 GetTotalBytesReceived() const { return m_TotalBytesReceived; }
+
+        // Callbacks - an unknown peer is accepted by returning a connection ID, -1 ignores it
+        void SetOnUnknownPeerCallback(std::function<int32(const NetAddress&)> Callback) { m_OnUnknownPeerCallback = Callback; }
+        void SetOnMessageCallback(std::function<void(int32, uint8, const uint8*, int32)> Callback) { m_OnMessageCallback = Callback; }
+        void SetOnPeerDisconnectedCallback(std::function<void(int32)> Callback) { m_OnPeerDisconnectedCallback = Callback; }
+        void SetOnDeliveryCallback(std::function<void(int32, uint32, bool)> Callback) { m_OnDeliveryCallback = Callback; }
+
+    private:
+        static constexpr int32 SentPacketSlots = 256;
+        static constexpr int32 ReliableWindow = 256;
+
+        struct SentPacket
+        {
+            uint16 Sequence = 0;
+            bool bInUse = false;
+            double SendTime = 0.0;
+            int32 Size = 0;
+            TArray<uint16> ReliableIDs;
+            TArray<uint32> Receipts; // Unreliable messages waiting on this packet's fate
+        };
+
+        struct ReliableMessage
+        {
+            uint16 MessageID;
+            uint8 Channel;
+            NetPacketBuffer Payload;
+            double LastSendTime; // Negative when due for a (re)send
+            int32 SendCount;
+            bool bAcked;
+        };
+
+        struct UnreliableMessage
+        {
+            uint8 Channel;
+            NetPacketBuffer Payload;
+            uint32 Receipt;
+        };
+
+        struct ReceivedReliable
+        {
+            bool bValid = false;
+            uint8 Channel = 0;
+            TArray<uint8> Data;
+        };
+
+        struct Peer
+        {
+            int32 ConnectionID = -1;
+            NetAddress Address;
+
+            // Packet sequencing - ReceivedBits holds the 32 sequences before RemoteSequence
+            uint16 LocalSequence = 0;
+            uint16 RemoteSequence = 0;
+            uint32 ReceivedBits = 0;
+            bool bReceivedAny = false;
+            bool bAckPending = false;
+            TArray<SentPacket> SentPackets;
+            std::deque<uint16> InFlight; // Unacked sequences, oldest first
+
+            // Reliable messages - the send queue is ordered by ID, acked entries leave from the front
+            uint16 NextReliableID = 0;
+            std::deque<ReliableMessage> ReliableQueue;
+            uint16 NextReceiveID = 0;
+            TArray<ReceivedReliable> ReceiveBuffer;
+            TArray<UnreliableMessage> UnreliableQueue;
+
+            // Timing and congestion
+            double LastReceiveTime = 0.0;
+            double LastSendTime = 0.0;
+            float SmoothedRTT = 0.0f;
+            float RTTVariance = 0.0f;
+            bool bHasRTT = false;
+            float CongestionWindow = 0.0f;
+            float SlowStartThreshold = 0.0f;
+            uint16 RecoverySequence = 0;
+            bool bInRecovery = false;
+
+            NetTransportStats Stats;
+        };
+
+        struct OutgoingDatagram
+        {
+            NetAddress Address;
+            const uint8* Data;
+            int32 Size;
+        };
+
+        struct DelayedDatagram
+        {
+            double ReleaseTime;
+            NetAddress Address;
+            TArray<uint8> Data;
+        };
+
+        struct InboxMessage
+        {
+            int32 ConnectionID;
+            uint8 Channel;
+            int32 Offset;
+            int32 Size;
+        };
+
+        struct DeliveryNotice
+        {
+            int32 ConnectionID;
+            uint32 Receipt;
+            bool bDelivered;
+        };
+
+        std::intptr_t m_Socket;
+        int32 m_LocalPort;
+
+        TMap<int32, Peer> m_Peers;
+        TMap<NetAddress, int32> m_PeersByAddress;
+
+        // Flush state - datagram buffers are pooled and reused every flush
+        TArray<TArray<uint8>> m_SendBuffers;
+        int32 m_UsedSendBuffers;
+        TArray<OutgoingDatagram> m_Outgoing;
+        TArray<uint16> m_PacketReliableIDs;
+        TArray<uint32> m_PacketReceipts;
+        TArray<DelayedDatagram> m_Delayed;
+        TArray<uint8> m_ReceiveBuffer;
+
+        // Messages and disconnects are delivered after a whole receive batch, so callbacks can add or remove peers
+        TArray<InboxMessage> m_Inbox;
+        TArray<uint8> m_InboxData;
+        TArray<int32> m_Disconnected;
+        TArray<DeliveryNotice> m_DeliveryNotices; // Delivered after every Receive and Flush, dropped by Close
+
+        NetSimulationSettings m_Simulation;
+        std::mt19937 m_SimulationRandom;
+        float m_ConnectionTimeout;
+        int64 m_TotalBytesSent;
+        int64 m_TotalBytesReceived;
+
+        std::function<int32(const NetAddress&)> m_OnUnknownPeerCallback;
+        std::function<void(int32, uint8, const uint8*, int32)> m_OnMessageCallback;
+        std::function<void(int32)> m_OnPeerDisconnectedCallback;
+        std::function<void(int32, uint32, bool)> m_OnDeliveryCallback;
+
+        // Helper functions
+        double GetTime() const;
+        Peer* FindPeer(int32 ConnectionID);
+        Peer* AddPeerInternal(int32 ConnectionID, const NetAddress& Address, double Now);
+        void ProcessDatagram(const NetAddress& From, const uint8* Data, int32 Size, double Now);
+        bool AcceptSequence(Peer& Target, uint16 Sequence);
+        void ProcessAcks(Peer& Target, uint16 Ack, uint32 AckBits, double Now);
+        void AckPacket(Peer& Target, uint16 Sequence, double Now);
+        void ReceiveReliable(Peer& Target, uint16 MessageID, uint8 Channel, const uint8* Data, int32 Size);
+        void QueueInboxMessage(int32 ConnectionID, uint8 Channel, const uint8* Data, int32 Size);
+        void DeliverInbox();
+        void DeliverNotices();
+        void NotifyReceipts(int32 ConnectionID, TArray<uint32>& Receipts, bool bDelivered);
+        void DetectLosses(Peer& Target, double Now);
+        void OnPacketLost(Peer& Target, SentPacket& Packet);
+        void BuildPackets(Peer& Target, double Now);
+        uint8* BeginDatagram(Peer& Target, uint8 Flags);
+        void FinishDatagram(Peer& Target, const uint8* Data, int32 Size, double Now);
+        void QueueDatagram(const NetAddress& Address, const uint8* Data, int32 Size, double Now);
+        void SendBatch(double Now);
+        float GetRetransmitTimeout(const Peer& Target) const;
+        void UpdateStats(Peer& Target);
+    };
+}
@@ -0,0 +1,561 @@
+/*
+ * UE4 Profiler Implementation - Self-contained scoped-zone profiler implementation
+ * Vibe coder approved ✨
+ */
+
+#include "Profiler.h"
+#include "Utils.h"
+#include "JobSystem.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // Deepest nesting tracked for self time, deeper zones are folded into this level
+        const int32 MaxTrackedDepth = 62;
+
+        // TSC calibration spin on startup, refined every frame afterwards
+        const int64 InitialCalibrationNanoseconds = 2000000;
+
+        // Open BeginNamedZone calls on this thread - entries opened while disabled keep their zone
+        // for the name check in EndNamedZone but aren't recorded
+        struct NamedZoneStack
+        {
+            TArray<const ProfileZone*> Zones;
+            TArray<uint64> Begins;
+            TArray<uint8> Recorded;
+        };
+
+        thread_local NamedZoneStack t_NamedZoneStack;
+
+        // Hands the thread's buffer back when the thread exits
+        struct ThreadBufferRelease
+        {
+            ProfilerThreadBuffer* Buffer = nullptr;
+
+            ~ThreadBufferRelease()
+            {
+                if (Buffer)
+                {
+                    Profiler::Get().RetireThread(*Buffer);
+                }
+            }
+        };
+
+        thread_local ThreadBufferRelease t_BufferRelease;
+
+        int64 GetSteadyNanoseconds()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void AppendEscaped(std::string& Json, const char* Text)
+        {
+            for (const char* Char = Text ? Text : ""; *Char; ++Char)
+            {
+                if (*Char == '"' || *Char == '\\')
+                {
+                    Json += '\\';
+                    Json += *Char;
+                }
+                else if (static_cast<unsigned char>(*Char) < 0x20)
+                {
+                    Json += ' ';
+                }
+                else
+                {
+                    Json += *Char;
+                }
+            }
+        }
+    }
+
+    // ProfilerThreadBuffer implementation
+    ProfilerThreadBuffer::ProfilerThreadBuffer(uint32 ThreadIndex, const FString& ThreadName)
+        : m_Events(new ProfileEvent[Capacity])
+        , m_Head(0)
+        , m_CachedTail(0)
+        , m_Tail(0)
+        , m_Dropped(0)
+        , m_ThreadIndex(ThreadIndex)
+        , m_ThreadName(ThreadName)
+        , m_bRetired(false)
+    {
+        for (int64& ChildTime : m_ChildTime)
+        {
+            ChildTime = 0;
+        }
+    }
+
+    // Profiler implementation
+    thread_local ProfilerThreadBuffer* Profiler::t_Buffer = nullptr;
+    Profiler* Profiler::s_Instance = nullptr;
+
+    Profiler& Profiler::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(Diagnostics);
+            s_Instance = new Profiler();
+        }
+        return *s_Instance;
+    }
+
+    Profiler::Profiler()
+        : m_bEnabled(true)
+        , m_FrameNumber(0)
+        , m_HistoryFrames(120)
+        , m_HistoryCursor(0)
+        , m_bCapturing(false)
+        , m_MaxCapturedEvents(0)
+        , m_NanosecondsPerTick(1.0)
+    {
+        m_FirstTick = ReadClock();
+        m_CalibrationTicks = m_FirstTick;
+        m_CalibrationNanoseconds = GetSteadyNanoseconds();
+
+#if UE4SDK_PROFILER_TSC
+        // Good enough for the first frames, EndFrame keeps refining it over the whole run
+        while (GetSteadyNanoseconds() - m_CalibrationNanoseconds < InitialCalibrationNanoseconds)
+        {
+        }
+        Calibrate();
+#endif
+    }
+
+    void Profiler::EndFrame()
+    {
+        Calibrate();
+
+        TArray<ProfilerThreadBuffer*> Threads;
+        {
+            std::lock_guard<std::mutex> Lock(m_ThreadMutex);
+            Threads.Reserve(m_Threads.Num());
+            for (const std::unique_ptr<ProfilerThreadBuffer>& Buffer : m_Threads)
+            {
+                Threads.Add(Buffer.get());
+            }
+        }
+
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        for (ProfilerThreadBuffer* Buffer : Threads)
+        {
+            DrainThread(*Buffer);
+        }
+        FinishFrameStats();
+        ++m_FrameNumber;
+    }
+
+    void Profiler::SetHistoryFrames(int32 Frames)
+    {
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        m_HistoryFrames = std::max(1, Frames);
+        m_HistoryCursor = 0;
+        for (ZoneHistory& History : m_Zones)
+        {
+            History.FrameTicks.Empty();
+            History.FrameCallMinTicks.Empty();
+            History.FrameCallMaxTicks.Empty();
+            for (int32 i = 0; i < m_HistoryFrames; ++i)
+            {
+                History.FrameTicks.Add(0);
+                History.FrameCallMinTicks.Add(-1);
+                History.FrameCallMaxTicks.Add(-1);
+            }
+            History.FramesSampled = 0;
+        }
+    }
+
+    void Profiler::GetZoneStats(TArray<ProfileZoneStats>& OutStats) const
+    {
+        OutStats.Empty();
+        {
+            std::lock_guard<std::mutex> Lock(m_StatsMutex);
+            OutStats.Reserve(m_Zones.Num());
+            for (const ZoneHistory& History : m_Zones)
+            {
+                OutStats.Add(BuildStats(History));
+            }
+        }
+
+        std::sort(OutStats.begin(), OutStats.end(), [](const ProfileZoneStats& A, const ProfileZoneStats& B) { return A.InclusiveMsLastFrame > B.InclusiveMsLastFrame; });
+    }
+
+    bool Profiler::GetZoneStats(const FString& Name, ProfileZoneStats& OutStats) const
+    {
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        const int32* Index = m_ZoneNames.Find(Name);
+        if (!Index)
+        {
+            return false;
+        }
+
+        OutStats = BuildStats(m_Zones[*Index]);
+        return true;
+    }
+
+    void Profiler::LogReport(int32 MaxZones) const
+    {
+        TArray<ProfileZoneStats> Stats;
+        GetZoneStats(Stats);
+
+        char Line[256];
+        std::snprintf(Line, sizeof(Line), "Profiler frame %llu - %d zones, %d events dropped", static_cast<unsigned long long>(m_FrameNumber), Stats.Num(), GetDroppedEventCount());
+        Utils::Get().LogInfo(FString(Line));
+        Utils::Get().LogInfo(TEXT("  Zone                             Incl ms   Self ms  Calls   Avg ms   P95 ms   P99 ms   Max ms"));
+
+        for (int32 i = 0; i < Stats.Num() && i < MaxZones; ++i)
+        {
+            const ProfileZoneStats& Zone = Stats[i];
+            std::snprintf(Line, sizeof(Line), "  %-32.32s %8.3f %9.3f %6d %8.3f %8.3f %8.3f %8.3f",
+                *Zone.Name, Zone.InclusiveMsLastFrame, Zone.SelfMsLastFrame, Zone.CallsLastFrame,
+                Zone.AverageFrameMs, Zone.P95FrameMs, Zone.P99FrameMs, Zone.MaxFrameMs);
+            Utils::Get().LogInfo(FString(Line));
+        }
+    }
+
+    void Profiler::ResetStats()
+    {
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        m_ZoneIndices.clear();
+        m_ZoneNames.Empty();
+        m_Zones.Empty();
+        m_HistoryCursor = 0;
+    }
+
+    int32 Profiler::GetDroppedEventCount() const
+    {
+        std::lock_guard<std::mutex> Lock(m_ThreadMutex);
+        int32 Dropped = 0;
+        for (const std::unique_ptr<ProfilerThreadBuffer>& Buffer : m_Threads)
+        {
+            Dropped += static_cast<int32>(Buffer->m_Dropped.load(std::memory_order_relaxed));
+        }
+        return Dropped;
+    }
+
+    void Profiler::BeginCapture(int32 MaxEvents)
+    {
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        m_Captured.Empty();
+        m_MaxCapturedEvents = std::max(0, MaxEvents);
+        m_bCapturing = true;
+    }
+
+    void Profiler::EndCapture()
+    {
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        m_bCapturing = false;
+    }
+
+    FString Profiler::GetChromeTraceJson() const
+    {
+        std::string Json;
+        Json += "{\"traceEvents\":[";
+        bool bFirst = true;
+        char Buffer[160];
+
+        {
+            std::lock_guard<std::mutex> Lock(m_ThreadMutex);
+            for (const std::unique_ptr<ProfilerThreadBuffer>& Thread : m_Threads)
+            {
+                std::snprintf(Buffer, sizeof(Buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", bFirst ? "" : ",", Thread->m_ThreadIndex);
+                Json += Buffer;
+                AppendEscaped(Json, *Thread->m_ThreadName);
+                Json += "\"}}";
+                bFirst = false;
+            }
+        }
+
+        std::lock_guard<std::mutex> Lock(m_StatsMutex);
+        Json.reserve(Json.size() + static_cast<std::size_t>(m_Captured.Num()) * 96);
+
+        // Complete events, microseconds since the profiler started
+        double MicrosecondsPerTick = m_NanosecondsPerTick / 1000.0;
+        for (const CapturedEvent& Event : m_Captured)
+        {
+            Json += bFirst ? "{\"name\":\"" : ",{\"name\":\"";
+            AppendEscaped(Json, Event.Zone->Name);
+            std::snprintf(Buffer, sizeof(Buffer), "\",\"cat\":\"zone\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                static_cast<double>(Event.Begin - m_FirstTick) * MicrosecondsPerTick,
+                static_cast<double>(Event.End - Event.Begin) * MicrosecondsPerTick,
+                Event.ThreadIndex);
+            Json += Buffer;
+            bFirst = false;
+        }
+
+        Json += "],\"displayTimeUnit\":\"ms\"}";
+        return FString(Json);
+    }
+
+    bool Profiler::SaveChromeTrace(const FString& FilePath) const
+    {
+        return Utils::SaveStringToFile(GetChromeTraceJson(), FilePath);
+    }
+
+    void Profiler::SetCurrentThreadName(const FString& Name)
+    {
+        ProfilerThreadBuffer& Buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> Lock(m_ThreadMutex);
+        Buffer.m_ThreadName = Name;
+    }
+
+    void Profiler::BeginNamedZone(const FString& Name)
+    {
+        const ProfileZone* Zone;
+        {
+            std::lock_guard<std::mutex> Lock(m_NamedZoneMutex);
+            NamedZone& Named = m_NamedZones.FindOrAdd(Name);
+            if (!Named.Zone.Name)
+            {
+                Named.Name = Name;
+                Named.Zone.Name = *Named.Name;
+                Named.Zone.File = "";
+                Named.Zone.Line = 0;
+            }
+            Zone = &Named.Zone;
+        }
+
+        NamedZoneStack& Stack = t_NamedZoneStack;
+        Stack.Zones.Add(Zone);
+        if (!IsEnabled())
+        {
+            Stack.Begins.Add(0);
+            Stack.Recorded.Add(0);
+            return;
+        }
+
+        ++GetThreadBuffer().Depth;
+        Stack.Recorded.Add(1);
+        Stack.Begins.Add(ReadClock());
+    }
+
+    bool Profiler::EndNamedZone(const FString& Name)
+    {
+        NamedZoneStack& Stack = t_NamedZoneStack;
+        if (Stack.Zones.Num() == 0)
+        {
+            LOG_WARNING(FString("Profiler: EndNamedZone(") + Name + ") with no open named zone");
+            return false;
+        }
+
+        // Names must nest - closing anything but the innermost zone would attribute its time to the wrong one
+        const ProfileZone* Zone = Stack.Zones.Last();
+        if (Name != Zone->Name)
+        {
+            LOG_WARNING(FString("Profiler: EndNamedZone(") + Name + ") doesn't match the innermost open zone " + FString(Zone->Name) + ", ignored");
+            return false;
+        }
+
+        uint64 End = ReadClock();
+        Stack.Zones.Pop();
+        uint64 Begin = Stack.Begins.PopValue();
+        if (Stack.Recorded.PopValue())
+        {
+            ProfilerThreadBuffer& Buffer = GetThreadBuffer();
+            Buffer.Write(Zone, Begin, End, --Buffer.Depth);
+        }
+        return true;
+    }
+
+    ProfilerThreadBuffer& Profiler::RegisterThread()
+    {
+        FString ThreadName;
+        int32 WorkerIndex = JobSystem::GetCurrentWorkerIndex();
+        if (WorkerIndex >= 0)
+        {
+            ThreadName = TEXT("Worker ") + FString::FromInt(WorkerIndex);
+        }
+        else if (JobSystem::Get().IsGameThread())
+        {
+            ThreadName = TEXT("GameThread");
+        }
+
+        std::lock_guard<std::mutex> Lock(m_ThreadMutex);
+        ProfilerThreadBuffer* Buffer = nullptr;
+        for (const std::unique_ptr<ProfilerThreadBuffer>& Existing : m_Threads)
+        {
+            if (Existing->m_bRetired)
+            {
+                // Events the old thread left behind are still drained by the next EndFrame
+                Buffer = Existing.get();
+                Buffer->m_bRetired = false;
+                Buffer->Depth = 0;
+                break;
+            }
+        }
+
+        if (!Buffer)
+        {
+            m_Threads.Add(std::make_unique<ProfilerThreadBuffer>(static_cast<uint32>(m_Threads.Num()), FString()));
+            Buffer = m_Threads.Last().get();
+        }
+
+        Buffer->m_ThreadName = ThreadName.IsEmpty() ? TEXT("Thread ") + FString::FromInt(static_cast<int32>(Buffer->m_ThreadIndex)) : ThreadName;
+        t_Buffer = Buffer;
+        t_BufferRelease.Buffer = Buffer;
+        return *Buffer;
+    }
+
+    void Profiler::RetireThread(ProfilerThreadBuffer& Buffer)
+    {
+        std::lock_guard<std::mutex> Lock(m_ThreadMutex);
+        Buffer.m_bRetired = true;
+        t_Buffer = nullptr;
+    }
+
+    int32 Profiler::FindOrAddZone(const ProfileZone* Zone)
+    {
+        auto It = m_ZoneIndices.find(Zone);
+        if (It != m_ZoneIndices.end())
+        {
+            return It->second;
+        }
+
+        // Sites sharing a name fold into one entry
+        FString Name(Zone->Name);
+        int32* Existing = m_ZoneNames.Find(Name);
+        int32 Index = Existing ? *Existing : m_Zones.Num();
+        if (!Existing)
+        {
+            ZoneHistory History;
+            History.Name = Name;
+            for (int32 i = 0; i < m_HistoryFrames; ++i)
+            {
+                History.FrameTicks.Add(0);
+                History.FrameCallMinTicks.Add(-1);
+                History.FrameCallMaxTicks.Add(-1);
+            }
+            m_Zones.Add(History);
+            m_ZoneNames.Add(Name, Index);
+        }
+
+        m_ZoneIndices[Zone] = Index;
+        return Index;
+    }
+
+    void Profiler::DrainThread(ProfilerThreadBuffer& Buffer)
+    {
+        uint64 Head = Buffer.m_Head.load(std::memory_order_acquire);
+        uint64 Tail = Buffer.m_Tail.load(std::memory_order_relaxed);
+
+        for (uint64 Position = Tail; Position != Head; ++Position)
+        {
+            const ProfileEvent& Event = Buffer.m_Events[Position & (ProfilerThreadBuffer::Capacity - 1)];
+            int64 Duration = static_cast<int64>(Event.End - Event.Begin);
+
+            // Zones close innermost first, so a zone's children have all been seen by the time it arrives
+            int32 Depth = std::min(std::max(Event.Depth, 0), MaxTrackedDepth);
+            int64 SelfTicks = std::max<int64>(0, Duration - Buffer.m_ChildTime[Depth + 1]);
+            Buffer.m_ChildTime[Depth + 1] = 0;
+            Buffer.m_ChildTime[Depth] += Duration;
+
+            ZoneHistory& History = m_Zones[FindOrAddZone(Event.Zone)];
+            ++History.Calls;
+            History.InclusiveTicks += Duration;
+            History.SelfTicks += SelfTicks;
+            History.CallMinTicks = History.CallMinTicks < 0 ? Duration : std::min(History.CallMinTicks, Duration);
+            History.CallMaxTicks = std::max(History.CallMaxTicks, Duration);
+
+            if (m_bCapturing && m_Captured.Num() < m_MaxCapturedEvents)
+            {
+                CapturedEvent Captured;
+                Captured.Zone = Event.Zone;
+                Captured.Begin = Event.Begin;
+                Captured.End = Event.End;
+                Captured.ThreadIndex = Buffer.m_ThreadIndex;
+                m_Captured.Add(Captured);
+            }
+        }
+
+        Buffer.m_Tail.store(Head, std::memory_order_release);
+    }
+
+    void Profiler::FinishFrameStats()
+    {
+        for (ZoneHistory& History : m_Zones)
+        {
+            History.LastCalls = History.Calls;
+            History.LastInclusiveTicks = History.InclusiveTicks;
+            History.LastSelfTicks = History.SelfTicks;
+
+            // Frames the zone didn't run in still count, as zero
+            History.FrameTicks[m_HistoryCursor] = History.InclusiveTicks;
+            History.FrameCallMinTicks[m_HistoryCursor] = History.CallMinTicks;
+            History.FrameCallMaxTicks[m_HistoryCursor] = History.CallMaxTicks;
+            History.FramesSampled = std::min(History.FramesSampled + 1, m_HistoryFrames);
+
+            History.Calls = 0;
+            History.InclusiveTicks = 0;
+            History.SelfTicks = 0;
+            History.CallMinTicks = -1;
+            History.CallMaxTicks = -1;
+        }
+
+        m_HistoryCursor = (m_HistoryCursor + 1) % m_HistoryFrames;
+    }
+
+    void Profiler::Calibrate()
+    {
+#if UE4SDK_PROFILER_TSC
+        // Measured over the whole run, so the ratio only gets better
+        uint64 Ticks = ReadClock() - m_CalibrationTicks;
+        int64 Nanoseconds = GetSteadyNanoseconds() - m_CalibrationNanoseconds;
+        if (Ticks > 0 && Nanoseconds > 0)
+        {
+            m_NanosecondsPerTick = static_cast<double>(Nanoseconds) / static_cast<double>(Ticks);
+        }
+#endif
+    }
+
+    ProfileZoneStats Profiler::BuildStats(const ZoneHistory& History) const
+    {
+        double MillisecondsPerTick = m_NanosecondsPerTick / 1000000.0;
+
+        ProfileZoneStats Stats;
+        Stats.Name = History.Name;
+        Stats.CallsLastFrame = History.LastCalls;
+        Stats.InclusiveMsLastFrame = History.LastInclusiveTicks * MillisecondsPerTick;
+        Stats.SelfMsLastFrame = History.LastSelfTicks * MillisecondsPerTick;
+        Stats.FramesSampled = History.FramesSampled;
+        if (History.FramesSampled == 0)
+        {
+            return Stats;
+        }
+
+        // Walk back from the newest frame
+        TArray<int64> Samples;
+        Samples.Reserve(History.FramesSampled);
+        int64 CallMin = -1;
+        int64 CallMax = -1;
+        double Sum = 0.0;
+        for (int32 i = 1; i <= History.FramesSampled; ++i)
+        {
+            int32 Slot = (m_HistoryCursor - i + m_HistoryFrames) % m_HistoryFrames;
+            Samples.Add(History.FrameTicks[Slot]);
+            Sum += static_cast<double>(History.FrameTicks[Slot]);
+            if (History.FrameCallMinTicks[Slot] >= 0)
+            {
+                CallMin = CallMin < 0 ? History.FrameCallMinTicks[Slot] : std::min(CallMin, History.FrameCallMinTicks[Slot]);
+                CallMax = std::max(CallMax, History.FrameCallMaxTicks[Slot]);
+            }
+        }
+
+        std::sort(Samples.begin(), Samples.end());
+        int32 Count = Samples.Num();
+        Stats.AverageFrameMs = Sum / Count * MillisecondsPerTick;
+        Stats.MinFrameMs = Samples[0] * MillisecondsPerTick;
+        Stats.MaxFrameMs = Samples[Count - 1] * MillisecondsPerTick;
+        Stats.P50FrameMs = Samples[Count / 2] * MillisecondsPerTick;
+        Stats.P95FrameMs = Samples[std::min(Count - 1, Count * 95 / 100)] * MillisecondsPerTick;
+        Stats.P99FrameMs = Samples[std::min(Count - 1, Count * 99 / 100)] * MillisecondsPerTick;
+        Stats.MinCallMs = std::max<int64>(0, CallMin) * MillisecondsPerTick;
+        Stats.MaxCallMs = std::max<int64>(0, CallMax) * MillisecondsPerTick;
+        return Stats;
+    }
+}
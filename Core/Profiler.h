@@ -0,0 +1,313 @@
+/*
+ * UE4 Profiler - Self-contained hierarchical scoped-zone profiler
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Build with UE4SDK_ENABLE_PROFILER=0 to compile every PROFILE_ macro out
+#ifndef UE4SDK_ENABLE_PROFILER
+    #define UE4SDK_ENABLE_PROFILER 1
+#endif
+
+// Timestamps come from the TSC on x86-64, steady_clock everywhere else
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+    #define UE4SDK_PROFILER_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #include <x86intrin.h>
+    #define UE4SDK_PROFILER_TSC 1
+#else
+    #include <chrono>
+    #define UE4SDK_PROFILER_TSC 0
+#endif
+
+namespace UE4SDK
+{
+    // Zone site - one static instance per PROFILE_SCOPE, events point at it instead of copying the name
+    struct ProfileZone
+    {
+        const char* Name;
+        const char* File;
+        int32 Line;
+    };
+
+    // Raw event - written by the thread that closed the zone
+    struct ProfileEvent
+    {
+        const ProfileZone* Zone;
+        uint64 Begin;
+        uint64 End;
+        int32 Depth;
+    };
+
+    // Per-thread ring - one writer (the owning thread), one reader (EndFrame). Full rings drop new events.
+    class ProfilerThreadBuffer
+    {
+    public:
+        static constexpr uint32 Capacity = 1 << 15; // Events between two EndFrame calls
+
+        ProfilerThreadBuffer(uint32 ThreadIndex, const FString& ThreadName);
+
+        void Write(const ProfileZone* Zone, uint64 Begin, uint64 End, int32 Depth)
+        {
+            uint64 Head = m_Head.load(std::memory_order_relaxed);
+            if (Head - m_CachedTail >= Capacity)
+            {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                if (Head - m_CachedTail >= Capacity)
+                {
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            ProfileEvent& Event = m_Events[Head & (Capacity - 1)];
+            Event.Zone = Zone;
+            Event.Begin = Begin;
+            Event.End = End;
+            Event.Depth = Depth;
+            m_Head.store(Head + 1, std::memory_order_release);
+        }
+
+        uint32 GetThreadIndex() const { return m_ThreadIndex; }
+        const FString& GetThreadName() const { return m_ThreadName; } // Use Profiler::SetCurrentThreadName to change it
+
+        int32 Depth = 0; // Open zones on the owning thread
+
+    private:
+        friend class Profiler;
+
+        std::unique_ptr<ProfileEvent[]> m_Events;
+        alignas(64) std::atomic<uint64> m_Head;
+        uint64 m_CachedTail; // Writer's copy of m_Tail
+        alignas(64) std::atomic<uint64> m_Tail;
+        std::atomic<uint32> m_Dropped;
+        uint32 m_ThreadIndex;
+        FString m_ThreadName;
+        bool m_bRetired; // Owning thread exited, the next new thread takes the buffer over
+
+        // Reader-side nesting state, carried across frames for zones still open at EndFrame
+        int64 m_ChildTime[64];
+    };
+
+    // Per-zone statistics - last frame plus distributions over the recent frame history.
+    // Frame values are the zone's summed inclusive time across every thread in that frame.
+    struct ProfileZoneStats
+    {
+        FString Name;
+        int32 CallsLastFrame = 0;
+        double InclusiveMsLastFrame = 0.0;
+        double SelfMsLastFrame = 0.0;
+        double MinCallMs = 0.0;    // Shortest and longest single call seen in the history window
+        double MaxCallMs = 0.0;
+        double AverageFrameMs = 0.0;
+        double MinFrameMs = 0.0;
+        double MaxFrameMs = 0.0;
+        double P50FrameMs = 0.0;
+        double P95FrameMs = 0.0;
+        double P99FrameMs = 0.0;
+        int32 FramesSampled = 0;
+    };
+
+    // Profiler - zones are recorded into thread-local rings and folded into per-zone stats once per frame.
+    // Recording a zone is two timestamp reads and one ring write; nothing is locked or allocated on that path.
+    class Profiler
+    {
+    public:
+        static Profiler& Get();
+
+        // Runtime switch - disabled zones still cost a load and a branch
+        void SetEnabled(bool bEnabled) { m_bEnabled.store(bEnabled, std::memory_order_relaxed); }
+        bool IsEnabled() const { return m_bEnabled.load(std::memory_order_relaxed); }
+
+        // Call once per frame from the game thread - drains every thread's ring and updates the stats
+        void EndFrame();
+        uint64 GetFrameNumber() const { return m_FrameNumber; }
+
+        // Stats
+        void SetHistoryFrames(int32 Frames); // Frames kept for min/max/percentiles, clears the history
+        int32 GetHistoryFrames() const { return m_HistoryFrames; }
+        void GetZoneStats(TArray<ProfileZoneStats>& OutStats) const; // Sorted by last frame's inclusive time
+        bool GetZoneStats(const FString& Name, ProfileZoneStats& OutStats) const;
+        void LogReport(int32 MaxZones = 20) const;
+        void ResetStats();
+        int32 GetDroppedEventCount() const;
+
+        // Chrome trace capture - events drained while capturing are kept, up to MaxEvents
+        void BeginCapture(int32 MaxEvents = 1000000);
+        void EndCapture();
+        bool IsCapturing() const { return m_bCapturing; }
+        int32 GetCapturedEventCount() const { return m_Captured.Num(); }
+        FString GetChromeTraceJson() const;
+        bool SaveChromeTrace(const FString& FilePath) const;
+
+        // Threads
+        void SetCurrentThreadName(const FString& Name);
+        void RetireThread(ProfilerThreadBuffer& Buffer); // Called on thread exit, frees the buffer for reuse
+
+        // Named zones for code that can't use the macros - the name is interned once, so keep the set small
+        void BeginNamedZone(const FString& Name);
+        bool EndNamedZone(const FString& Name); // Only closes the innermost open zone, warns and returns false otherwise
+
+        // Clock
+        static uint64 ReadClock()
+        {
+#if UE4SDK_PROFILER_TSC
+            return __rdtsc();
+#else
+            return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+        double GetNanosecondsPerTick() const { return m_NanosecondsPerTick; }
+
+        static ProfilerThreadBuffer& GetThreadBuffer()
+        {
+            ProfilerThreadBuffer* Buffer = t_Buffer;
+            return Buffer ? *Buffer : Get().RegisterThread();
+        }
+
+    private:
+        Profiler();
+        ~Profiler() = default;
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        struct ZoneHistory
+        {
+            FString Name;
+
+            // Accumulating this frame
+            int32 Calls = 0;
+            int64 InclusiveTicks = 0;
+            int64 SelfTicks = 0;
+            int64 CallMinTicks = -1; // -1 until the zone runs
+            int64 CallMaxTicks = -1;
+
+            // Last finished frame
+            int32 LastCalls = 0;
+            int64 LastInclusiveTicks = 0;
+            int64 LastSelfTicks = 0;
+
+            // History rings, one entry per frame
+            TArray<int64> FrameTicks;
+            TArray<int64> FrameCallMinTicks;
+            TArray<int64> FrameCallMaxTicks;
+            int32 FramesSampled = 0;
+        };
+
+        struct CapturedEvent
+        {
+            const ProfileZone* Zone;
+            uint64 Begin;
+            uint64 End;
+            uint32 ThreadIndex;
+        };
+
+        std::atomic<bool> m_bEnabled;
+        uint64 m_FrameNumber;
+        int32 m_HistoryFrames;
+        int32 m_HistoryCursor;
+
+        // Threads register once, buffers live as long as the profiler and are reused after their thread exits
+        mutable std::mutex m_ThreadMutex;
+        TArray<std::unique_ptr<ProfilerThreadBuffer>> m_Threads;
+
+        // Aggregation - touched by EndFrame and the stats getters only
+        mutable std::mutex m_StatsMutex;
+        std::unordered_map<const ProfileZone*, int32> m_ZoneIndices;
+        TMap<FString, int32> m_ZoneNames; // Sites with the same name share stats
+        TArray<ZoneHistory> m_Zones;
+
+        // Capture
+        bool m_bCapturing;
+        int32 m_MaxCapturedEvents;
+        TArray<CapturedEvent> m_Captured;
+
+        // Interned names for BeginNamedZone - map nodes never move, so zones can point into them
+        struct NamedZone
+        {
+            FString Name;
+            ProfileZone Zone;
+        };
+        std::mutex m_NamedZoneMutex;
+        TMap<FString, NamedZone> m_NamedZones;
+
+        // Clock calibration
+        uint64 m_CalibrationTicks;
+        int64 m_CalibrationNanoseconds;
+        double m_NanosecondsPerTick;
+        uint64 m_FirstTick;
+
+        // Helper functions
+        ProfilerThreadBuffer& RegisterThread();
+        int32 FindOrAddZone(const ProfileZone* Zone);
+        void DrainThread(ProfilerThreadBuffer& Buffer);
+        void FinishFrameStats();
+        void Calibrate();
+        ProfileZoneStats BuildStats(const ZoneHistory& History) const;
+
+        static thread_local ProfilerThreadBuffer* t_Buffer;
+        static Profiler* s_Instance;
+    };
+
+    // Scoped zone - records on destruction
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const ProfileZone* Zone)
+            : m_Zone(Zone)
+            , m_Buffer(Profiler::Get().IsEnabled() ? &Profiler::GetThreadBuffer() : nullptr)
+            , m_Begin(0)
+        {
+            if (m_Buffer)
+            {
+                ++m_Buffer->Depth;
+                m_Begin = Profiler::ReadClock();
+            }
+        }
+
+        ~ProfileScope()
+        {
+            if (m_Buffer)
+            {
+                uint64 End = Profiler::ReadClock();
+                m_Buffer->Write(m_Zone, m_Begin, End, --m_Buffer->Depth);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const ProfileZone* m_Zone;
+        ProfilerThreadBuffer* m_Buffer;
+        uint64 m_Begin;
+    };
+}
+
+// Global access macros
+#define PROFILER UE4SDK::Profiler::Get()
+
+#define UE4SDK_PROFILE_CONCAT_INNER(A, B) A##B
+#define UE4SDK_PROFILE_CONCAT(A, B) UE4SDK_PROFILE_CONCAT_INNER(A, B)
+
+#if UE4SDK_ENABLE_PROFILER
+    // Name must be a string literal
+    #define PROFILE_SCOPE(Name) \
+        static const UE4SDK::ProfileZone UE4SDK_PROFILE_CONCAT(ProfileZone_, __LINE__) = { Name, __FILE__, __LINE__ }; \
+        UE4SDK::ProfileScope UE4SDK_PROFILE_CONCAT(ProfileScope_, __LINE__)(&UE4SDK_PROFILE_CONCAT(ProfileZone_, __LINE__))
+    #define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+    #define PROFILE_END_FRAME() UE4SDK::Profiler::Get().EndFrame()
+#else
+    #define PROFILE_SCOPE(Name)
+    #define PROFILE_FUNCTION()
+    #define PROFILE_END_FRAME()
+#endif
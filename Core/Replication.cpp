@@ -5,10 +5,78 @@
 
 #include "Replication.h"
 #include "Utils.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "Stats.h"
+#include "MemoryTracker.h"
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 
 namespace UE4SDK
 {
+    namespace
+    {
+        // Timing wheel size - a power of two, 256 slots at 60Hz covers a little over four seconds per turn
+        constexpr int32 TimerWheelSlots = 256;
+        
+        // Connections per job when building packets - each one sorts its candidates and assembles a packet
+        constexpr int32 ConnectionBatchSize = 4;
+        
+        // Transport channels - replication packets and string data are dispatched separately on receive
+        constexpr uint8 ReplicationChannel = 0;
+        constexpr uint8 DataChannel = 1;
+        
+        // Weight of the newest tick in GetAverageReplicationTime
+        constexpr float ReplicationTimeSmoothing = 0.1f;
+        
+        // Frame stats - bytes here are payload bytes handed to the transport, before headers
+        const StatId StatBytesSent = StatsRegistry::Get().RegisterCounter(TEXT("Net.BytesSent"));
+        const StatId StatBytesReceived = StatsRegistry::Get().RegisterCounter(TEXT("Net.BytesReceived"));
+        const StatId StatActorsReplicated = StatsRegistry::Get().RegisterCounter(TEXT("Replication.ActorsReplicated"));
+        const StatId StatReplicationBytes = StatsRegistry::Get().RegisterCounter(TEXT("Replication.BytesSent"));
+        const StatId StatReplicationTickMs = StatsRegistry::Get().RegisterHistogram(TEXT("Replication.TickMs"), 0.0, 20.0, 40);
+        const StatId StatConnections = StatsRegistry::Get().RegisterGauge(TEXT("Net.Connections"));
+        
+        // Body of the delta being written, per thread since connections assemble packets in parallel
+        thread_local FBitWriter t_DeltaBody;
+        
+        // Delta layout: ObjectID (varint) | BodyBits (varint) | ChangedCount | per change: Index, value bits.
+        // The length lets a receiver skip objects it doesn't know and carry on with the rest of the packet.
+        // Delta properties are written against the old shadow, so the shadow is only updated after.
+        void WriteDeltaPayload(UObject* Object, const ReplicationInfo* Info, const TArray<int32>& ChangedIndices, const TArray<FBitWriter>& Values, TArray<FBitWriter>& Shadow, FBitWriter& Writer, TArray<NetSentProperty>* OutSent)
+        {
+            FBitWriter& Body = t_DeltaBody;
+            Body.Reset();
+            
+            uint32 IndexMax = static_cast<uint32>(Info->GetReplicatedPropertyCount());
+            Body.SerializeInt(static_cast<uint32>(ChangedIndices.Num()), IndexMax + 1);
+            
+            for (int32 Index : ChangedIndices)
+            {
+                Body.SerializeInt(static_cast<uint32>(Index), IndexMax);
+                Info->WritePropertyValue(Object, Index, Values[Index], Shadow[Index], Body);
+                
+                // A delta can only be rolled back with the shadow it was diffed against, the old one is about to go
+                if (OutSent)
+                {
+                    NetSentProperty& Sent = OutSent->Emplace();
+                    Sent.Object = Object;
+                    Sent.Index = Index;
+                    if (Info->HasLostShadowMerge(Index))
+                    {
+                        Sent.Base = std::move(Shadow[Index]);
+                    }
+                }
+                Shadow[Index] = Values[Index];
+            }
+            
+            Writer.WriteVarUInt(Object->GetObjectID());
+            Writer.WriteVarUInt(static_cast<uint32>(Body.GetNumBits()));
+            Writer.WriteBits(Body);
+        }
+    }
+
     // ReplicationInfo implementation
     ReplicationInfo::ReplicationInfo()
         : m_ReplicationType(EReplicationType::Unreliable)
@@ -21,6 +89,15 @@ namespace UE4SDK
         , m_ReplicationFrequency(1.0f)
         , m_LastReplicationTime(0.0f)
         , m_ReplicationSize(0)
+        , m_NetCullDistance(15000.0f)
+        , m_NetPriority(1.0f)
+        , m_bAlwaysRelevant(false)
+        , m_OwnerConnection(-1)
+        , m_NetDormancy(ENetDormancy::Awake)
+        , m_bDormancyFlushPending(false)
+        , m_bPolled(false)
+        , m_bScheduled(false)
+        , m_bReady(false)
     {
     }
 
@@ -76,32 +153,254 @@ namespace UE4SDK
         }
     }
 
+    bool ReplicationInfo::IsRelevantToConnection(int32 ConnectionID) const
+    {
+        switch (m_ReplicationCondition)
+        {
+            case EReplicationCondition::OwnerOnly:
+                return m_OwnerConnection != -1 && ConnectionID == m_OwnerConnection;
+            case EReplicationCondition::SkipOwner:
+                return ConnectionID != m_OwnerConnection;
+            default:
+                return true;
+        }
+    }
+
+    void ReplicationInfo::FlushNetDormancy()
+    {
+        // Wakes the object for one update so clients that already have it catch up
+        m_bDormancyFlushPending = true;
+        MarkDirty();
+    }
+
+    int32 ReplicationInfo::AddReplicatedProperty(const ReplicatedProperty& Property)
+    {
+        int32 Index = FindReplicatedProperty(Property.Name);
+        if (Index != -1)
+        {
+            m_Properties[Index] = Property;
+        }
+        else
+        {
+            m_Properties.Add(Property);
+            m_DirtyBits.SetNum((m_Properties.Num() + 31) / 32, 0u);
+            Index = m_Properties.Num() - 1;
+        }
+        
+        // New properties go out with the next update
+        MarkPropertyDirty(Index);
+        return Index;
+    }
+
+    int32 ReplicationInfo::AddReplicatedProperty(const FString& PropertyName, std::function<FString()> Getter)
+    {
+        ReplicatedProperty Property;
+        Property.Name = PropertyName;
+        Property.Serialize = [PropertyName, Getter](UObject* Object, FBitWriter& Writer)
+        {
+            Writer.WriteString(Getter ? Getter() : (Object ? Object->GetProperty(PropertyName) : FString()));
+        };
+        Property.Deserialize = [PropertyName](UObject* Object, FBitReader& Reader)
+        {
+            FString Value = Reader.ReadString();
+            if (Reader.IsError() || !Object)
+            {
+                return false;
+            }
+            Object->SetProperty(PropertyName, Value);
+            return true;
+        };
+        return AddReplicatedProperty(Property);
+    }
+
+    int32 ReplicationInfo::FindReplicatedProperty(const FString& PropertyName) const
+    {
+        for (int32 i = 0; i < m_Properties.Num(); ++i)
+        {
+            if (m_Properties[i].Name == PropertyName)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void ReplicationInfo::SerializeProperty(UObject* Object, int32 Index, FBitWriter& Writer) const
+    {
+        const ReplicatedProperty& Property = m_Properties[Index];
+        if (Property.Serialize)
+        {
+            Property.Serialize(Object, Writer);
+        }
+    }
+
+    bool ReplicationInfo::DeserializeProperty(UObject* Object, int32 Index, FBitReader& Reader) const
+    {
+        const ReplicatedProperty& Property = m_Properties[Index];
+        return Property.Deserialize && Property.Deserialize(Object, Reader) && !Reader.IsError();
+    }
+
+    void ReplicationInfo::WritePropertyValue(UObject* Object, int32 Index, const FBitWriter& Value, const FBitWriter& Shadow, FBitWriter& Writer) const
+    {
+        const ReplicatedProperty& Property = m_Properties[Index];
+        if (Property.SerializeDelta)
+        {
+            Property.SerializeDelta(Object, Shadow, Writer);
+        }
+        else
+        {
+            Writer.WriteBits(Value);
+        }
+    }
+
+    void ReplicationInfo::RollbackShadow(int32 ConnectionID, int32 Index, const FBitWriter& SentAgainst)
+    {
+        TArray<FBitWriter>* Shadow = FindShadowState(ConnectionID);
+        if (!Shadow || Index < 0 || Index >= Shadow->Num() || Index >= m_Properties.Num())
+        {
+            return;
+        }
+        
+        // Plain values forget what was sent so the next compare differs. Later packets may have carried
+        // the same property, sending it once more is harmless.
+        const ReplicatedProperty& Property = m_Properties[Index];
+        if (Property.MergeLostShadow)
+        {
+            Property.MergeLostShadow(SentAgainst, (*Shadow)[Index]);
+        }
+        else
+        {
+            (*Shadow)[Index].Reset();
+        }
+        
+        MarkPropertyDirty(Index);
+    }
+
+    const FBitWriter& ReplicationInfo::GetSerializedProperty(UObject* Object, int32 Index, uint32 Frame)
+    {
+        if (m_SerializedValues.Num() < m_Properties.Num())
+        {
+            m_SerializedValues.SetNum(m_Properties.Num());
+            m_SerializedFrames.SetNum(m_Properties.Num(), 0u);
+        }
+        
+        FBitWriter& Value = m_SerializedValues[Index];
+        if (m_SerializedFrames[Index] != Frame)
+        {
+            Value.Reset();
+            SerializeProperty(Object, Index, Value);
+            m_SerializedFrames[Index] = Frame;
+        }
+        return Value;
+    }
+
+    void ReplicationInfo::SerializeAllProperties(UObject* Object, uint32 Frame)
+    {
+        for (int32 i = 0; i < m_Properties.Num(); ++i)
+        {
+            GetSerializedProperty(Object, i, Frame);
+        }
+    }
+
+    void ReplicationInfo::MarkPropertyDirty(int32 Index)
+    {
+        if (Index < 0 || Index >= m_Properties.Num())
+        {
+            return;
+        }
+        
+        m_DirtyBits[Index >> 5] |= 1u << (Index & 31);
+        
+        // Only the clean -> dirty transition enqueues, so the manager never has to dedup
+        if (!m_bDirty)
+        {
+            m_bDirty = true;
+            if (m_OnBecameDirty)
+            {
+                m_OnBecameDirty();
+            }
+        }
+    }
+
+    void ReplicationInfo::MarkPropertyDirty(const FString& PropertyName)
+    {
+        MarkPropertyDirty(FindReplicatedProperty(PropertyName));
+    }
+
+    bool ReplicationInfo::IsPropertyDirty(int32 Index) const
+    {
+        if (Index < 0 || Index >= m_Properties.Num())
+        {
+            return false;
+        }
+        
+        return (m_DirtyBits[Index >> 5] & (1u << (Index & 31))) != 0;
+    }
+
+    TArray<FBitWriter>& ReplicationInfo::FindOrAddShadowState(int32 ConnectionID)
+    {
+        TArray<FBitWriter>& Shadow = m_ShadowStates.FindOrAdd(ConnectionID);
+        if (Shadow.Num() < m_Properties.Num())
+        {
+            Shadow.SetNum(m_Properties.Num());
+        }
+        return Shadow;
+    }
+
     void ReplicationInfo::MarkDirty()
     {
-        m_bDirty = true;
+        for (int32 i = 0; i < m_Properties.Num(); ++i)
+        {
+            m_DirtyBits[i >> 5] |= 1u << (i & 31);
+        }
+        
+        if (!m_bDirty)
+        {
+            m_bDirty = true;
+            if (m_OnBecameDirty)
+            {
+                m_OnBecameDirty();
+            }
+        }
     }
 
     void ReplicationInfo::ClearDirty()
     {
+        for (uint32& Word : m_DirtyBits)
+        {
+            Word = 0;
+        }
         m_bDirty = false;
     }
 
     void ReplicationInfo::ResetReplication()
     {
         m_bReplicated = false;
-        m_bDirty = false;
         m_bInitialReplication = false;
         m_LastReplicationTime = 0.0f;
         m_ReplicationData = FString();
         m_ReplicationSize = 0;
+        m_ShadowStates.Empty();
+        m_StaleShadows.Empty();
+        m_bDormancyFlushPending = false;
+        ClearDirty();
     }
 
     // ReplicationManager implementation
     ReplicationManager::ReplicationManager()
-        : m_GlobalReplicationFrequency(1.0f)
+        : m_NetworkManager(nullptr)
+        , m_SerializationFrame(0)
+        , m_NextReceipt(1)
+        , m_WheelCursor(0)
+        , m_WheelAccumulator(0.0f)
+        , m_WheelResolution(1.0f / 60.0f)
+        , m_ScheduledCount(0)
+        , m_ReplicationTime(0.0f)
+        , m_GlobalReplicationFrequency(1.0f)
         , m_MaxReplicationSize(1024)
         , m_bReplicationEnabled(true)
     {
+        m_TimerWheel.SetNum(TimerWheelSlots);
     }
 
     void ReplicationManager::RegisterObject(UObject* Object, ReplicationInfo* ReplicationInfo)
@@ -114,8 +413,18 @@ namespace UE4SDK
         
         m_ReplicationInfo.Add(Object, ReplicationInfo);
         m_ReplicatedObjects.Add(Object);
+        m_ObjectsByID.Add(Object->GetObjectID(), Object);
+        
+        // Setters push the object onto the dirty list; nothing else looks at it per tick
+        ReplicationInfo->m_OnBecameDirty = [this, Object]() { AddToDirtyList(Object); };
+        ReplicationInfo->m_bScheduled = false;
+        ReplicationInfo->m_bReady = false;
+        if (ReplicationInfo->IsDirty() || ReplicationInfo->IsPolled())
+        {
+            AddToDirtyList(Object);
+        }
         
-        Utils::Get().LogInfo(TEXT("Object registered for replication: ") + Object->GetName());
+        LOG_INFO(TEXT("Object registered for replication: ") + Object->GetName());
     }
 
     void ReplicationManager::UnregisterObject(UObject* Object)
@@ -125,11 +434,19 @@ namespace UE4SDK
             return;
         }
         
+        ReplicationInfo* Info = GetReplicationInfo(Object);
+        if (Info)
+        {
+            Info->m_OnBecameDirty = nullptr;
+        }
+        
+        // Timing wheel entries are left behind and skipped when they fire
         m_ReplicationInfo.Remove(Object);
         m_ReplicatedObjects.Remove(Object);
+        m_ObjectsByID.Remove(Object->GetObjectID());
         RemoveFromDirtyList(Object);
         
-        Utils::Get().LogInfo(TEXT("Object unregistered from replication: ") + Object->GetName());
+        LOG_INFO(TEXT("Object unregistered from replication: ") + Object->GetName());
     }
 
     bool ReplicationManager::IsObjectRegistered(UObject* Object) const
@@ -143,6 +460,73 @@ namespace UE4SDK
         return Info ? *Info : nullptr;
     }
 
+    void ReplicationManager::MarkPropertyDirty(UObject* Object, const FString& PropertyName)
+    {
+        ReplicationInfo* Info = GetReplicationInfo(Object);
+        if (!Info)
+        {
+            return;
+        }
+        
+        // The info enqueues itself through m_OnBecameDirty on the clean -> dirty transition
+        Info->MarkPropertyDirty(PropertyName);
+    }
+
+    int32 ReplicationManager::ReplicateObjectToConnection(UObject* Object, int32 ConnectionID)
+    {
+        if (!m_NetworkManager || !m_NetworkManager->HasConnection(ConnectionID))
+        {
+            return 0;
+        }
+        
+        // Called outside the tick, so state may have changed since the cache was filled
+        BeginSerializationFrame();
+        
+        m_PayloadWriter.Reset();
+        if (WriteObjectDelta(Object, ConnectionID, m_PayloadWriter) == 0)
+        {
+            return 0;
+        }
+        
+        bool bReliable = GetReplicationInfo(Object)->GetReplicationType() == EReplicationType::Reliable;
+        m_NetworkManager->SendData(ConnectionID, m_PayloadWriter.GetBuffer(), bReliable, TrackWrittenDelta(ConnectionID));
+        return m_PayloadWriter.GetNumBytes();
+    }
+
+    int32 ReplicationManager::WriteObjectDelta(UObject* Object, int32 ConnectionID, FBitWriter& Writer)
+    {
+        ReplicationInfo* Info = GetReplicationInfo(Object);
+        if (!Info)
+        {
+            return 0;
+        }
+        
+        // Full compare against the shadow - dirty bits belong to the regular update
+        return WritePropertyDelta(Object, Info, ConnectionID, false, Writer);
+    }
+
+    bool ReplicationManager::ReceiveReplication(const TArray<uint8>& Payload)
+    {
+        FBitReader Reader(Payload);
+        
+        // Deltas are packed back to back; anything under a byte is padding
+        while (Reader.GetBitsLeft() >= 8)
+        {
+            if (!ReadObjectDelta(Reader))
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+
+    UObject* ReplicationManager::FindObjectByID(uint32 ObjectID) const
+    {
+        UObject* const* Object = m_ObjectsByID.Find(ObjectID);
+        return Object ? *Object : nullptr;
+    }
+
     void ReplicationManager::ProcessReplication(float DeltaTime)
     {
         if (!m_bReplicationEnabled)
@@ -150,14 +534,76 @@ namespace UE4SDK
             return;
         }
         
-        float CurrentTime = Utils::Get().GetTimeSinceStart();
+        CollectReadyObjects(DeltaTime, m_ReadyScratch);
         
-        for (UObject* Object : m_ReplicatedObjects)
+        for (UObject* Object : m_ReadyScratch)
+        {
+            ProcessObjectReplication(Object);
+        }
+    }
+
+    void ReplicationManager::CollectReadyObjects(float DeltaTime, TArray<UObject*>& OutReady)
+    {
+        OutReady.Empty();
+        m_ReplicationTime += DeltaTime;
+        
+        // Dirty objects go out now if their interval has passed, otherwise they wait on the wheel
+        TArray<UObject*> DirtyObjects = std::move(m_DirtyObjects);
+        m_DirtyObjects.Empty();
+        for (UObject* Object : DirtyObjects)
         {
-            if (ShouldReplicateObject(Object, CurrentTime))
+            ReplicationInfo* Info = GetReplicationInfo(Object);
+            if (!Info || !(Info->IsDirty() || Info->IsPolled()) || Info->m_bScheduled)
             {
-                ProcessObjectReplication(Object);
+                continue;
             }
+            
+            float Interval = Info->GetReplicationFrequency() > 0.0f ? 1.0f / Info->GetReplicationFrequency() : 0.0f;
+            float Wait = Info->GetLastReplicationTime() + Interval - m_ReplicationTime;
+            if (Wait <= 0.0f)
+            {
+                QueueReadyObject(Object, Info, OutReady);
+            }
+            else
+            {
+                ScheduleObject(Object, Info, Wait);
+            }
+        }
+        
+        AdvanceTimerWheel(DeltaTime, m_DueScratch);
+        for (UObject* Object : m_DueScratch)
+        {
+            ReplicationInfo* Info = GetReplicationInfo(Object);
+            if (!Info || !Info->m_bScheduled)
+            {
+                continue;
+            }
+            
+            Info->m_bScheduled = false;
+            if (Info->IsDirty() || Info->IsPolled())
+            {
+                QueueReadyObject(Object, Info, OutReady);
+            }
+        }
+    }
+
+    void ReplicationManager::FinishObjectReplication(UObject* Object)
+    {
+        ReplicationInfo* Info = GetReplicationInfo(Object);
+        if (!Info)
+        {
+            return;
+        }
+        
+        Info->m_bReady = false;
+        Info->SetLastReplicationTime(m_ReplicationTime);
+        Info->ClearDirty();
+        Info->ClearDormancyFlush();
+        
+        // Polled objects come back around after one interval whether or not anything changed
+        if (Info->IsPolled() && !Info->m_bScheduled && Info->GetReplicationFrequency() > 0.0f)
+        {
+            ScheduleObject(Object, Info, 1.0f / Info->GetReplicationFrequency());
         }
     }
 
@@ -181,9 +627,16 @@ namespace UE4SDK
 
     void ReplicationManager::ReplicateDirtyObjects()
     {
-        for (UObject* Object : m_DirtyObjects)
+        // Replicating drains the list, so work from a copy
+        TArray<UObject*> DirtyObjects = std::move(m_DirtyObjects);
+        m_DirtyObjects.Empty();
+        for (UObject* Object : DirtyObjects)
         {
-            ProcessObjectReplication(Object);
+            ReplicationInfo* Info = GetReplicationInfo(Object);
+            if (Info && Info->IsDirty())
+            {
+                ProcessObjectReplication(Object);
+            }
         }
     }
 
@@ -302,9 +755,17 @@ namespace UE4SDK
 
     void ReplicationManager::CleanupReplication()
     {
+        for (const auto& pair : m_ReplicationInfo)
+        {
+            pair.second->m_OnBecameDirty = nullptr;
+        }
+        
         m_ReplicationInfo.Empty();
         m_ReplicatedObjects.Empty();
+        m_ObjectsByID.Empty();
         m_DirtyObjects.Empty();
+        m_SentPackets.Empty();
+        ClearTimerWheel();
     }
 
     void ReplicationManager::ResetReplication()
@@ -312,17 +773,19 @@ namespace UE4SDK
         for (const auto& pair : m_ReplicationInfo)
         {
             pair.second->ResetReplication();
+            pair.second->m_bScheduled = false;
+            pair.second->m_bReady = false;
         }
         
         m_DirtyObjects.Empty();
+        m_SentPackets.Empty();
+        ClearTimerWheel();
     }
 
     void ReplicationManager::AddToDirtyList(UObject* Object)
     {
-        if (!m_DirtyObjects.Contains(Object))
-        {
-            m_DirtyObjects.Add(Object);
-        }
+        // Callers only enqueue on the clean -> dirty transition, so no Contains check
+        m_DirtyObjects.Add(Object);
     }
 
     void ReplicationManager::RemoveFromDirtyList(UObject* Object)
@@ -330,15 +793,66 @@ namespace UE4SDK
         m_DirtyObjects.Remove(Object);
     }
 
-    bool ReplicationManager::ShouldReplicateObject(UObject* Object, float CurrentTime) const
+    void ReplicationManager::QueueReadyObject(UObject* Object, ReplicationInfo* Info, TArray<UObject*>& OutReady)
     {
-        ReplicationInfo* Info = GetReplicationInfo(Object);
-        if (!Info)
+        if (Info->m_bReady || !Info->IsValidForReplication())
         {
-            return false;
+            return;
+        }
+        
+        Info->m_bReady = true;
+        OutReady.Add(Object);
+    }
+
+    void ReplicationManager::ScheduleObject(UObject* Object, ReplicationInfo* Info, float Delay)
+    {
+        int32 Ticks = std::max(1, static_cast<int32>(std::ceil(Delay / m_WheelResolution)));
+        int32 Slot = (m_WheelCursor + Ticks) & (TimerWheelSlots - 1);
+        
+        TimerEntry Entry;
+        Entry.Object = Object;
+        Entry.Rounds = static_cast<uint32>((Ticks - 1) / TimerWheelSlots);
+        m_TimerWheel[Slot].Add(Entry);
+        
+        Info->m_bScheduled = true;
+        m_ScheduledCount++;
+    }
+
+    void ReplicationManager::AdvanceTimerWheel(float DeltaTime, TArray<UObject*>& OutDue)
+    {
+        OutDue.Empty();
+        m_WheelAccumulator += DeltaTime;
+        
+        while (m_WheelAccumulator >= m_WheelResolution)
+        {
+            m_WheelAccumulator -= m_WheelResolution;
+            m_WheelCursor = (m_WheelCursor + 1) & (TimerWheelSlots - 1);
+            
+            TArray<TimerEntry>& Slot = m_TimerWheel[m_WheelCursor];
+            for (int32 i = Slot.Num() - 1; i >= 0; --i)
+            {
+                if (Slot[i].Rounds > 0)
+                {
+                    Slot[i].Rounds--;
+                    continue;
+                }
+                
+                OutDue.Add(Slot[i].Object);
+                Slot.RemoveAtSwap(i);
+                m_ScheduledCount--;
+            }
+        }
+    }
+
+    void ReplicationManager::ClearTimerWheel()
+    {
+        for (TArray<TimerEntry>& Slot : m_TimerWheel)
+        {
+            Slot.Empty();
         }
         
-        return Info->ShouldReplicate(CurrentTime);
+        m_ScheduledCount = 0;
+        m_WheelAccumulator = 0.0f;
     }
 
     void ReplicationManager::ProcessObjectReplication(UObject* Object)
@@ -349,12 +863,43 @@ namespace UE4SDK
             return;
         }
         
-        // Simulate replication data
-        FString ReplicationData = TEXT("ReplicationData:") + Object->GetName();
-        Info->SetReplicationData(ReplicationData);
-        Info->SetReplicationSize(static_cast<int32>(ReplicationData.Len()));
-        Info->SetLastReplicationTime(Utils::Get().GetTimeSinceStart());
-        Info->ClearDirty();
+        // Dirty bits narrow the compare; a frequency-driven update compares everything
+        bool bDirtyOnly = Info->IsDirty();
+        bool bReliable = Info->GetReplicationType() == EReplicationType::Reliable;
+        int32 TotalBytes = 0;
+        
+        if (m_NetworkManager)
+        {
+            TArray<int32> Connections = m_NetworkManager->GetAllConnections();
+            PruneShadowStates(Info, Connections);
+            
+            for (int32 ConnectionID : Connections)
+            {
+                if (m_RelevancyFilter && !m_RelevancyFilter(Object, Info, ConnectionID))
+                {
+                    if (bDirtyOnly)
+                    {
+                        Info->MarkShadowStale(ConnectionID);
+                    }
+                    continue;
+                }
+                
+                m_PayloadWriter.Reset();
+                if (WritePropertyDelta(Object, Info, ConnectionID, bDirtyOnly, m_PayloadWriter) > 0)
+                {
+                    m_NetworkManager->SendData(ConnectionID, m_PayloadWriter.GetBuffer(), bReliable, TrackWrittenDelta(ConnectionID));
+                    TotalBytes += m_PayloadWriter.GetNumBytes();
+                }
+            }
+        }
+        
+        Info->SetReplicationSize(TotalBytes);
+        FinishObjectReplication(Object);
+        
+        if (TotalBytes == 0)
+        {
+            return;
+        }
         
         // Call replication callback
         if (m_OnObjectReplicatedCallback)
@@ -362,7 +907,214 @@ namespace UE4SDK
             m_OnObjectReplicatedCallback(Object);
         }
         
-        Utils::Get().LogDebug(TEXT("Object replicated: ") + Object->GetName());
+        LOG_DEBUG(TEXT("Object replicated: ") + Object->GetName() + TEXT(" (") + FString::FromInt(TotalBytes) + TEXT(" bytes)"));
+    }
+
+    int32 ReplicationManager::WritePropertyDelta(UObject* Object, ReplicationInfo* Info, int32 ConnectionID, bool bDirtyOnly, FBitWriter& Writer)
+    {
+        int32 PropertyCount = Info->GetReplicatedPropertyCount();
+        if (PropertyCount == 0)
+        {
+            return 0;
+        }
+        
+        // A connection without a shadow hasn't seen this object yet, and a stale one missed dirty bits
+        if (!Info->HasShadowState(ConnectionID) || Info->ConsumeShadowStale(ConnectionID))
+        {
+            bDirtyOnly = false;
+        }
+        TArray<FBitWriter>& Shadow = Info->FindOrAddShadowState(ConnectionID);
+        
+        // Compare serialized values so changes below the quantization step aren't sent.
+        // Values come from the frame cache, so each property is serialized once however many connections compare it.
+        m_ChangedScratch.Empty();
+        for (int32 i = 0; i < PropertyCount; ++i)
+        {
+            if (bDirtyOnly && !Info->IsPropertyDirty(i))
+            {
+                continue;
+            }
+            
+            const FBitWriter& Value = Info->GetSerializedProperty(Object, i, m_SerializationFrame);
+            if (Value != Shadow[i])
+            {
+                m_ChangedScratch.Add(i);
+            }
+        }
+        
+        if (m_ChangedScratch.Num() == 0)
+        {
+            return 0;
+        }
+        
+        // Without the socket nothing is sent, so nothing can be reported lost, and reliable sends are
+        // resent by the transport instead
+        m_SentScratch.Empty();
+        bool bTrackLoss = m_NetworkManager && m_NetworkManager->IsNetworkRunning() && Info->GetReplicationType() != EReplicationType::Reliable;
+        TArray<NetSentProperty>* OutSent = bTrackLoss ? &m_SentScratch : nullptr;
+        
+        int32 StartBits = Writer.GetNumBits();
+        WriteDeltaPayload(Object, Info, m_ChangedScratch, Info->GetSerializedProperties(), Shadow, Writer, OutSent);
+        
+        if ((Writer.GetNumBits() - StartBits) / 8 > m_MaxReplicationSize)
+        {
+            Utils::Get().LogWarning(TEXT("Property delta exceeds max replication size for object: ") + Object->GetName());
+        }
+        
+        return m_ChangedScratch.Num();
+    }
+
+    void ReplicationManager::SerializeObjectState(UObject* Object)
+    {
+        ReplicationInfo* Info = GetReplicationInfo(Object);
+        if (Info)
+        {
+            Info->SerializeAllProperties(Object, m_SerializationFrame);
+        }
+    }
+
+    int32 ReplicationManager::WriteCachedDelta(UObject* Object, const ReplicationInfo* Info, TArray<FBitWriter>& Shadow, TArray<int32>& ChangedScratch, FBitWriter& Writer, TArray<NetSentProperty>* OutSent)
+    {
+        int32 PropertyCount = Info->GetReplicatedPropertyCount();
+        const TArray<FBitWriter>& Values = Info->GetSerializedProperties();
+        if (PropertyCount == 0 || Values.Num() < PropertyCount)
+        {
+            return 0;
+        }
+        
+        if (Shadow.Num() < PropertyCount)
+        {
+            Shadow.SetNum(PropertyCount);
+        }
+        
+        ChangedScratch.Empty();
+        for (int32 i = 0; i < PropertyCount; ++i)
+        {
+            if (Values[i] != Shadow[i])
+            {
+                ChangedScratch.Add(i);
+            }
+        }
+        
+        if (ChangedScratch.Num() == 0)
+        {
+            return 0;
+        }
+        
+        WriteDeltaPayload(Object, Info, ChangedScratch, Values, Shadow, Writer, OutSent);
+        return ChangedScratch.Num();
+    }
+
+    uint32 ReplicationManager::TrackSentPacket(int32 ConnectionID, TArray<NetSentProperty>&& Properties)
+    {
+        uint32 Receipt = m_NextReceipt++;
+        if (m_NextReceipt == 0)
+        {
+            m_NextReceipt = 1; // Zero means untracked
+        }
+        
+        SentPacket& Packet = m_SentPackets.FindOrAdd(Receipt);
+        Packet.ConnectionID = ConnectionID;
+        Packet.Properties = std::move(Properties);
+        return Receipt;
+    }
+
+    void ReplicationManager::OnPacketDelivery(int32 ConnectionID, uint32 Receipt, bool bDelivered)
+    {
+        SentPacket* Packet = m_SentPackets.Find(Receipt);
+        if (!Packet || Packet->ConnectionID != ConnectionID)
+        {
+            return;
+        }
+        
+        // The shadows already hold what was lost
+        if (!bDelivered)
+        {
+            for (const NetSentProperty& Sent : Packet->Properties)
+            {
+                ReplicationInfo* Info = GetReplicationInfo(Sent.Object);
+                if (Info)
+                {
+                    Info->RollbackShadow(ConnectionID, Sent.Index, Sent.Base);
+                }
+            }
+        }
+        
+        m_SentPackets.Remove(Receipt);
+    }
+
+    uint32 ReplicationManager::TrackWrittenDelta(int32 ConnectionID)
+    {
+        return m_SentScratch.Num() > 0 ? TrackSentPacket(ConnectionID, std::move(m_SentScratch)) : 0;
+    }
+
+    bool ReplicationManager::ReadObjectDelta(FBitReader& Reader)
+    {
+        uint32 ObjectID = Reader.ReadVarUInt();
+        uint32 BodyBits = Reader.ReadVarUInt();
+        if (Reader.IsError() || BodyBits > static_cast<uint32>(Reader.GetBitsLeft()))
+        {
+            return false;
+        }
+        
+        // Not registered here (yet, or any more) - skip it, the rest of the packet still applies
+        UObject* Object = FindObjectByID(ObjectID);
+        ReplicationInfo* Info = GetReplicationInfo(Object);
+        if (!Info)
+        {
+            Utils::Get().LogWarning(TEXT("ReplicationManager::ReceiveReplication - Unknown object: ") + FString::FromInt(static_cast<int32>(ObjectID)));
+            Reader.SkipBits(static_cast<int32>(BodyBits));
+            return true;
+        }
+        
+        int32 BodyEnd = Reader.GetPosBits() + static_cast<int32>(BodyBits);
+        uint32 IndexMax = static_cast<uint32>(Info->GetReplicatedPropertyCount());
+        uint32 ChangedCount = Reader.SerializeInt(IndexMax + 1);
+        
+        for (uint32 i = 0; i < ChangedCount && !Reader.IsError(); ++i)
+        {
+            int32 Index = static_cast<int32>(Reader.SerializeInt(IndexMax));
+            if (Reader.IsError() || !Info->DeserializeProperty(Object, Index, Reader))
+            {
+                Reader.SetError();
+                break;
+            }
+            Info->NotifyReplicationReceived(Info->GetReplicatedPropertyName(Index));
+        }
+        
+        // A body that doesn't end where its length says means the property layouts disagree
+        if (!Reader.IsError() && Reader.GetPosBits() != BodyEnd)
+        {
+            Reader.SetError();
+        }
+        
+        if (Reader.IsError())
+        {
+            if (m_OnReplicationErrorCallback)
+            {
+                m_OnReplicationErrorCallback(Object, TEXT("Malformed property delta"));
+            }
+            return false;
+        }
+        
+        return true;
+    }
+
+    void ReplicationManager::PruneShadowStates(ReplicationInfo* Info, const TArray<int32>& Connections)
+    {
+        if (Info->GetShadowStateCount() <= Connections.Num())
+        {
+            return;
+        }
+        
+        // Drop shadows for connections that have gone away
+        for (int32 ConnectionID : Info->GetShadowConnections())
+        {
+            if (!Connections.Contains(ConnectionID))
+            {
+                Info->RemoveShadowState(ConnectionID);
+            }
+        }
     }
 
     // NetworkManager implementation
@@ -375,7 +1127,132 @@ namespace UE4SDK
         , m_bIsClient(false)
         , m_TotalBytesSent(0)
         , m_TotalBytesReceived(0)
+        , m_NextConnectionID(1)
+    {
+    }
+
+    bool NetworkManager::StartNetwork()
+    {
+        if (IsNetworkRunning())
+        {
+            return true;
+        }
+        
+        if (!m_bIsServer && !m_bIsClient)
+        {
+            Utils::Get().LogWarning(TEXT("NetworkManager::StartNetwork - Neither server nor client"));
+            return false;
+        }
+        
+        m_Transport = std::make_unique<NetTransport>();
+        m_Transport->SetOnMessageCallback([this](int32 ConnectionID, uint8 Channel, const uint8* Data, int32 Size)
+        {
+            OnTransportMessage(ConnectionID, Channel, Data, Size);
+        });
+        m_Transport->SetOnUnknownPeerCallback([this](const NetAddress& Address)
+        {
+            return OnUnknownPeer(Address);
+        });
+        m_Transport->SetOnPeerDisconnectedCallback([this](int32 ConnectionID)
+        {
+            RemoveConnection(ConnectionID);
+        });
+        m_Transport->SetOnDeliveryCallback([this](int32 ConnectionID, uint32 Receipt, bool bDelivered)
+        {
+            if (m_OnPacketDeliveryCallback)
+            {
+                m_OnPacketDeliveryCallback(ConnectionID, Receipt, bDelivered);
+            }
+        });
+        
+        // Clients take any free port, the server is the one with a known address
+        if (!m_Transport->Open(m_bIsServer ? m_ServerPort : 0))
+        {
+            m_Transport.reset();
+            return false;
+        }
+        
+        if (m_bIsClient && !m_bIsServer)
+        {
+            if (HasConnection(0))
+            {
+                m_Transport->AddPeer(0, NetAddress::FromString(m_ServerAddress, m_ServerPort));
+            }
+            else
+            {
+                AddConnection(0, m_ServerAddress, m_ServerPort);
+            }
+        }
+        
+        return true;
+    }
+
+    void NetworkManager::StopNetwork()
+    {
+        // Peers are told we're leaving; connections stay registered until DisconnectAll
+        if (m_Transport)
+        {
+            m_Transport->Close();
+            m_Transport.reset();
+        }
+    }
+
+    void NetworkManager::ReceiveNetwork()
+    {
+        if (IsNetworkRunning())
+        {
+            m_Transport->Receive();
+        }
+    }
+
+    void NetworkManager::FlushNetwork()
     {
+        if (IsNetworkRunning())
+        {
+            m_Transport->Flush();
+        }
+    }
+
+    void NetworkManager::OnTransportMessage(int32 ConnectionID, uint8 Channel, const uint8* Data, int32 Size)
+    {
+        m_TotalBytesReceived += Size;
+        StatsRegistry::AddCounter(StatBytesReceived, Size);
+        
+        if (Channel == DataChannel)
+        {
+            if (m_OnDataReceivedCallback)
+            {
+                m_OnDataReceivedCallback(ConnectionID, FString(std::string(reinterpret_cast<const char*>(Data), Size)));
+            }
+            return;
+        }
+        
+        if (m_OnPacketReceivedCallback)
+        {
+            m_ReceiveScratch.SetNum(Size);
+            if (Size > 0)
+            {
+                std::memcpy(m_ReceiveScratch.GetData(), Data, Size);
+            }
+            m_OnPacketReceivedCallback(ConnectionID, m_ReceiveScratch);
+        }
+    }
+
+    int32 NetworkManager::OnUnknownPeer(const NetAddress& Address)
+    {
+        if (!m_bIsServer || m_Connections.Num() >= m_MaxConnections)
+        {
+            return -1;
+        }
+        
+        while (HasConnection(m_NextConnectionID))
+        {
+            m_NextConnectionID++;
+        }
+        
+        int32 ConnectionID = m_NextConnectionID++;
+        AddConnection(ConnectionID, Address.ToString(), Address.Port);
+        return HasConnection(ConnectionID) ? ConnectionID : -1;
     }
 
     void NetworkManager::AddConnection(int32 ConnectionID, const FString& Address, int32 Port)
@@ -389,12 +1266,25 @@ namespace UE4SDK
         FString ConnectionInfo = Address + TEXT(":") + FString::FromInt(Port);
         m_Connections.Add(ConnectionID, ConnectionInfo);
         
+        if (IsNetworkRunning())
+        {
+            NetAddress PeerAddress = NetAddress::FromString(Address, Port);
+            if (PeerAddress.IsValid())
+            {
+                m_Transport->AddPeer(ConnectionID, PeerAddress);
+            }
+            else
+            {
+                Utils::Get().LogWarning(TEXT("NetworkManager::AddConnection - Invalid address: ") + ConnectionInfo);
+            }
+        }
+        
         if (m_OnConnectionCallback)
         {
             m_OnConnectionCallback(ConnectionID);
         }
         
-        Utils::Get().LogInfo(TEXT("Connection added: ") + FString::FromInt(ConnectionID) + TEXT(" - ") + ConnectionInfo);
+        LOG_INFO(TEXT("Connection added: ") + FString::FromInt(ConnectionID) + TEXT(" - ") + ConnectionInfo);
     }
 
     void NetworkManager::RemoveConnection(int32 ConnectionID)
@@ -403,12 +1293,17 @@ namespace UE4SDK
         {
             m_Connections.Remove(ConnectionID);
             
+            if (m_Transport)
+            {
+                m_Transport->RemovePeer(ConnectionID);
+            }
+            
             if (m_OnDisconnectionCallback)
             {
                 m_OnDisconnectionCallback(ConnectionID);
             }
             
-            Utils::Get().LogInfo(TEXT("Connection removed: ") + FString::FromInt(ConnectionID));
+            LOG_INFO(TEXT("Connection removed: ") + FString::FromInt(ConnectionID));
         }
     }
 
@@ -435,16 +1330,116 @@ namespace UE4SDK
             return;
         }
         
-        m_TotalBytesSent += static_cast<int32>(Data.Len());
-        Utils::Get().LogDebug(TEXT("Data sent to connection ") + FString::FromInt(ConnectionID) + TEXT(": ") + Data);
+        if (IsNetworkRunning())
+        {
+            auto Bytes = std::make_shared<TArray<uint8>>();
+            Bytes->SetNum(Data.Len());
+            if (Data.Len() > 0)
+            {
+                std::memcpy(Bytes->GetData(), *Data, Data.Len());
+            }
+            m_Transport->Send(ConnectionID, DataChannel, Bytes, true);
+        }
+        
+        m_TotalBytesSent += Data.Len();
+        StatsRegistry::AddCounter(StatBytesSent, Data.Len());
+        LOG_DEBUG(TEXT("Data sent to connection ") + FString::FromInt(ConnectionID) + TEXT(": ") + Data);
+    }
+
+    void NetworkManager::SendData(int32 ConnectionID, const TArray<uint8>& Data, bool bReliable, uint32 Receipt)
+    {
+        if (!HasConnection(ConnectionID))
+        {
+            Utils::Get().LogWarning(TEXT("NetworkManager::SendData - Connection not found: ") + FString::FromInt(ConnectionID));
+            return;
+        }
+        
+        if (IsNetworkRunning())
+        {
+            m_Transport->Send(ConnectionID, ReplicationChannel, std::make_shared<const TArray<uint8>>(Data), bReliable, Receipt);
+        }
+        
+        m_TotalBytesSent += Data.Num();
+        StatsRegistry::AddCounter(StatBytesSent, Data.Num());
+        LOG_DEBUG(TEXT("Data sent to connection ") + FString::FromInt(ConnectionID) + TEXT(": ") + FString::FromInt(Data.Num()) + TEXT(" bytes"));
     }
 
     void NetworkManager::SendDataToAll(const FString& Data)
     {
+        // Same payload for everyone - account for it in one pass instead of a SendData call per connection
+        int32 ConnectionCount = m_Connections.Num();
+        if (ConnectionCount == 0)
+        {
+            return;
+        }
+        
+        if (IsNetworkRunning())
+        {
+            auto Bytes = std::make_shared<TArray<uint8>>();
+            Bytes->SetNum(Data.Len());
+            if (Data.Len() > 0)
+            {
+                std::memcpy(Bytes->GetData(), *Data, Data.Len());
+            }
+            for (const auto& pair : m_Connections)
+            {
+                m_Transport->Send(pair.first, DataChannel, Bytes, true);
+            }
+        }
+        
+        m_TotalBytesSent += static_cast<int64>(Data.Len()) * ConnectionCount;
+        StatsRegistry::AddCounter(StatBytesSent, static_cast<int64>(Data.Len()) * ConnectionCount);
+        LOG_DEBUG(TEXT("Data sent to ") + FString::FromInt(ConnectionCount) + TEXT(" connections: ") + Data);
+    }
+
+    void NetworkManager::SendDataToAll(const TArray<uint8>& Data)
+    {
+        SendDataToAll(std::make_shared<const TArray<uint8>>(Data));
+    }
+
+    void NetworkManager::SendDataToAll(const NetPacketBuffer& Data)
+    {
+        // Every connection shares the one buffer
+        TArray<NetOutgoingPacket> Packets;
+        Packets.Reserve(m_Connections.Num());
         for (const auto& pair : m_Connections)
         {
-            SendData(pair.first, Data);
+            Packets.Add({ pair.first, Data });
         }
+        SendPackets(Packets);
+    }
+
+    void NetworkManager::SendPackets(TArray<NetOutgoingPacket>& Packets)
+    {
+        int32 PacketCount = 0;
+        int32 BatchBytes = 0;
+        
+        for (const NetOutgoingPacket& Packet : Packets)
+        {
+            if (!Packet.Data || !HasConnection(Packet.ConnectionID))
+            {
+                Utils::Get().LogWarning(TEXT("NetworkManager::SendPackets - Connection not found: ") + FString::FromInt(Packet.ConnectionID));
+                continue;
+            }
+            
+            if (IsNetworkRunning())
+            {
+                m_Transport->Send(Packet.ConnectionID, ReplicationChannel, Packet.Data, Packet.bReliable, Packet.Receipt);
+            }
+            
+            PacketCount++;
+            BatchBytes += Packet.Data->Num();
+        }
+        
+        m_TotalBytesSent += BatchBytes;
+        StatsRegistry::AddCounter(StatBytesSent, BatchBytes);
+        if (PacketCount > 0)
+        {
+            LOG_DEBUG(TEXT("Packet batch sent: ") + FString::FromInt(PacketCount) + TEXT(" packets, ") + FString::FromInt(BatchBytes) + TEXT(" bytes"));
+        }
+        
+        // Buffers are released here - anything still sharing one (another connection's packet) keeps it alive
+        Packets.Empty();
     }
 
     void NetworkManager::SendDataToAllExcept(int32 ExcludeConnectionID, const FString& Data)
@@ -460,28 +1455,45 @@ namespace UE4SDK
 
     void NetworkManager::BroadcastData(const FString& Data)
     {
-        SendDataToAll(Data);
+        SendDataToAll(Data);
+    }
+
+    int32 NetworkManager::GetConnectionCount() const
+    {
+        return static_cast<int32>(m_Connections.Num());
+    }
+
+    int64 NetworkManager::GetTotalBytesSent() const
+    {
+        return m_TotalBytesSent;
+    }
+
+    int64 NetworkManager::GetTotalBytesReceived() const
+    {
+        return m_TotalBytesReceived;
     }
 
-    int32 NetworkManager::GetConnectionCount() const
+    float NetworkManager::GetNetworkLatency(int32 ConnectionID) const
     {
-        return static_cast<int32>(m_Connections.Num());
+        const NetTransportStats* Stats = m_Transport ? m_Transport->GetStats(ConnectionID) : nullptr;
+        return Stats ? Stats->RoundTripTime : 0.0f;
     }
 
-    int32 NetworkManager::GetTotalBytesSent() const
+    float NetworkManager::GetNetworkJitter(int32 ConnectionID) const
     {
-        return m_TotalBytesSent;
+        const NetTransportStats* Stats = m_Transport ? m_Transport->GetStats(ConnectionID) : nullptr;
+        return Stats ? Stats->Jitter : 0.0f;
     }
 
-    int32 NetworkManager::GetTotalBytesReceived() const
+    float NetworkManager::GetPacketLoss(int32 ConnectionID) const
     {
-        return m_TotalBytesReceived;
+        const NetTransportStats* Stats = m_Transport ? m_Transport->GetStats(ConnectionID) : nullptr;
+        return Stats ? Stats->PacketLoss : 0.0f;
     }
 
-    float NetworkManager::GetNetworkLatency(int32 ConnectionID) const
+    int32 NetworkManager::GetConnectionSendRate(int32 ConnectionID) const
     {
-        // Simulate network latency
-        return Utils::Get().RandomFloat(0.01f, 0.1f);
+        return m_Transport ? m_Transport->GetSendRate(ConnectionID) : 0;
     }
 
     bool NetworkManager::ValidateConnection(int32 ConnectionID) const
@@ -516,6 +1528,7 @@ namespace UE4SDK
     void NetworkManager::ShutdownNetwork()
     {
         DisconnectAll();
+        StopNetwork();
         m_Connections.Empty();
         m_TotalBytesSent = 0;
         m_TotalBytesReceived = 0;
@@ -532,42 +1545,89 @@ namespace UE4SDK
         , m_TotalReplicationSize(0)
         , m_AverageReplicationTime(0.0f)
         , m_ReplicationErrors(0)
+        , m_BytesPerSecond(15000)
+        , m_StarvationWeight(0.5f)
+        , m_ElapsedTime(0.0f)
+        , m_TickCount(0)
     {
     }
 
-    void ServerReplication::ReplicateActors()
+    void ServerReplication::SetReplicationManager(ReplicationManager* Manager)
     {
-        if (!m_ReplicationManager)
+        if (m_ReplicationManager && m_ReplicationManager != Manager)
         {
-            return;
+            m_ReplicationManager->SetRelevancyFilter(nullptr);
         }
         
-        TArray<UObject*> ActorsToReplicate = GetActorsToReplicate();
+        m_ReplicationManager = Manager;
         
-        for (UObject* Actor : ActorsToReplicate)
+        // The manager's own update skips connections an object isn't relevant to
+        if (m_ReplicationManager)
         {
-            ReplicateActorToAll(Actor);
+            m_ReplicationManager->SetRelevancyFilter([this](UObject* Object, ReplicationInfo* Info, int32 ConnectionID)
+            {
+                return m_Relevancy.IsRelevant(Object, Info, ConnectionID);
+            });
         }
     }
 
-    void ServerReplication::ReplicateActorsToClient(int32 ClientID)
+    void ServerReplication::UpdateRelevancy()
     {
         if (!m_ReplicationManager || !m_NetworkManager)
         {
             return;
         }
         
-        if (!m_NetworkManager->HasConnection(ClientID))
+        m_Relevancy.Update(m_ReplicationManager, m_NetworkManager->GetAllConnections());
+    }
+
+    bool ServerReplication::IsActorRelevantTo(UObject* Actor, int32 ClientID) const
+    {
+        if (!m_ReplicationManager)
+        {
+            return false;
+        }
+        
+        return m_Relevancy.IsRelevant(Actor, m_ReplicationManager->GetReplicationInfo(Actor), ClientID);
+    }
+
+    void ServerReplication::ReplicateActors()
+    {
+        PROFILE_SCOPE("ServerReplication::ReplicateActors");
+        MEMORY_TAG_SCOPE(Replication);
+
+        if (!m_ReplicationManager || !m_NetworkManager)
         {
             return;
         }
         
-        TArray<UObject*> ActorsToReplicate = GetActorsToReplicate();
+        UpdateRelevancy();
+        
+        TArray<int32> Connections = m_NetworkManager->GetAllConnections();
+        
+        for (int32 ConnectionID : Connections)
+        {
+            ReplicateActorsToClient(ConnectionID);
+        }
+    }
+
+    void ServerReplication::ReplicateActorsToClient(int32 ClientID)
+    {
+        if (!m_NetworkManager || !m_NetworkManager->HasConnection(ClientID))
+        {
+            return;
+        }
         
-        for (UObject* Actor : ActorsToReplicate)
+        // Explicit request - every relevant actor gets compared, not just the ones with pending changes
+        ConnectionSchedule& Schedule = m_Schedules.FindOrAdd(ClientID);
+        for (UObject* Actor : GetActorsForClient(ClientID))
         {
-            ReplicateActorToClient(Actor, ClientID);
+            Schedule.Pending.insert(Actor);
         }
+        
+        TArray<int32> Connections;
+        Connections.Add(ClientID);
+        ReplicateToConnections(Connections, m_ReplicationTickRate > 0.0f ? 1.0f / m_ReplicationTickRate : 0.0f);
     }
 
     void ServerReplication::ReplicateActorToAll(UObject* Actor)
@@ -602,36 +1662,99 @@ namespace UE4SDK
             return;
         }
         
+        if (!IsActorRelevantTo(Actor, ClientID))
+        {
+            return;
+        }
+        
         ReplicationInfo* Info = m_ReplicationManager->GetReplicationInfo(Actor);
         if (!Info)
         {
             return;
         }
         
-        FString ReplicationData = Info->GetReplicationData();
-        m_NetworkManager->SendData(ClientID, ReplicationData);
+        int32 BytesSent = m_ReplicationManager->ReplicateObjectToConnection(Actor, ClientID);
+        if (BytesSent == 0)
+        {
+            return;
+        }
         
         m_ReplicatedActorsCount++;
-        m_TotalReplicationSize += Info->GetReplicationSize();
+        m_TotalReplicationSize += BytesSent;
+        StatsRegistry::AddCounter(StatActorsReplicated);
+        StatsRegistry::AddCounter(StatReplicationBytes, BytesSent);
         
         if (m_OnActorReplicatedCallback)
         {
             m_OnActorReplicatedCallback(Actor, ClientID);
         }
         
-        Utils::Get().LogDebug(TEXT("Actor replicated to client ") + FString::FromInt(ClientID) + TEXT(": ") + Actor->GetName());
+        LOG_DEBUG(TEXT("Actor replicated to client ") + FString::FromInt(ClientID) + TEXT(": ") + Actor->GetName());
     }
 
     void ServerReplication::ProcessServerReplication(float DeltaTime)
     {
+        MEMORY_TAG_SCOPE(Replication);
         if (!m_ReplicationManager)
         {
             return;
         }
         
-        m_ReplicationManager->ProcessReplication(DeltaTime);
-        UpdateReplicationPriorities();
+        if (!m_ReplicationManager->IsReplicationEnabled())
+        {
+            return;
+        }
+        
+        m_ElapsedTime += DeltaTime;
+        m_TickCount++;
+        auto TickStart = std::chrono::steady_clock::now();
+        
+        UpdateRelevancy();
+        
+        // Push model - only objects that changed (or are polled) and are due come back from the manager
+        m_ReplicationManager->CollectReadyObjects(DeltaTime, m_ReadyObjects);
+        
+        if (m_NetworkManager)
+        {
+            TArray<int32> Connections = m_NetworkManager->GetAllConnections();
+            PruneSchedules(Connections);
+            
+            for (int32 ConnectionID : Connections)
+            {
+                ConnectionSchedule& Schedule = m_Schedules.FindOrAdd(ConnectionID);
+                
+                // Changed objects this client can see, plus anything that just came into view
+                for (UObject* Object : m_ReadyObjects)
+                {
+                    if (m_Relevancy.IsRelevant(Object, m_ReplicationManager->GetReplicationInfo(Object), ConnectionID))
+                    {
+                        Schedule.Pending.insert(Object);
+                    }
+                }
+                for (UObject* Object : m_Relevancy.GetNewlyRelevantActors(ConnectionID))
+                {
+                    Schedule.Pending.insert(Object);
+                }
+            }
+            
+            ReplicateToConnections(Connections, DeltaTime);
+        }
+        
+        // Sends compare against each client's shadow, so the dirty bits are done with once collected
+        for (UObject* Object : m_ReadyObjects)
+        {
+            m_ReplicationManager->FinishObjectReplication(Object);
+        }
+        
         ProcessReplicationQueue();
+        
+        float TickSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - TickStart).count();
+        m_AverageReplicationTime = m_TickCount == 1 ? TickSeconds : m_AverageReplicationTime + (TickSeconds - m_AverageReplicationTime) * ReplicationTimeSmoothing;
+        StatsRegistry::Get().RecordHistogram(StatReplicationTickMs, TickSeconds * 1000.0f);
+        if (m_NetworkManager)
+        {
+            StatsRegistry::Get().SetGauge(StatConnections, m_NetworkManager->GetConnectionCount());
+        }
     }
 
     void ServerReplication::UpdateReplicationPriorities()
@@ -651,20 +1774,78 @@ namespace UE4SDK
 
     void ServerReplication::ProcessReplicationQueue()
     {
-        int32 ProcessedCount = 0;
+        if (m_ReplicationQueue.Num() == 0)
+        {
+            return;
+        }
         
         for (UObject* Actor : m_ReplicationQueue)
         {
-            if (ProcessedCount >= m_MaxReplicationPerTick)
-            {
-                break;
-            }
-            
+            CalculateReplicationPriority(Actor);
+        }
+        
+        // Highest priority first; only the part that gets processed is ordered
+        auto GetPriority = [this](UObject* Actor)
+        {
+            const float* Priority = m_ReplicationPriorities.Find(Actor);
+            return Priority ? *Priority : 0.0f;
+        };
+        auto ByPriority = [&GetPriority](UObject* A, UObject* B) { return GetPriority(A) > GetPriority(B); };
+        
+        int32 ProcessCount = std::min(m_ReplicationQueue.Num(), m_MaxReplicationPerTick);
+        std::nth_element(m_ReplicationQueue.begin(), m_ReplicationQueue.begin() + ProcessCount, m_ReplicationQueue.end(), ByPriority);
+        std::sort(m_ReplicationQueue.begin(), m_ReplicationQueue.begin() + ProcessCount, ByPriority);
+        
+        TArray<UObject*> Processed;
+        for (int32 i = 0; i < ProcessCount; ++i)
+        {
+            Processed.Add(m_ReplicationQueue[i]);
+        }
+        
+        TArray<UObject*> Remaining;
+        for (int32 i = ProcessCount; i < m_ReplicationQueue.Num(); ++i)
+        {
+            Remaining.Add(m_ReplicationQueue[i]);
+        }
+        m_ReplicationQueue = std::move(Remaining);
+        
+        for (UObject* Actor : Processed)
+        {
             ProcessActorReplication(Actor);
-            ProcessedCount++;
         }
     }
 
+    float ServerReplication::CalculateActorPriority(UObject* Actor, int32 ClientID) const
+    {
+        ReplicationInfo* Info = m_ReplicationManager ? m_ReplicationManager->GetReplicationInfo(Actor) : nullptr;
+        if (!Info)
+        {
+            return 0.0f;
+        }
+        
+        const ActorSendState* State = nullptr;
+        const ConnectionSchedule* Schedule = m_Schedules.Find(ClientID);
+        if (Schedule)
+        {
+            auto It = Schedule->Actors.find(Actor);
+            State = It != Schedule->Actors.end() ? &It->second : nullptr;
+        }
+        
+        return CalculateConnectionPriority(Actor, Info, ClientID, State);
+    }
+
+    const NetConnectionStats* ServerReplication::GetConnectionStats(int32 ClientID) const
+    {
+        const ConnectionSchedule* Schedule = m_Schedules.Find(ClientID);
+        return Schedule ? &Schedule->Stats : nullptr;
+    }
+
+    float ServerReplication::GetConnectionSaturation(int32 ClientID) const
+    {
+        const NetConnectionStats* Stats = GetConnectionStats(ClientID);
+        return Stats ? Stats->Saturation : 0.0f;
+    }
+
     TArray<UObject*> ServerReplication::GetActorsToReplicate() const
     {
         if (!m_ReplicationManager)
@@ -689,11 +1870,17 @@ namespace UE4SDK
             return Actors;
         }
         
+        // Relevant set from the last UpdateRelevancy, or a direct check per actor before the first one
+        if (m_Relevancy.HasRelevantSet(ClientID))
+        {
+            return m_Relevancy.GetRelevantActors(ClientID);
+        }
+        
         TArray<UObject*> AllActors = GetActorsToReplicate();
         
         for (UObject* Actor : AllActors)
         {
-            if (ShouldReplicateActor(Actor))
+            if (ShouldReplicateActor(Actor) && IsActorRelevantTo(Actor, ClientID))
             {
                 Actors.Add(Actor);
             }
@@ -722,7 +1909,7 @@ namespace UE4SDK
         return m_ReplicatedActorsCount;
     }
 
-    int32 ServerReplication::GetTotalReplicationSize() const
+    int64 ServerReplication::GetTotalReplicationSize() const
     {
         return m_TotalReplicationSize;
     }
@@ -798,6 +1985,9 @@ namespace UE4SDK
     {
         ClearReplicationQueue();
         m_ReplicationPriorities.Empty();
+        m_Schedules.Empty();
+        m_ElapsedTime = 0.0f;
+        m_TickCount = 0;
         m_ReplicatedActorsCount = 0;
         m_TotalReplicationSize = 0;
         m_AverageReplicationTime = 0.0f;
@@ -819,15 +2009,20 @@ namespace UE4SDK
 
     void ServerReplication::CalculateReplicationPriority(UObject* Actor)
     {
-        // Simple priority calculation based on object name hash
-        uint32 Hash = 0;
-        FString Name = Actor->GetName();
-        for (int32 i = 0; i < Name.Len(); ++i)
+        ReplicationInfo* Info = m_ReplicationManager->GetReplicationInfo(Actor);
+        if (!Info)
+        {
+            return;
+        }
+        
+        // Base priority - the actor's own priority scaled by its class priority
+        float Priority = Info->GetNetPriority();
+        const float* ClassPriority = m_ClassPriorities.Find(Actor->GetClass());
+        if (ClassPriority)
         {
-            Hash = Hash * 31 + static_cast<uint32>(Name[i]);
+            Priority *= *ClassPriority;
         }
         
-        float Priority = static_cast<float>(Hash % 100) / 100.0f;
         m_ReplicationPriorities.Add(Actor, Priority);
     }
 
@@ -859,8 +2054,321 @@ namespace UE4SDK
             return;
         }
         
-        // Simulate actor replication processing
-        Utils::Get().LogDebug(TEXT("Processing actor replication: ") + Actor->GetName());
+        // Queued actors are forced out to every connection they're relevant to
+        ReplicateActorToAll(Actor);
+    }
+
+    void ServerReplication::ReplicateToConnections(const TArray<int32>& Connections, float DeltaTime)
+    {
+        if (!m_ReplicationManager || !m_NetworkManager)
+        {
+            return;
+        }
+        
+        // Map nodes are stable, so each worker can hold on to its own connection's schedule
+        m_BuildConnections.Empty();
+        m_BuildSchedules.Empty();
+        for (int32 ConnectionID : Connections)
+        {
+            if (m_NetworkManager->HasConnection(ConnectionID))
+            {
+                m_BuildConnections.Add(ConnectionID);
+                m_BuildSchedules.Add(&m_Schedules.FindOrAdd(ConnectionID));
+            }
+        }
+        
+        int32 ConnectionCount = m_BuildConnections.Num();
+        if (ConnectionCount == 0)
+        {
+            return;
+        }
+        
+        // Pick and order each connection's candidates - only reads shared actor state, so connections run in parallel
+        JobSystem::Get().ParallelFor(ConnectionCount, ConnectionBatchSize, [this, DeltaTime](int32 Begin, int32 End)
+        {
+            for (int32 i = Begin; i < End; ++i)
+            {
+                SelectPacketEntries(m_BuildConnections[i], *m_BuildSchedules[i], DeltaTime);
+            }
+        });
+        
+        // Serialize every picked actor once, shared by all connections that picked it.
+        // Property getters are gameplay code, so this stays on the game thread.
+        m_ReplicationManager->BeginSerializationFrame();
+        for (ConnectionSchedule* Schedule : m_BuildSchedules)
+        {
+            for (const PacketEntry& Entry : Schedule->Entries)
+            {
+                Entry.Info->SerializeAllProperties(Entry.Actor, m_ReplicationManager->GetSerializationFrame());
+            }
+        }
+        
+        // Assemble packets - each worker only compares cached values against its own connection's shadows
+        JobSystem::Get().ParallelFor(ConnectionCount, ConnectionBatchSize, [this](int32 Begin, int32 End)
+        {
+            for (int32 i = Begin; i < End; ++i)
+            {
+                AssemblePacket(*m_BuildSchedules[i]);
+            }
+        });
+        
+        // Commit shared state and hand the finished buffers to the network layer in one batch
+        m_OutgoingPackets.Empty();
+        for (int32 i = 0; i < ConnectionCount; ++i)
+        {
+            FinishPacket(m_BuildConnections[i], *m_BuildSchedules[i]);
+        }
+        
+        if (m_OutgoingPackets.Num() > 0)
+        {
+            m_NetworkManager->SendPackets(m_OutgoingPackets);
+        }
+    }
+
+    void ServerReplication::SelectPacketEntries(int32 ClientID, ConnectionSchedule& Schedule, float DeltaTime)
+    {
+        // Budget for this tick - overshoot is paid back next tick, unused bytes carry over up to one tick's worth
+        Schedule.BytesPerTick = static_cast<float>(Schedule.BytesPerSecond > 0 ? Schedule.BytesPerSecond : m_BytesPerSecond) * DeltaTime;
+        
+        // Never more than congestion control says the path can take
+        int32 SendRate = m_NetworkManager->GetConnectionSendRate(ClientID);
+        if (SendRate > 0)
+        {
+            Schedule.BytesPerTick = std::min(Schedule.BytesPerTick, static_cast<float>(SendRate) * DeltaTime);
+        }
+        Schedule.Budget = Schedule.BytesPerTick + Schedule.BudgetCarry;
+        Schedule.ActorsDeferred = 0;
+        Schedule.MaxStarvation = 0;
+        
+        // Candidates are pending actors that are still relevant; the rest rejoin once they're newly relevant again
+        TArray<PrioritizedActor>& Candidates = Schedule.Candidates;
+        Candidates.Empty();
+        Candidates.Reserve(static_cast<int32>(Schedule.Pending.size()));
+        for (auto It = Schedule.Pending.begin(); It != Schedule.Pending.end();)
+        {
+            UObject* Actor = *It;
+            ReplicationInfo* Info = m_ReplicationManager->GetReplicationInfo(Actor);
+            if (!Info || !Info->IsValidForReplication() || !m_Relevancy.IsRelevant(Actor, Info, ClientID))
+            {
+                It = Schedule.Pending.erase(It);
+                continue;
+            }
+            
+            auto StateIt = Schedule.Actors.find(Actor);
+            const ActorSendState* State = StateIt != Schedule.Actors.end() ? &StateIt->second : nullptr;
+            Candidates.Add({ Actor, CalculateConnectionPriority(Actor, Info, ClientID, State) });
+            ++It;
+        }
+        
+        // Only the candidates that can be sent this tick are ordered
+        auto ByPriority = [](const PrioritizedActor& A, const PrioritizedActor& B) { return A.Priority > B.Priority; };
+        int32 CandidateCount = std::min(Candidates.Num(), m_MaxReplicationPerTick);
+        std::nth_element(Candidates.begin(), Candidates.begin() + CandidateCount, Candidates.end(), ByPriority);
+        std::sort(Candidates.begin(), Candidates.begin() + CandidateCount, ByPriority);
+        
+        Schedule.Entries.Empty();
+        for (int32 i = 0; i < Candidates.Num(); ++i)
+        {
+            UObject* Actor = Candidates[i].Actor;
+            ActorSendState& State = Schedule.Actors[Actor];
+            State.LastTick = m_TickCount;
+            
+            // Past the candidate cut - wait for a later tick with more weight
+            if (i >= CandidateCount)
+            {
+                State.Starvation++;
+                Schedule.MaxStarvation = std::max(Schedule.MaxStarvation, State.Starvation);
+                Schedule.ActorsDeferred++;
+                continue;
+            }
+            
+            ReplicationInfo* Info = m_ReplicationManager->GetReplicationInfo(Actor);
+            PacketEntry& Entry = Schedule.Entries.Emplace();
+            Entry.Actor = Actor;
+            Entry.Info = Info;
+            Entry.Shadow = Info->FindShadowState(ClientID);
+            Entry.bProcessed = false;
+            Entry.bWritten = false;
+        }
+    }
+
+    void ServerReplication::AssemblePacket(ConnectionSchedule& Schedule)
+    {
+        Schedule.PacketWriter.Reset();
+        Schedule.ReliablePacketWriter.Reset();
+        Schedule.SentProperties.Empty();
+        
+        // Each packet has to fit in one transport message once the socket is up - a new actor
+        // only starts in the first half, which leaves room for its delta
+        bool bNetworkRunning = m_NetworkManager->IsNetworkRunning();
+        
+        for (PacketEntry& Entry : Schedule.Entries)
+        {
+            ActorSendState& State = Schedule.Actors[Entry.Actor];
+            bool bReliable = Entry.Info->GetReplicationType() == EReplicationType::Reliable;
+            FBitWriter& Writer = bReliable ? Schedule.ReliablePacketWriter : Schedule.PacketWriter;
+            
+            // Out of bytes - wait for a later tick with more weight
+            int32 BytesWritten = Schedule.PacketWriter.GetNumBytes() + Schedule.ReliablePacketWriter.GetNumBytes();
+            if (BytesWritten >= Schedule.Budget || (bNetworkRunning && Writer.GetNumBytes() >= NetTransport::MaxMessageSize / 2))
+            {
+                State.Starvation++;
+                Schedule.MaxStarvation = std::max(Schedule.MaxStarvation, State.Starvation);
+                Schedule.ActorsDeferred++;
+                continue;
+            }
+            
+            // First sends compare against a fresh shadow that's committed on the game thread afterwards
+            TArray<FBitWriter>& Shadow = Entry.Shadow ? *Entry.Shadow : Entry.NewShadow;
+            // Reliable packets are resent by the transport, unreliable ones are rolled back if lost
+            TArray<NetSentProperty>* OutSent = !bReliable && bNetworkRunning ? &Schedule.SentProperties : nullptr;
+            Entry.bWritten = ReplicationManager::WriteCachedDelta(Entry.Actor, Entry.Info, Shadow, Schedule.ChangedScratch, Writer, OutSent) > 0;
+            Entry.bProcessed = true;
+            
+            // Sent or already up to date, either way the client has the current state
+            State.LastSendTime = m_ElapsedTime;
+            State.Starvation = 0;
+            Schedule.Pending.erase(Entry.Actor);
+        }
+    }
+
+    void ServerReplication::FinishPacket(int32 ClientID, ConnectionSchedule& Schedule)
+    {
+        int32 ActorsSent = 0;
+        for (PacketEntry& Entry : Schedule.Entries)
+        {
+            if (!Entry.bProcessed)
+            {
+                continue;
+            }
+            
+            if (!Entry.Shadow)
+            {
+                Entry.Info->FindOrAddShadowState(ClientID) = std::move(Entry.NewShadow);
+            }
+            
+            // A full compare covers anything a dirty-only pass skipped while this client wasn't relevant
+            Entry.Info->ConsumeShadowStale(ClientID);
+            
+            if (Entry.bWritten)
+            {
+                ActorsSent++;
+                m_ReplicatedActorsCount++;
+                
+                if (m_OnActorReplicatedCallback)
+                {
+                    m_OnActorReplicatedCallback(Entry.Actor, ClientID);
+                }
+            }
+        }
+        Schedule.Entries.Empty();
+        
+        // The packets' bytes move into shared buffers, nothing is copied on the way out
+        int32 BytesSent = 0;
+        for (FBitWriter* Writer : { &Schedule.PacketWriter, &Schedule.ReliablePacketWriter })
+        {
+            int32 PacketBytes = Writer->GetNumBytes();
+            if (PacketBytes > 0)
+            {
+                bool bReliable = Writer == &Schedule.ReliablePacketWriter;
+                uint32 Receipt = !bReliable && Schedule.SentProperties.Num() > 0 ? m_ReplicationManager->TrackSentPacket(ClientID, std::move(Schedule.SentProperties)) : 0;
+                m_OutgoingPackets.Add({ ClientID, std::make_shared<const TArray<uint8>>(Writer->ReleaseBuffer()), bReliable, Receipt });
+                BytesSent += PacketBytes;
+            }
+        }
+        m_TotalReplicationSize += BytesSent;
+        StatsRegistry::AddCounter(StatActorsReplicated, ActorsSent);
+        StatsRegistry::AddCounter(StatReplicationBytes, BytesSent);
+        
+        float Budget = Schedule.Budget;
+        Schedule.BudgetCarry = std::max(-Schedule.BytesPerTick, std::min(Budget - static_cast<float>(BytesSent), Schedule.BytesPerTick));
+        
+        NetConnectionStats& Stats = Schedule.Stats;
+        Stats.BytesBudget = static_cast<int32>(Budget);
+        Stats.BytesSentLastTick = BytesSent;
+        Stats.Saturation = Budget > 0.0f ? static_cast<float>(BytesSent) / Budget : (BytesSent > 0 ? 1.0f : 0.0f);
+        Stats.TotalTicks++;
+        if (Schedule.ActorsDeferred > 0 && BytesSent > 0 && BytesSent >= Budget)
+        {
+            Stats.SaturatedTicks++;
+        }
+        Stats.ActorsSentLastTick = ActorsSent;
+        Stats.ActorsDeferredLastTick = Schedule.ActorsDeferred;
+        Stats.MaxStarvation = Schedule.MaxStarvation;
+    }
+
+    float ServerReplication::CalculateConnectionPriority(UObject* Actor, ReplicationInfo* Info, int32 ClientID, const ActorSendState* State) const
+    {
+        // Base priority - the actor's own priority scaled by its class priority
+        float Priority = Info->GetNetPriority();
+        const float* ClassPriority = m_ClassPriorities.Find(Actor->GetClass());
+        if (ClassPriority)
+        {
+            Priority *= *ClassPriority;
+        }
+        
+        // Owned actors and first sends matter most to the client
+        if (Info->GetOwnerConnection() == ClientID)
+        {
+            Priority *= 2.0f;
+        }
+        if (!Info->HasShadowState(ClientID))
+        {
+            Priority *= 2.0f;
+        }
+        
+        // Distance falls off to 0.2 at the cull distance, view direction scales 0.5 behind to 1.5 ahead
+        const NetConnectionView* View = m_Relevancy.GetConnectionView(ClientID);
+        if (View && Info->HasNetLocation() && !Info->IsAlwaysRelevant())
+        {
+            FVector ToActor = Info->GetNetLocation() - View->Location;
+            float Distance = std::sqrt(ToActor.SizeSquared());
+            float CullDistance = std::max(Info->GetNetCullDistance(), 1.0f);
+            Priority *= 1.0f - 0.8f * std::min(Distance / CullDistance, 1.0f);
+            
+            if (Distance > 1.0f)
+            {
+                float Facing = (ToActor.X * View->Forward.X + ToActor.Y * View->Forward.Y + ToActor.Z * View->Forward.Z) / Distance;
+                Priority *= 1.0f + 0.5f * Facing;
+            }
+        }
+        
+        // Time since the client was last brought up to date, and weight from missed sends
+        if (State)
+        {
+            Priority *= 1.0f + std::min(m_ElapsedTime - State->LastSendTime, 5.0f);
+            Priority *= 1.0f + m_StarvationWeight * static_cast<float>(State->Starvation);
+        }
+        
+        return Priority;
+    }
+
+    void ServerReplication::PruneSchedules(const TArray<int32>& Connections)
+    {
+        TArray<int32> StaleConnections;
+        for (auto& pair : m_Schedules)
+        {
+            if (!Connections.Contains(pair.first))
+            {
+                StaleConnections.Add(pair.first);
+                continue;
+            }
+            
+            // Forget actors that haven't been relevant for a few seconds
+            if ((m_TickCount & 63) == 0)
+            {
+                auto& Actors = pair.second.Actors;
+                for (auto It = Actors.begin(); It != Actors.end();)
+                {
+                    It = (m_TickCount - It->second.LastTick > 256) ? Actors.erase(It) : std::next(It);
+                }
+            }
+        }
+        
+        for (int32 ConnectionID : StaleConnections)
+        {
+            m_Schedules.Remove(ConnectionID);
+        }
     }
 
     // ReplicationSystem implementation
@@ -870,6 +2378,7 @@ namespace UE4SDK
     {
         if (!s_Instance)
         {
+            MEMORY_TAG_SCOPE(Replication);
             s_Instance = new ReplicationSystem();
         }
         return *s_Instance;
@@ -881,9 +2390,24 @@ namespace UE4SDK
         m_NetworkManager = std::make_unique<NetworkManager>();
         m_ServerReplication = std::make_unique<ServerReplication>();
         
+        m_ReplicationManager->SetNetworkManager(m_NetworkManager.get());
         m_ServerReplication->SetReplicationManager(m_ReplicationManager.get());
         m_ServerReplication->SetNetworkManager(m_NetworkManager.get());
         
+        // Replication packets from the transport go straight to the manager, and so does word of lost ones
+        ReplicationManager* Manager = m_ReplicationManager.get();
+        m_NetworkManager->SetOnPacketReceivedCallback([Manager](int32 ConnectionID, const TArray<uint8>& Payload)
+        {
+            if (!Manager->ReceiveReplication(Payload))
+            {
+                Utils::Get().LogWarning(TEXT("ReplicationSystem - Malformed replication packet from connection ") + FString::FromInt(ConnectionID));
+            }
+        });
+        m_NetworkManager->SetOnPacketDeliveryCallback([Manager](int32 ConnectionID, uint32 Receipt, bool bDelivered)
+        {
+            Manager->OnPacketDelivery(ConnectionID, Receipt, bDelivered);
+        });
+        
         m_bReplicationEnabled = true;
         m_bNetworkEnabled = true;
         
@@ -915,15 +2439,26 @@ namespace UE4SDK
 
     void ReplicationSystem::Update(float DeltaTime)
     {
-        if (m_bReplicationEnabled && m_ReplicationManager)
+        // Incoming packets are applied before this tick's state is gathered, and everything queued goes out at the end
+        if (m_NetworkManager)
         {
-            m_ReplicationManager->ProcessReplication(DeltaTime);
+            m_NetworkManager->ReceiveNetwork();
         }
         
+        // The server path is budgeted and prioritized, so it replaces the manager's own pass when networking is on
         if (m_bNetworkEnabled && m_ServerReplication)
         {
             m_ServerReplication->ProcessServerReplication(DeltaTime);
         }
+        else if (m_bReplicationEnabled && m_ReplicationManager)
+        {
+            m_ReplicationManager->ProcessReplication(DeltaTime);
+        }
+        
+        if (m_NetworkManager)
+        {
+            m_NetworkManager->FlushNetwork();
+        }
     }
 
     void ReplicationSystem::SetReplicationEnabled(bool bEnabled)
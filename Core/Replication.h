@@ -7,8 +7,14 @@
 
 #include "Types.h"
 #include "UObject.h"
+#include "NetSerialization.h"
+#include "NetRelevancy.h"
+#include "NetTransport.h"
+#include "NetFastArray.h"
 #include <memory>
 #include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace UE4SDK
 {
@@ -49,6 +55,12 @@ namespace UE4SDK
         Authority = 3
     };
 
+    enum class ENetDormancy : uint8
+    {
+        Awake = 0,
+        Dormant = 1     // Not updated on clients that already have it until FlushNetDormancy
+    };
+
     enum class ENetMode : uint8
     {
         Standalone = 0,
@@ -57,6 +69,19 @@ namespace UE4SDK
         Client = 3
     };
 
+    // Replicated property - Serialize writes the current value, Deserialize applies a received one.
+    // With SerializeDelta set, Serialize only writes the state that's compared and kept as the shadow,
+    // and what goes on the wire is SerializeDelta's diff against the connection's shadow.
+    // If a delta is lost, MergeLostShadow folds the shadow it was written against back into the current one.
+    struct ReplicatedProperty
+    {
+        FString Name;
+        std::function<void(UObject*, FBitWriter&)> Serialize;
+        std::function<bool(UObject*, FBitReader&)> Deserialize;
+        std::function<void(UObject*, const FBitWriter&, FBitWriter&)> SerializeDelta;
+        std::function<void(const FBitWriter&, FBitWriter&)> MergeLostShadow;
+    };
+
     // Replication info for objects
     class ReplicationInfo
     {
@@ -64,6 +89,12 @@ namespace UE4SDK
         ReplicationInfo();
         virtual ~ReplicationInfo() = default;
 
+        // Fast arrays and the manager call back into the info they were registered with, so it stays put
+        ReplicationInfo(const ReplicationInfo&) = delete;
+        ReplicationInfo& operator=(const ReplicationInfo&) = delete;
+        ReplicationInfo(ReplicationInfo&&) = delete;
+        ReplicationInfo& operator=(ReplicationInfo&&) = delete;
+
         // Replication settings
         void SetReplicationType(EReplicationType Type) { m_ReplicationType = Type; }
         EReplicationType GetReplicationType() const { return m_ReplicationType; }
@@ -81,12 +112,38 @@ namespace UE4SDK
         void SetReplicated(bool bReplicated) { m_bReplicated = bReplicated; }
         bool IsReplicated() const { return m_bReplicated; }
         
-        void SetDirty(bool bDirty) { m_bDirty = bDirty; }
+        void SetDirty(bool bDirty) { bDirty ? MarkDirty() : ClearDirty(); }
         bool IsDirty() const { return m_bDirty; }
         
         void SetInitialReplication(bool bInitial) { m_bInitialReplication = bInitial; }
         bool IsInitialReplication() const { return m_bInitialReplication; }
 
+        // Relevancy - objects without a location getter are relevant everywhere
+        void SetNetLocationGetter(std::function<FVector()> Getter) { m_NetLocationGetter = Getter; }
+        bool HasNetLocation() const { return static_cast<bool>(m_NetLocationGetter); }
+        void UpdateNetLocation() { if (m_NetLocationGetter) m_NetLocation = m_NetLocationGetter(); }
+        const FVector& GetNetLocation() const { return m_NetLocation; }
+        
+        void SetNetCullDistance(float Distance) { m_NetCullDistance = Distance; }
+        float GetNetCullDistance() const { return m_NetCullDistance; }
+        
+        void SetAlwaysRelevant(bool bAlwaysRelevant) { m_bAlwaysRelevant = bAlwaysRelevant; }
+        bool IsAlwaysRelevant() const { return m_bAlwaysRelevant; }
+        
+        void SetNetPriority(float Priority) { m_NetPriority = Priority; }
+        float GetNetPriority() const { return m_NetPriority; }
+        
+        void SetOwnerConnection(int32 ConnectionID) { m_OwnerConnection = ConnectionID; }
+        int32 GetOwnerConnection() const { return m_OwnerConnection; }
+        bool IsRelevantToConnection(int32 ConnectionID) const;
+
+        // Dormancy
+        void SetNetDormancy(ENetDormancy Dormancy) { m_NetDormancy = Dormancy; }
+        ENetDormancy GetNetDormancy() const { return m_NetDormancy; }
+        bool IsDormant() const { return m_NetDormancy == ENetDormancy::Dormant && !m_bDormancyFlushPending; }
+        void FlushNetDormancy();
+        void ClearDormancyFlush() { m_bDormancyFlushPending = false; }
+
         // Replication timing
         void SetReplicationFrequency(float Frequency) { m_ReplicationFrequency = Frequency; }
         float GetReplicationFrequency() const { return m_ReplicationFrequency; }
@@ -109,6 +166,74 @@ namespace UE4SDK
         // Replication callbacks
         void SetOnReplicationCallback(std::function<void()> Callback) { m_OnReplicationCallback = Callback; }
         void SetOnReplicationReceivedCallback(std::function<void(const FString&)> Callback) { m_OnReplicationReceivedCallback = Callback; }
+        const std::function<void(const FString&)>& GetOnReplicationReceivedCallback() const { return m_OnReplicationReceivedCallback; }
+        void NotifyReplicationReceived(const FString& PropertyName) const { if (m_OnReplicationReceivedCallback) m_OnReplicationReceivedCallback(PropertyName); }
+
+        // Replicated properties - string properties go through UObject::GetProperty/SetProperty unless a getter is given
+        int32 AddReplicatedProperty(const ReplicatedProperty& Property);
+        int32 AddReplicatedProperty(const FString& PropertyName, std::function<FString()> Getter = nullptr);
+        int32 FindReplicatedProperty(const FString& PropertyName) const;
+        int32 GetReplicatedPropertyCount() const { return m_Properties.Num(); }
+        const FString& GetReplicatedPropertyName(int32 Index) const { return m_Properties[Index].Name; }
+        void SerializeProperty(UObject* Object, int32 Index, FBitWriter& Writer) const;
+        bool DeserializeProperty(UObject* Object, int32 Index, FBitReader& Reader) const;
+        void WritePropertyValue(UObject* Object, int32 Index, const FBitWriter& Value, const FBitWriter& Shadow, FBitWriter& Writer) const;
+
+        // Serialization cache - each property is serialized at most once per frame and shared by every connection
+        const FBitWriter& GetSerializedProperty(UObject* Object, int32 Index, uint32 Frame);
+        void SerializeAllProperties(UObject* Object, uint32 Frame);
+        const TArray<FBitWriter>& GetSerializedProperties() const { return m_SerializedValues; }
+
+        // Typed property - encoded through TNetSerializer<T>, Value must outlive the registration
+        template<typename T>
+        int32 AddReplicatedProperty(const FString& PropertyName, T* Value)
+        {
+            ReplicatedProperty Property;
+            Property.Name = PropertyName;
+            Property.Serialize = [Value](UObject*, FBitWriter& Writer) { NetSerialize(Writer, *Value); };
+            Property.Deserialize = [Value](UObject*, FBitReader& Reader) { return NetDeserialize(Reader, *Value); };
+            return AddReplicatedProperty(Property);
+        }
+
+        // Fast array property - only added, changed and removed elements are sent, see TFastArray
+        template<typename T>
+        int32 AddFastArrayProperty(const FString& PropertyName, TFastArray<T>* Array)
+        {
+            ReplicatedProperty Property;
+            Property.Name = PropertyName;
+            Property.Serialize = [Array](UObject*, FBitWriter& Writer) { Array->SerializeState(Writer); };
+            Property.Deserialize = [Array](UObject*, FBitReader& Reader) { return Array->DeserializeDelta(Reader); };
+            Property.SerializeDelta = [Array](UObject*, const FBitWriter& Shadow, FBitWriter& Writer) { Array->SerializeDelta(Shadow, Writer); };
+            Property.MergeLostShadow = &TFastArray<T>::MergeLostShadow;
+            
+            int32 Index = AddReplicatedProperty(Property);
+            Array->SetOnDirtyCallback([this, Index]() { MarkPropertyDirty(Index); });
+            return Index;
+        }
+
+        // Polling - polled objects are compared every replication interval even when nothing marks them dirty.
+        // Everything else is push-model: it costs nothing per tick until a setter marks a property dirty.
+        void SetPolled(bool bPolled) { m_bPolled = bPolled; }
+        bool IsPolled() const { return m_bPolled; }
+
+        // Per-property dirty tracking - MarkDirty marks every property
+        void MarkPropertyDirty(int32 Index);
+        void MarkPropertyDirty(const FString& PropertyName);
+        bool IsPropertyDirty(int32 Index) const;
+
+        // Per-connection shadow state - the last serialized value sent to each connection, one per property
+        TArray<FBitWriter>& FindOrAddShadowState(int32 ConnectionID);
+        TArray<FBitWriter>* FindShadowState(int32 ConnectionID) { return m_ShadowStates.Find(ConnectionID); }
+        bool HasShadowState(int32 ConnectionID) const { return m_ShadowStates.Contains(ConnectionID); }
+        void RemoveShadowState(int32 ConnectionID) { m_ShadowStates.Remove(ConnectionID); m_StaleShadows.Remove(ConnectionID); }
+        void MarkShadowStale(int32 ConnectionID) { if (HasShadowState(ConnectionID)) m_StaleShadows.Add(ConnectionID); }
+        bool ConsumeShadowStale(int32 ConnectionID) { return m_StaleShadows.Remove(ConnectionID); }
+        int32 GetShadowStateCount() const { return m_ShadowStates.Num(); }
+        bool HasLostShadowMerge(int32 Index) const { return static_cast<bool>(m_Properties[Index].MergeLostShadow); }
+        
+        // A packet carrying this property was lost - SentAgainst is the shadow its delta was written against
+        void RollbackShadow(int32 ConnectionID, int32 Index, const FBitWriter& SentAgainst);
+        TArray<int32> GetShadowConnections() const { return m_ShadowStates.GetKeys(); }
 
         // Replication helpers
         void MarkDirty();
@@ -116,6 +241,8 @@ namespace UE4SDK
         void ResetReplication();
 
     private:
+        friend class ReplicationManager;
+
         EReplicationType m_ReplicationType;
         EReplicationCondition m_ReplicationCondition;
         ENetRole m_NetRole;
@@ -131,8 +258,39 @@ namespace UE4SDK
         FString m_ReplicationData;
         int32 m_ReplicationSize;
         
+        TArray<ReplicatedProperty> m_Properties;
+        TArray<uint32> m_DirtyBits;
+        TMap<int32, TArray<FBitWriter>> m_ShadowStates;
+        TSet<int32> m_StaleShadows; // Connections that missed a dirty update and need a full compare
+        TArray<FBitWriter> m_SerializedValues;
+        TArray<uint32> m_SerializedFrames;
+        
+        std::function<FVector()> m_NetLocationGetter;
+        FVector m_NetLocation;
+        float m_NetCullDistance;
+        float m_NetPriority;
+        bool m_bAlwaysRelevant;
+        int32 m_OwnerConnection;
+        ENetDormancy m_NetDormancy;
+        bool m_bDormancyFlushPending;
+        
         std::function<void()> m_OnReplicationCallback;
         std::function<void(const FString&)> m_OnReplicationReceivedCallback;
+        
+        // Push-model bookkeeping, owned by the registering ReplicationManager
+        std::function<void()> m_OnBecameDirty;
+        bool m_bPolled;
+        bool m_bScheduled;
+        bool m_bReady;
+    };
+
+    // One property carried by an unreliable replication packet. Base is the shadow it was diffed against,
+    // only kept for properties with SerializeDelta.
+    struct NetSentProperty
+    {
+        UObject* Object = nullptr;
+        int32 Index = 0;
+        FBitWriter Base;
     };
 
     // Replication manager - manages replication for objects
@@ -148,6 +306,18 @@ namespace UE4SDK
         bool IsObjectRegistered(UObject* Object) const;
         ReplicationInfo* GetReplicationInfo(UObject* Object) const;
 
+        // Property replication - a payload is one or more object deltas, sent through the network manager
+        void SetNetworkManager(NetworkManager* Manager) { m_NetworkManager = Manager; }
+        NetworkManager* GetNetworkManager() const { return m_NetworkManager; }
+        void MarkPropertyDirty(UObject* Object, const FString& PropertyName);
+        int32 ReplicateObjectToConnection(UObject* Object, int32 ConnectionID);
+        int32 WriteObjectDelta(UObject* Object, int32 ConnectionID, FBitWriter& Writer);
+        bool ReceiveReplication(const TArray<uint8>& Payload);
+        UObject* FindObjectByID(uint32 ObjectID) const;
+
+        // Relevancy filter - connections it rejects are skipped and get a full compare once relevant again
+        void SetRelevancyFilter(std::function<bool(UObject*, ReplicationInfo*, int32)> Filter) { m_RelevancyFilter = Filter; }
+
         // Replication processing
         void ProcessReplication(float DeltaTime);
         void ReplicateObject(UObject* Object);
@@ -188,10 +358,68 @@ namespace UE4SDK
         void CleanupReplication();
         void ResetReplication();
 
+        // Push-model processing - ready objects are dirty (or polled) and past their replication interval.
+        // ProcessReplication does both steps; ServerReplication collects, sends on its own schedule, then finishes.
+        void CollectReadyObjects(float DeltaTime, TArray<UObject*>& OutReady);
+        void FinishObjectReplication(UObject* Object);
+        float GetReplicationTime() const { return m_ReplicationTime; }
+        int32 GetScheduledObjectCount() const { return m_ScheduledCount; }
+
+        // Shared serialization - a new frame invalidates every cached property value.
+        // CollectReadyObjects starts one per tick; explicit sends outside the tick start their own.
+        uint32 BeginSerializationFrame() { return ++m_SerializationFrame; }
+        uint32 GetSerializationFrame() const { return m_SerializationFrame; }
+        void SerializeObjectState(UObject* Object);
+
+        // Writes a delta from the cached values against Shadow and updates it, recording what was sent in OutSent
+        // if given. Touches nothing but its arguments, so connections can build packets in parallel once
+        // SerializeObjectState has run for the frame.
+        static int32 WriteCachedDelta(UObject* Object, const ReplicationInfo* Info, TArray<FBitWriter>& Shadow, TArray<int32>& ChangedScratch, FBitWriter& Writer, TArray<NetSentProperty>* OutSent = nullptr);
+
+        // Loss recovery - shadows are updated as packets are written, so an unreliable packet's properties are
+        // remembered until the transport reports on its receipt. A lost packet rolls those shadow entries back and
+        // marks the properties dirty, so the current values go out again. Wire OnPacketDelivery to the network
+        // manager's packet delivery callback.
+        uint32 TrackSentPacket(int32 ConnectionID, TArray<NetSentProperty>&& Properties);
+        void OnPacketDelivery(int32 ConnectionID, uint32 Receipt, bool bDelivered);
+        int32 GetTrackedPacketCount() const { return m_SentPackets.Num(); }
+
     private:
         TMap<UObject*, ReplicationInfo*> m_ReplicationInfo;
         TArray<UObject*> m_ReplicatedObjects;
         TArray<UObject*> m_DirtyObjects;
+        TMap<uint32, UObject*> m_ObjectsByID;
+        NetworkManager* m_NetworkManager;
+        FBitWriter m_PayloadWriter;
+        TArray<int32> m_ChangedScratch;
+        uint32 m_SerializationFrame;
+        
+        // Unreliable packets waiting on the transport, by receipt
+        struct SentPacket
+        {
+            int32 ConnectionID;
+            TArray<NetSentProperty> Properties;
+        };
+        
+        TMap<uint32, SentPacket> m_SentPackets;
+        TArray<NetSentProperty> m_SentScratch;
+        uint32 m_NextReceipt;
+        
+        // Timing wheel of replication-interval timers - Rounds counts full turns still to wait
+        struct TimerEntry
+        {
+            UObject* Object;
+            uint32 Rounds;
+        };
+        
+        TArray<TArray<TimerEntry>> m_TimerWheel;
+        int32 m_WheelCursor;
+        float m_WheelAccumulator;
+        float m_WheelResolution;
+        int32 m_ScheduledCount;
+        float m_ReplicationTime;
+        TArray<UObject*> m_ReadyScratch;
+        TArray<UObject*> m_DueScratch;
         
         float m_GlobalReplicationFrequency;
         int32 m_MaxReplicationSize;
@@ -199,12 +427,29 @@ namespace UE4SDK
         
         std::function<void(UObject*)> m_OnObjectReplicatedCallback;
         std::function<void(UObject*, const FString&)> m_OnReplicationErrorCallback;
+        std::function<bool(UObject*, ReplicationInfo*, int32)> m_RelevancyFilter;
         
         // Helper functions
         void AddToDirtyList(UObject* Object);
         void RemoveFromDirtyList(UObject* Object);
-        bool ShouldReplicateObject(UObject* Object, float CurrentTime) const;
         void ProcessObjectReplication(UObject* Object);
+        void QueueReadyObject(UObject* Object, ReplicationInfo* Info, TArray<UObject*>& OutReady);
+        void ScheduleObject(UObject* Object, ReplicationInfo* Info, float Delay);
+        void AdvanceTimerWheel(float DeltaTime, TArray<UObject*>& OutDue);
+        void ClearTimerWheel();
+        int32 WritePropertyDelta(UObject* Object, ReplicationInfo* Info, int32 ConnectionID, bool bDirtyOnly, FBitWriter& Writer);
+        uint32 TrackWrittenDelta(int32 ConnectionID);
+        bool ReadObjectDelta(FBitReader& Reader);
+        void PruneShadowStates(ReplicationInfo* Info, const TArray<int32>& Connections);
+    };
+
+    // Outgoing packet - buffers are shared, so one payload can go to many connections without a copy each
+    struct NetOutgoingPacket
+    {
+        int32 ConnectionID;
+        NetPacketBuffer Data;
+        bool bReliable = false; // Resent until acked, for EReplicationType::Reliable actors
+        uint32 Receipt = 0;     // Unreliable only - non-zero is reported through the packet delivery callback
     };
 
     // Network manager - manages network connections and replication
@@ -240,22 +485,40 @@ namespace UE4SDK
         void SetIsClient(bool bIsClient) { m_bIsClient = bIsClient; }
         bool IsClient() const { return m_bIsClient; }
 
+        // UDP transport - a server listens on the server port, a client connects to the server
+        // address as connection 0. Without it running, sends are only accounted for.
+        bool StartNetwork();
+        void StopNetwork();
+        bool IsNetworkRunning() const { return m_Transport && m_Transport->IsOpen(); }
+        void ReceiveNetwork(); // Dispatches everything waiting on the socket to the callbacks
+        void FlushNetwork();   // Writes this tick's queued packets in one batch
+        NetTransport* GetTransport() const { return m_Transport.get(); }
+
         // Network communication
         void SendData(int32 ConnectionID, const FString& Data);
+        void SendData(int32 ConnectionID, const TArray<uint8>& Data, bool bReliable = false, uint32 Receipt = 0); // Replication channel
         void SendDataToAll(const FString& Data);
+        void SendDataToAll(const TArray<uint8>& Data);
+        void SendDataToAll(const NetPacketBuffer& Data);
+        void SendPackets(TArray<NetOutgoingPacket>& Packets); // Hands every buffer off in one batch and empties Packets
         void SendDataToAllExcept(int32 ExcludeConnectionID, const FString& Data);
         void BroadcastData(const FString& Data);
 
         // Network statistics
         int32 GetConnectionCount() const;
-        int32 GetTotalBytesSent() const;
-        int32 GetTotalBytesReceived() const;
-        float GetNetworkLatency(int32 ConnectionID) const;
+        int64 GetTotalBytesSent() const;
+        int64 GetTotalBytesReceived() const;
+        float GetNetworkLatency(int32 ConnectionID) const; // Smoothed round trip, seconds
+        float GetNetworkJitter(int32 ConnectionID) const;
+        float GetPacketLoss(int32 ConnectionID) const;
+        int32 GetConnectionSendRate(int32 ConnectionID) const; // Bytes per second congestion control allows, 0 if unknown
 
         // Network callbacks
         void SetOnConnectionCallback(std::function<void(int32)> Callback) { m_OnConnectionCallback = Callback; }
         void SetOnDisconnectionCallback(std::function<void(int32)> Callback) { m_OnDisconnectionCallback = Callback; }
         void SetOnDataReceivedCallback(std::function<void(int32, const FString&)> Callback) { m_OnDataReceivedCallback = Callback; }
+        void SetOnPacketReceivedCallback(std::function<void(int32, const TArray<uint8>&)> Callback) { m_OnPacketReceivedCallback = Callback; }
+        void SetOnPacketDeliveryCallback(std::function<void(int32, uint32, bool)> Callback) { m_OnPacketDeliveryCallback = Callback; } // Connection, receipt, delivered
 
         // Network validation
         bool ValidateConnection(int32 ConnectionID) const;
@@ -275,12 +538,35 @@ namespace UE4SDK
         bool m_bIsServer;
         bool m_bIsClient;
         
-        int32 m_TotalBytesSent;
-        int32 m_TotalBytesReceived;
+        int64 m_TotalBytesSent;
+        int64 m_TotalBytesReceived;
         
         std::function<void(int32)> m_OnConnectionCallback;
         std::function<void(int32)> m_OnDisconnectionCallback;
         std::function<void(int32, const FString&)> m_OnDataReceivedCallback;
+        std::function<void(int32, const TArray<uint8>&)> m_OnPacketReceivedCallback;
+        std::function<void(int32, uint32, bool)> m_OnPacketDeliveryCallback;
+        
+        std::unique_ptr<NetTransport> m_Transport;
+        int32 m_NextConnectionID;
+        TArray<uint8> m_ReceiveScratch;
+        
+        // Helper functions
+        void OnTransportMessage(int32 ConnectionID, uint8 Channel, const uint8* Data, int32 Size);
+        int32 OnUnknownPeer(const NetAddress& Address);
+    };
+
+    // Per-connection replication stats - Saturation is last tick's bytes over its budget
+    struct NetConnectionStats
+    {
+        int32 BytesBudget = 0;
+        int32 BytesSentLastTick = 0;
+        float Saturation = 0.0f;
+        int32 SaturatedTicks = 0;
+        int32 TotalTicks = 0;
+        int32 ActorsSentLastTick = 0;
+        int32 ActorsDeferredLastTick = 0;
+        int32 MaxStarvation = 0;
     };
 
     // Server replication - handles server-side replication
@@ -291,7 +577,7 @@ namespace UE4SDK
         virtual ~ServerReplication() = default;
 
         // Server replication management
-        void SetReplicationManager(ReplicationManager* Manager) { m_ReplicationManager = Manager; }
+        void SetReplicationManager(ReplicationManager* Manager);
         ReplicationManager* GetReplicationManager() const { return m_ReplicationManager; }
         
         void SetNetworkManager(NetworkManager* Manager) { m_NetworkManager = Manager; }
@@ -313,6 +599,26 @@ namespace UE4SDK
         void SetReplicationBudget(float Budget) { m_ReplicationBudget = Budget; }
         float GetReplicationBudget() const { return m_ReplicationBudget; }
 
+        // Relevancy - per-connection interest sets, refreshed by UpdateRelevancy
+        NetRelevancy& GetRelevancy() { return m_Relevancy; }
+        const NetRelevancy& GetRelevancy() const { return m_Relevancy; }
+        void SetConnectionView(int32 ClientID, const NetConnectionView& View) { m_Relevancy.SetConnectionView(ClientID, View); }
+        void UpdateRelevancy();
+        bool IsActorRelevantTo(UObject* Actor, int32 ClientID) const;
+
+        // Scheduling - priority combines base priority, distance, view direction, time since last send and starvation
+        void SetClassNetPriority(UClass* Class, float Priority) { m_ClassPriorities.Add(Class, Priority); }
+        void SetConnectionBandwidth(int32 BytesPerSecond) { m_BytesPerSecond = BytesPerSecond; }
+        int32 GetConnectionBandwidth() const { return m_BytesPerSecond; }
+        void SetClientBandwidth(int32 ClientID, int32 BytesPerSecond) { m_Schedules.FindOrAdd(ClientID).BytesPerSecond = BytesPerSecond; }
+        void SetStarvationWeight(float Weight) { m_StarvationWeight = Weight; }
+        float GetStarvationWeight() const { return m_StarvationWeight; }
+        float CalculateActorPriority(UObject* Actor, int32 ClientID) const;
+
+        // Per-connection stats
+        const NetConnectionStats* GetConnectionStats(int32 ClientID) const;
+        float GetConnectionSaturation(int32 ClientID) const;
+
         // Server replication processing
         void ProcessServerReplication(float DeltaTime);
         void UpdateReplicationPriorities();
@@ -326,8 +632,8 @@ namespace UE4SDK
 
         // Server replication statistics
         int32 GetReplicatedActorsCount() const;
-        int32 GetTotalReplicationSize() const;
-        float GetAverageReplicationTime() const;
+        int64 GetTotalReplicationSize() const;
+        float GetAverageReplicationTime() const; // Smoothed ProcessServerReplication time, seconds
         int32 GetReplicationErrors() const;
 
         // Server replication callbacks
@@ -353,12 +659,70 @@ namespace UE4SDK
         
         TArray<UObject*> m_ReplicationQueue;
         TMap<UObject*, float> m_ReplicationPriorities;
+        NetRelevancy m_Relevancy;
         
         int32 m_ReplicatedActorsCount;
-        int32 m_TotalReplicationSize;
+        int64 m_TotalReplicationSize;
         float m_AverageReplicationTime;
         int32 m_ReplicationErrors;
         
+        // Scheduling state
+        struct ActorSendState
+        {
+            float LastSendTime = 0.0f;
+            int32 Starvation = 0;
+            uint32 LastTick = 0;
+        };
+        
+        struct PrioritizedActor
+        {
+            UObject* Actor;
+            float Priority;
+        };
+        
+        // An actor picked for this tick's packet - Shadow is null until the client has been sent it once
+        struct PacketEntry
+        {
+            UObject* Actor;
+            ReplicationInfo* Info;
+            TArray<FBitWriter>* Shadow;
+            TArray<FBitWriter> NewShadow;
+            bool bProcessed;
+            bool bWritten;
+        };
+        
+        struct ConnectionSchedule
+        {
+            std::unordered_map<UObject*, ActorSendState> Actors;
+            std::unordered_set<UObject*> Pending; // Relevant actors this client may be behind on
+            int32 BytesPerSecond = 0; // 0 uses the shared connection bandwidth
+            float BudgetCarry = 0.0f;
+            NetConnectionStats Stats;
+            
+            // Per-tick build state, only touched by whichever worker is building this connection's packet
+            TArray<PrioritizedActor> Candidates;
+            TArray<PacketEntry> Entries;
+            TArray<int32> ChangedScratch;
+            TArray<NetSentProperty> SentProperties; // What PacketWriter carries, for loss recovery
+            FBitWriter PacketWriter;
+            FBitWriter ReliablePacketWriter; // Reliable actors go in their own packet, resent until acked
+            float BytesPerTick = 0.0f;
+            float Budget = 0.0f;
+            int32 ActorsDeferred = 0;
+            int32 MaxStarvation = 0;
+        };
+        
+        TMap<int32, ConnectionSchedule> m_Schedules;
+        TMap<UClass*, float> m_ClassPriorities;
+        TArray<UObject*> m_ReadyObjects;
+        TArray<int32> m_BuildConnections;
+        TArray<ConnectionSchedule*> m_BuildSchedules;
+        TArray<NetOutgoingPacket> m_OutgoingPackets;
+        int32 m_BytesPerSecond;
+        float m_StarvationWeight;
+        float m_ElapsedTime;
+        uint32 m_TickCount;
+        
         std::function<void(UObject*, int32)> m_OnActorReplicatedCallback;
         std::function<void(UObject*, const FString&)> m_OnReplicationErrorCallback;
         
@@ -368,6 +732,12 @@ namespace UE4SDK
         void CalculateReplicationPriority(UObject* Actor);
         bool ShouldReplicateActor(UObject* Actor) const;
         void ProcessActorReplication(UObject* Actor);
+        void ReplicateToConnections(const TArray<int32>& Connections, float DeltaTime);
+        void SelectPacketEntries(int32 ClientID, ConnectionSchedule& Schedule, float DeltaTime);
+        void AssemblePacket(ConnectionSchedule& Schedule);
+        void FinishPacket(int32 ClientID, ConnectionSchedule& Schedule);
+        float CalculateConnectionPriority(UObject* Actor, ReplicationInfo* Info, int32 ClientID, const ActorSendState* State) const;
+        void PruneSchedules(const TArray<int32>& Connections);
     };
 
     // Replication system - global replication management
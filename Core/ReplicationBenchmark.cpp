@@ -0,0 +1,648 @@
+/*
+ * UE4 Replication Benchmark Implementation - Self-contained loopback replication load harness implementation
+ * Vibe coder approved ✨
+ */
+
+#include "ReplicationBenchmark.h"
+#include "Utils.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        constexpr int32 LocationProperty = 0;
+        constexpr int32 RevisionProperty = 1;
+
+        BenchmarkDistribution Summarize(TArray<float>& Samples)
+        {
+            BenchmarkDistribution Result;
+            Result.Samples = Samples.Num();
+            if (Samples.Num() == 0)
+            {
+                return Result;
+            }
+
+            std::sort(Samples.begin(), Samples.end());
+            double Sum = 0.0;
+            for (float Sample : Samples)
+            {
+                Sum += Sample;
+            }
+
+            Result.Average = static_cast<float>(Sum / Samples.Num());
+            Result.P50 = Samples[Samples.Num() / 2];
+            Result.P95 = Samples[std::min(Samples.Num() - 1, Samples.Num() * 95 / 100)];
+            Result.Max = Samples[Samples.Num() - 1];
+            return Result;
+        }
+
+        const char* MovementName(EBenchmarkMovement Movement)
+        {
+            switch (Movement)
+            {
+                case EBenchmarkMovement::Static: return "static";
+                case EBenchmarkMovement::Linear: return "linear";
+                case EBenchmarkMovement::Circle: return "circle";
+                case EBenchmarkMovement::RandomWalk: return "random_walk";
+                case EBenchmarkMovement::Mixed: return "mixed";
+            }
+            return "unknown";
+        }
+
+        // Minimal JSON writer - keys are appended in call order, numbers use fixed precision
+        class JsonWriter
+        {
+        public:
+            void BeginObject(const char* Key = nullptr) { Separator(); WriteKey(Key); m_Json += '{'; m_bFirst = true; }
+            void EndObject() { m_Json += '}'; m_bFirst = false; }
+
+            void Write(const char* Key, int32 Value) { Separator(); WriteKey(Key); m_Json += std::to_string(Value); }
+            void Write(const char* Key, const char* Value) { Separator(); WriteKey(Key); m_Json += '"'; m_Json += Value; m_Json += '"'; }
+
+            void Write(const char* Key, float Value)
+            {
+                char Buffer[32];
+                std::snprintf(Buffer, sizeof(Buffer), "%.3f", std::isfinite(Value) ? Value : 0.0f);
+                Separator();
+                WriteKey(Key);
+                m_Json += Buffer;
+            }
+
+            void Write(const char* Key, const BenchmarkDistribution& Value)
+            {
+                BeginObject(Key);
+                Write("samples", Value.Samples);
+                Write("avg", Value.Average);
+                Write("p50", Value.P50);
+                Write("p95", Value.P95);
+                Write("max", Value.Max);
+                EndObject();
+            }
+
+            const std::string& GetJson() const { return m_Json; }
+
+        private:
+            std::string m_Json;
+            bool m_bFirst = true;
+
+            void Separator() { if (!m_bFirst) m_Json += ','; m_bFirst = false; }
+            void WriteKey(const char* Key) { if (Key) { m_Json += '"'; m_Json += Key; m_Json += "\":"; } }
+        };
+    }
+
+    // ReplicationBenchmarkResults implementation
+    FString ReplicationBenchmarkResults::ToJson() const
+    {
+        JsonWriter Json;
+        Json.BeginObject();
+
+        Json.BeginObject("settings");
+        Json.Write("clients", Settings.ClientCount);
+        Json.Write("actors", Settings.ActorCount);
+        Json.Write("duration_sec", Settings.Duration);
+        Json.Write("tick_rate", Settings.TickRate);
+        Json.Write("movement", MovementName(Settings.Movement));
+        Json.Write("moving_fraction", Settings.MovingFraction);
+        Json.Write("reliable_fraction", Settings.ReliableFraction);
+        Json.Write("actor_net_frequency", Settings.ActorNetFrequency);
+        Json.Write("net_cull_distance", Settings.NetCullDistance);
+        Json.Write("world_size", Settings.WorldSize);
+        Json.Write("bytes_per_second", Settings.BytesPerSecond);
+        Json.Write("packet_loss", Settings.Network.PacketLoss);
+        Json.Write("latency_ms", Settings.Network.Latency * 1000.0f);
+        Json.Write("jitter_ms", Settings.Network.Jitter * 1000.0f);
+        Json.Write("reorder", Settings.Network.Reorder);
+        Json.Write("duplicate", Settings.Network.Duplicate);
+        Json.Write("seed", static_cast<int32>(Settings.Seed));
+        Json.EndObject();
+
+        Json.Write("connected_clients", ConnectedClients);
+        Json.Write("ticks", Ticks);
+        Json.Write("measured_sec", MeasuredSeconds);
+
+        Json.BeginObject("bandwidth");
+        Json.Write("replication_bytes_per_client_per_sec", ReplicationBytesPerClientPerSecond);
+        Json.Write("max_client_bytes_per_sec", MaxClientBytesPerSecond);
+        Json.Write("wire_bytes_per_client_per_sec", WireBytesPerClientPerSecond);
+        Json.EndObject();
+
+        Json.Write("tick_cpu_ms", TickTime);
+
+        Json.BeginObject("scheduling");
+        Json.Write("max_starvation", MaxStarvation);
+        Json.Write("avg_starvation", AverageStarvation);
+        Json.Write("avg_actors_deferred", AverageActorsDeferred);
+        Json.Write("avg_saturation", AverageSaturation);
+        Json.EndObject();
+
+        Json.BeginObject("convergence");
+        Json.Write("latency_ms", Latency);
+        Json.Write("settle_time_sec", SettleTime);
+        Json.Write("converged_fraction", ConvergedFraction);
+        Json.EndObject();
+
+        Json.BeginObject("transport");
+        Json.Write("avg_rtt_ms", AverageRoundTripMs);
+        Json.Write("avg_packet_loss", AveragePacketLoss);
+        Json.Write("reliable_resends", ReliableResends);
+        Json.EndObject();
+
+        Json.EndObject();
+        return FString(Json.GetJson());
+    }
+
+    bool ReplicationBenchmarkResults::SaveToFile(const FString& FilePath) const
+    {
+        return Utils::SaveStringToFile(ToJson(), FilePath);
+    }
+
+    // ReplicationBenchmark implementation
+    ReplicationBenchmark::ReplicationBenchmark()
+        : m_StartTime(0.0)
+        , m_Tick(0)
+    {
+    }
+
+    ReplicationBenchmark::~ReplicationBenchmark()
+    {
+        Teardown();
+    }
+
+    ReplicationBenchmarkResults ReplicationBenchmark::Run()
+    {
+        ReplicationBenchmarkResults Results;
+        Results.Settings = m_Settings;
+
+        if (!Setup())
+        {
+            Teardown();
+            return Results;
+        }
+
+        for (const auto& Client : m_Clients)
+        {
+            if (Client->ServerConnectionID >= 0)
+            {
+                Results.ConnectedClients++;
+            }
+        }
+
+        float DeltaTime = 1.0f / std::max(m_Settings.TickRate, 1.0f);
+        int32 MeasuredTicks = static_cast<int32>(m_Settings.Duration * m_Settings.TickRate);
+        int32 SettleTicks = static_cast<int32>(m_Settings.SettleTime * m_Settings.TickRate);
+        int64 WireBytesAtStart = m_ServerNetwork->GetTransport()->GetTotalBytesSent();
+        int64 WireBytesMeasured = 0;
+
+        TArray<float> TickTimes;
+        TickTimes.Reserve(MeasuredTicks);
+        double StarvationSum = 0.0;
+        double DeferredSum = 0.0;
+        double SaturationSum = 0.0;
+        int32 SaturationSamples = 0;
+
+        m_StartTime = GetTime();
+        m_RevisionTimes.Empty();
+        m_RevisionTimes.Add(m_StartTime);
+        m_LatencySamples.Empty();
+
+        for (int32 i = 0; i < MeasuredTicks + SettleTicks; ++i)
+        {
+            bool bMeasured = i < MeasuredTicks;
+            double TickStart = m_StartTime + i * static_cast<double>(DeltaTime);
+            m_Tick = static_cast<uint32>(i + 1);
+            m_RevisionTimes.Add(TickStart);
+
+            if (bMeasured)
+            {
+                MoveActors(DeltaTime);
+            }
+
+            // Server tick - everything the server does for replication, socket flush included
+            double WorkStart = GetTime();
+            m_ServerNetwork->ReceiveNetwork();
+            m_ServerReplication->ProcessServerReplication(DeltaTime);
+            m_ServerNetwork->FlushNetwork();
+            float WorkMs = static_cast<float>((GetTime() - WorkStart) * 1000.0);
+
+            if (bMeasured)
+            {
+                TickTimes.Add(WorkMs);
+
+                int32 WorstStarvation = 0;
+                for (const auto& Client : m_Clients)
+                {
+                    const NetConnectionStats* Stats = m_ServerReplication->GetConnectionStats(Client->ServerConnectionID);
+                    if (!Stats)
+                    {
+                        continue;
+                    }
+
+                    Client->BytesSent += Stats->BytesSentLastTick;
+                    WorstStarvation = std::max(WorstStarvation, Stats->MaxStarvation);
+                    DeferredSum += Stats->ActorsDeferredLastTick;
+                    SaturationSum += Stats->Saturation;
+                    SaturationSamples++;
+                }
+                Results.MaxStarvation = std::max(Results.MaxStarvation, WorstStarvation);
+                StarvationSum += WorstStarvation;
+            }
+
+            TickClients();
+
+            // Movement has stopped - done as soon as every client has the server's state
+            if (!bMeasured && Results.SettleTime < 0.0f && GetConvergedFraction() >= 1.0f)
+            {
+                Results.SettleTime = static_cast<float>(i - MeasuredTicks + 1) * DeltaTime;
+                break;
+            }
+
+            // Real time pacing, a tick that ran long just starts the next one late
+            double Wait = TickStart + DeltaTime - GetTime();
+            if (Wait > 0.0)
+            {
+                Utils::Sleep(static_cast<float>(Wait));
+            }
+
+            if (bMeasured)
+            {
+                Results.Ticks++;
+                WireBytesMeasured = m_ServerNetwork->GetTransport()->GetTotalBytesSent() - WireBytesAtStart;
+            }
+        }
+
+        // Results
+        float Seconds = Results.Ticks * DeltaTime;
+        Results.MeasuredSeconds = Seconds;
+        int32 ClientCount = std::max(Results.ConnectedClients, 1);
+        if (Seconds > 0.0f)
+        {
+            double TotalBytes = 0.0;
+            for (const auto& Client : m_Clients)
+            {
+                TotalBytes += Client->BytesSent;
+                Results.MaxClientBytesPerSecond = std::max(Results.MaxClientBytesPerSecond, static_cast<float>(Client->BytesSent / Seconds));
+            }
+            Results.ReplicationBytesPerClientPerSecond = static_cast<float>(TotalBytes / Seconds / ClientCount);
+            Results.WireBytesPerClientPerSecond = static_cast<float>(WireBytesMeasured / Seconds / ClientCount);
+        }
+
+        Results.TickTime = Summarize(TickTimes);
+        Results.Latency = Summarize(m_LatencySamples);
+        Results.AverageStarvation = Results.Ticks > 0 ? static_cast<float>(StarvationSum / Results.Ticks) : 0.0f;
+        Results.AverageActorsDeferred = Results.Ticks > 0 ? static_cast<float>(DeferredSum / Results.Ticks / ClientCount) : 0.0f;
+        Results.AverageSaturation = SaturationSamples > 0 ? static_cast<float>(SaturationSum / SaturationSamples) : 0.0f;
+        Results.ConvergedFraction = GetConvergedFraction();
+
+        for (const auto& Client : m_Clients)
+        {
+            const NetTransportStats* Stats = m_ServerNetwork->GetTransport()->GetStats(Client->ServerConnectionID);
+            if (Stats)
+            {
+                Results.AverageRoundTripMs += Stats->RoundTripTime * 1000.0f / ClientCount;
+                Results.AveragePacketLoss += Stats->PacketLoss / ClientCount;
+                Results.ReliableResends += Stats->ReliableResends;
+            }
+        }
+
+        Teardown();
+        return Results;
+    }
+
+    double ReplicationBenchmark::GetTime() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    bool ReplicationBenchmark::Setup()
+    {
+        Teardown();
+
+        // Server, clients and actors all count as replication memory in the report
+        MEMORY_TAG_SCOPE(Replication);
+
+        m_ServerNetwork = std::make_unique<NetworkManager>();
+        m_ServerNetwork->SetIsServer(true);
+        m_ServerNetwork->SetNetMode(ENetMode::DedicatedServer);
+        m_ServerNetwork->SetServerPort(0);
+        m_ServerNetwork->SetMaxConnections(m_Settings.ClientCount);
+        if (!m_ServerNetwork->StartNetwork())
+        {
+            Utils::Get().LogError(TEXT("ReplicationBenchmark - Failed to start server"));
+            return false;
+        }
+
+        NetSimulationSettings ServerSimulation = m_Settings.Network;
+        ServerSimulation.Seed = m_Settings.Seed;
+        m_ServerNetwork->GetTransport()->SetSimulation(ServerSimulation);
+
+        m_ServerReplicationManager = std::make_unique<ReplicationManager>();
+        m_ServerReplicationManager->SetNetworkManager(m_ServerNetwork.get());
+        ReplicationManager* ServerManager = m_ServerReplicationManager.get();
+        m_ServerNetwork->SetOnPacketDeliveryCallback([ServerManager](int32 ConnectionID, uint32 Receipt, bool bDelivered)
+        {
+            ServerManager->OnPacketDelivery(ConnectionID, Receipt, bDelivered);
+        });
+
+        m_ServerReplication = std::make_unique<ServerReplication>();
+        m_ServerReplication->SetReplicationManager(m_ServerReplicationManager.get());
+        m_ServerReplication->SetNetworkManager(m_ServerNetwork.get());
+        m_ServerReplication->SetReplicationTickRate(m_Settings.TickRate);
+        if (m_Settings.BytesPerSecond > 0)
+        {
+            m_ServerReplication->SetConnectionBandwidth(m_Settings.BytesPerSecond);
+        }
+        if (m_Settings.MaxReplicationPerTick > 0)
+        {
+            m_ServerReplication->SetMaxReplicationPerTick(m_Settings.MaxReplicationPerTick);
+        }
+
+        CreateActors();
+        CreateClients();
+        return ConnectClients();
+    }
+
+    void ReplicationBenchmark::Teardown()
+    {
+        for (const auto& Client : m_Clients)
+        {
+            Client->Network->ShutdownNetwork();
+            Client->Replication->CleanupReplication();
+        }
+        m_Clients.Empty();
+        m_ClientsByPort.Empty();
+
+        if (m_ServerNetwork)
+        {
+            m_ServerNetwork->ShutdownNetwork();
+        }
+        if (m_ServerReplicationManager)
+        {
+            m_ServerReplicationManager->CleanupReplication();
+        }
+
+        m_ServerReplication.reset();
+        m_ServerReplicationManager.reset();
+        m_ServerNetwork.reset();
+        m_Actors.Empty();
+        m_ActorIndices.Empty();
+    }
+
+    void ReplicationBenchmark::CreateActors()
+    {
+        std::mt19937 Random(m_Settings.Seed);
+        std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+        float HalfWorld = m_Settings.WorldSize * 0.5f;
+        int32 MovingCount = static_cast<int32>(m_Settings.ActorCount * m_Settings.MovingFraction);
+        int32 ReliableCount = static_cast<int32>(m_Settings.ActorCount * m_Settings.ReliableFraction);
+
+        // Properties point into the actors, so the array must never reallocate
+        m_Actors.Reserve(m_Settings.ActorCount);
+        for (int32 i = 0; i < m_Settings.ActorCount; ++i)
+        {
+            BenchmarkActor& Actor = m_Actors.Emplace();
+            Actor.Object = std::make_unique<UObject>();
+            Actor.Object->SetName(TEXT("BenchmarkActor_") + FString::FromInt(i));
+            Actor.Location = FVector((Unit(Random) * 2.0f - 1.0f) * HalfWorld, (Unit(Random) * 2.0f - 1.0f) * HalfWorld, 0.0f);
+            Actor.Origin = Actor.Location;
+            Actor.Phase = Unit(Random) * 6.2831853f;
+
+            float Heading = Unit(Random) * 6.2831853f;
+            Actor.Velocity = FVector(std::cos(Heading), std::sin(Heading), 0.0f) * m_Settings.ActorSpeed;
+
+            if (i < MovingCount)
+            {
+                Actor.Movement = m_Settings.Movement != EBenchmarkMovement::Mixed
+                    ? m_Settings.Movement
+                    : static_cast<EBenchmarkMovement>(1 + i % 3);
+            }
+
+            Actor.Info = std::make_unique<ReplicationInfo>();
+            ReplicationInfo& Info = *Actor.Info;
+            Info.SetReplicated(true);
+            Info.SetReplicationType(i < ReliableCount ? EReplicationType::Reliable : EReplicationType::Unreliable);
+            Info.SetReplicationFrequency(m_Settings.ActorNetFrequency);
+            Info.SetNetCullDistance(m_Settings.NetCullDistance);
+            Info.AddReplicatedProperty(TEXT("Location"), &Actor.Location);
+            Info.AddReplicatedProperty(TEXT("Revision"), &Actor.Revision);
+
+            FVector* Location = &Actor.Location;
+            Info.SetNetLocationGetter([Location]() { return *Location; });
+            Info.MarkDirty();
+
+            m_ServerReplicationManager->RegisterObject(Actor.Object.get(), Actor.Info.get());
+            m_ActorIndices.Add(Actor.Object.get(), i);
+        }
+    }
+
+    void ReplicationBenchmark::CreateClients()
+    {
+        std::mt19937 Random(m_Settings.Seed + 1);
+        std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+        float HalfWorld = m_Settings.WorldSize * 0.5f;
+        int32 ServerPort = m_ServerNetwork->GetTransport()->GetLocalPort();
+
+        // The server assigns connection IDs as clients show up - match them back to clients by socket port
+        m_ServerNetwork->SetOnConnectionCallback([this](int32 ConnectionID)
+        {
+            const NetAddress* Address = m_ServerNetwork->GetTransport()->GetPeerAddress(ConnectionID);
+            const int32* ClientIndex = Address ? m_ClientsByPort.Find(Address->Port) : nullptr;
+            if (!ClientIndex)
+            {
+                return;
+            }
+
+            BenchmarkClient& Client = *m_Clients[*ClientIndex];
+            Client.ServerConnectionID = ConnectionID;
+            m_ServerReplication->SetConnectionView(ConnectionID, Client.View);
+        });
+
+        for (int32 ClientIndex = 0; ClientIndex < m_Settings.ClientCount; ++ClientIndex)
+        {
+            auto ClientPtr = std::make_unique<BenchmarkClient>();
+            BenchmarkClient& Client = *ClientPtr;
+            Client.View.Location = FVector((Unit(Random) * 2.0f - 1.0f) * HalfWorld, (Unit(Random) * 2.0f - 1.0f) * HalfWorld, 0.0f);
+            float Heading = Unit(Random) * 6.2831853f;
+            Client.View.Forward = FVector(std::cos(Heading), std::sin(Heading), 0.0f);
+
+            // Replicas mirror the server's actors under the same objects, so object IDs match on the wire
+            Client.Replication = std::make_unique<ReplicationManager>();
+            Client.Replicas.SetNum(m_Actors.Num());
+            Client.Infos.Reserve(m_Actors.Num());
+            for (int32 ActorIndex = 0; ActorIndex < m_Actors.Num(); ++ActorIndex)
+            {
+                ReplicaState& Replica = Client.Replicas[ActorIndex];
+                Client.Infos.Add(std::make_unique<ReplicationInfo>());
+                ReplicationInfo& Info = *Client.Infos[ActorIndex];
+                Info.AddReplicatedProperty(TEXT("Location"), &Replica.Location);
+                Info.AddReplicatedProperty(TEXT("Revision"), &Replica.Revision);
+
+                // Revision comes after Location, so by now the whole update has been applied
+                Info.SetOnReplicationReceivedCallback([this, &Replica](const FString& PropertyName)
+                {
+                    if (PropertyName == TEXT("Revision") && Replica.Revision < static_cast<uint32>(m_RevisionTimes.Num()))
+                    {
+                        m_LatencySamples.Add(static_cast<float>((GetTime() - m_RevisionTimes[Replica.Revision]) * 1000.0));
+                    }
+                });
+                Client.Replication->RegisterObject(m_Actors[ActorIndex].Object.get(), &Info);
+            }
+
+            Client.Network = std::make_unique<NetworkManager>();
+            Client.Network->SetIsClient(true);
+            Client.Network->SetNetMode(ENetMode::Client);
+            Client.Network->SetServerAddress(TEXT("127.0.0.1"));
+            Client.Network->SetServerPort(ServerPort);
+
+            ReplicationManager* Replication = Client.Replication.get();
+            Client.Network->SetOnPacketReceivedCallback([Replication](int32, const TArray<uint8>& Payload)
+            {
+                Replication->ReceiveReplication(Payload);
+            });
+
+            if (Client.Network->StartNetwork())
+            {
+                NetSimulationSettings ClientSimulation = m_Settings.Network;
+                ClientSimulation.Seed = m_Settings.Seed + 2 + ClientIndex;
+                Client.Network->GetTransport()->SetSimulation(ClientSimulation);
+                m_ClientsByPort.Add(Client.Network->GetTransport()->GetLocalPort(), ClientIndex);
+            }
+
+            m_Clients.Add(std::move(ClientPtr));
+        }
+    }
+
+    bool ReplicationBenchmark::ConnectClients()
+    {
+        // The first packet from a client is what makes the server accept it
+        for (const auto& Client : m_Clients)
+        {
+            if (Client->Network->IsNetworkRunning())
+            {
+                Client->Network->SendData(0, TEXT("Hello"));
+            }
+        }
+
+        double Deadline = GetTime() + m_Settings.ConnectTimeout;
+        while (GetTime() < Deadline)
+        {
+            TickClients();
+            m_ServerNetwork->ReceiveNetwork();
+            m_ServerNetwork->FlushNetwork();
+
+            bool bAllConnected = true;
+            for (const auto& Client : m_Clients)
+            {
+                bAllConnected &= Client->ServerConnectionID >= 0;
+            }
+            if (bAllConnected)
+            {
+                return true;
+            }
+
+            Utils::Sleep(0.005f);
+        }
+
+        Utils::Get().LogWarning(TEXT("ReplicationBenchmark - Not every client connected, running with the ones that did"));
+        return m_ServerNetwork->GetConnectionCount() > 0;
+    }
+
+    void ReplicationBenchmark::MoveActors(float DeltaTime)
+    {
+        std::mt19937 Random(m_Settings.Seed + m_Tick);
+        std::uniform_real_distribution<float> Turn(-0.3f, 0.3f);
+        float HalfWorld = m_Settings.WorldSize * 0.5f;
+
+        for (BenchmarkActor& Actor : m_Actors)
+        {
+            switch (Actor.Movement)
+            {
+                case EBenchmarkMovement::Static:
+                case EBenchmarkMovement::Mixed:
+                    continue;
+
+                case EBenchmarkMovement::Linear:
+                    Actor.Location = Actor.Location + Actor.Velocity * DeltaTime;
+                    break;
+
+                case EBenchmarkMovement::Circle:
+                {
+                    // One radian per second, so the radius matches ActorSpeed
+                    Actor.Phase += DeltaTime;
+                    Actor.Location = Actor.Origin + FVector(std::cos(Actor.Phase), std::sin(Actor.Phase), 0.0f) * m_Settings.ActorSpeed;
+                    break;
+                }
+
+                case EBenchmarkMovement::RandomWalk:
+                {
+                    float Angle = Turn(Random);
+                    float Cos = std::cos(Angle);
+                    float Sin = std::sin(Angle);
+                    Actor.Velocity = FVector(Actor.Velocity.X * Cos - Actor.Velocity.Y * Sin, Actor.Velocity.X * Sin + Actor.Velocity.Y * Cos, 0.0f);
+                    Actor.Location = Actor.Location + Actor.Velocity * DeltaTime;
+                    break;
+                }
+            }
+
+            // Bounce off the world bounds
+            if (std::fabs(Actor.Location.X) > HalfWorld)
+            {
+                Actor.Velocity.X = -Actor.Velocity.X;
+                Actor.Location.X = std::max(-HalfWorld, std::min(Actor.Location.X, HalfWorld));
+            }
+            if (std::fabs(Actor.Location.Y) > HalfWorld)
+            {
+                Actor.Velocity.Y = -Actor.Velocity.Y;
+                Actor.Location.Y = std::max(-HalfWorld, std::min(Actor.Location.Y, HalfWorld));
+            }
+
+            Actor.Revision = m_Tick;
+            Actor.Info->MarkPropertyDirty(LocationProperty);
+            Actor.Info->MarkPropertyDirty(RevisionProperty);
+        }
+    }
+
+    void ReplicationBenchmark::TickClients()
+    {
+        for (const auto& Client : m_Clients)
+        {
+            Client->Network->ReceiveNetwork();
+            Client->Network->FlushNetwork();
+        }
+    }
+
+    float ReplicationBenchmark::GetConvergedFraction() const
+    {
+        int32 Total = 0;
+        int32 Converged = 0;
+        for (const auto& Client : m_Clients)
+        {
+            if (Client->ServerConnectionID < 0)
+            {
+                continue;
+            }
+
+            for (UObject* Object : m_ServerReplication->GetRelevancy().GetRelevantActors(Client->ServerConnectionID))
+            {
+                const int32* ActorIndex = m_ActorIndices.Find(Object);
+                if (!ActorIndex)
+                {
+                    continue;
+                }
+
+                Total++;
+                if (Client->Replicas[*ActorIndex].Revision == m_Actors[*ActorIndex].Revision)
+                {
+                    Converged++;
+                }
+            }
+        }
+        return Total > 0 ? static_cast<float>(Converged) / Total : 1.0f;
+    }
+}
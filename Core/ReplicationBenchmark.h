@@ -0,0 +1,172 @@
+/*
+ * UE4 Replication Benchmark - Self-contained loopback replication load harness
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "Replication.h"
+#include <memory>
+
+namespace UE4SDK
+{
+    // How benchmark actors move - Mixed spreads moving actors evenly over the other patterns
+    enum class EBenchmarkMovement : uint8
+    {
+        Static = 0,
+        Linear = 1,     // Straight lines, bouncing off the world bounds
+        Circle = 2,     // Orbits around a fixed point
+        RandomWalk = 3, // Heading changes a little every tick
+        Mixed = 4
+    };
+
+    // Benchmark settings - network conditions apply in both directions
+    struct ReplicationBenchmarkSettings
+    {
+        int32 ClientCount = 16;
+        int32 ActorCount = 1000;
+        float Duration = 10.0f;       // Seconds of measured replication
+        float SettleTime = 3.0f;      // Seconds after movement stops to wait for every client to catch up
+        float ConnectTimeout = 2.0f;
+        float TickRate = 30.0f;
+
+        // Actors
+        EBenchmarkMovement Movement = EBenchmarkMovement::Mixed;
+        float MovingFraction = 0.5f;
+        float ActorSpeed = 600.0f;
+        float ActorNetFrequency = 30.0f;
+        float ReliableFraction = 0.0f; // Actors replicated with EReplicationType::Reliable
+        float NetCullDistance = 15000.0f;
+        float WorldSize = 40000.0f;    // Actors and client views are spread over a square this wide
+
+        // Server
+        int32 BytesPerSecond = 0;        // Per connection, 0 keeps ServerReplication's default
+        int32 MaxReplicationPerTick = 0; // Per connection, 0 keeps ServerReplication's default
+
+        NetSimulationSettings Network;
+        uint32 Seed = 1;
+    };
+
+    // Percentile summary of a set of samples
+    struct BenchmarkDistribution
+    {
+        int32 Samples = 0;
+        float Average = 0.0f;
+        float P50 = 0.0f;
+        float P95 = 0.0f;
+        float Max = 0.0f;
+    };
+
+    // Benchmark results - ToJson is stable across runs so results can be diffed and tracked
+    struct ReplicationBenchmarkResults
+    {
+        ReplicationBenchmarkSettings Settings;
+        int32 ConnectedClients = 0;
+        int32 Ticks = 0;
+        float MeasuredSeconds = 0.0f;
+
+        // Bandwidth - replication is delta payload, wire is everything the server socket sent (headers, acks, resends)
+        float ReplicationBytesPerClientPerSecond = 0.0f;
+        float MaxClientBytesPerSecond = 0.0f;
+        float WireBytesPerClientPerSecond = 0.0f;
+
+        // Server CPU per replication tick (relevancy, scheduling, serialization and the socket flush), milliseconds
+        BenchmarkDistribution TickTime;
+
+        // Scheduling - starvation is how many ticks a relevant, changed actor waited to be sent
+        int32 MaxStarvation = 0;
+        float AverageStarvation = 0.0f; // Per tick, the worst client's longest wait
+        float AverageActorsDeferred = 0.0f;
+        float AverageSaturation = 0.0f;
+
+        // Convergence - latency is from the server changing an actor to a client applying that change, milliseconds
+        BenchmarkDistribution Latency;
+        float SettleTime = -1.0f;       // Seconds after movement stopped until every client matched, -1 if they never did
+        float ConvergedFraction = 0.0f; // Relevant actor/client pairs matching the server at the end
+
+        // Transport, averaged over server connections
+        float AverageRoundTripMs = 0.0f;
+        float AveragePacketLoss = 0.0f;
+        int32 ReliableResends = 0;
+
+        FString ToJson() const;
+        bool SaveToFile(const FString& FilePath) const;
+    };
+
+    // Replication benchmark - runs a ServerReplication against simulated clients over real UDP loopback.
+    // Every client has its own NetworkManager and ReplicationManager, mirroring the server's actors.
+    // Runs in real time so latency and congestion behave like they would on a network.
+    class ReplicationBenchmark
+    {
+    public:
+        ReplicationBenchmark();
+        ~ReplicationBenchmark();
+
+        ReplicationBenchmark(const ReplicationBenchmark&) = delete;
+        ReplicationBenchmark& operator=(const ReplicationBenchmark&) = delete;
+
+        void SetSettings(const ReplicationBenchmarkSettings& Settings) { m_Settings = Settings; }
+        const ReplicationBenchmarkSettings& GetSettings() const { return m_Settings; }
+
+        // Blocks for about ConnectTimeout + Duration + SettleTime
+        ReplicationBenchmarkResults Run();
+
+    private:
+        struct BenchmarkActor
+        {
+            std::unique_ptr<UObject> Object;
+            std::unique_ptr<ReplicationInfo> Info;
+            EBenchmarkMovement Movement = EBenchmarkMovement::Static;
+            FVector Location;
+            FVector Velocity;
+            FVector Origin;
+            float Phase = 0.0f;
+            uint32 Revision = 0; // Tick of the last change, replicated so clients can time convergence
+        };
+
+        struct ReplicaState
+        {
+            FVector Location;
+            uint32 Revision = ~0u; // Nothing received yet
+        };
+
+        struct BenchmarkClient
+        {
+            std::unique_ptr<NetworkManager> Network;
+            std::unique_ptr<ReplicationManager> Replication;
+            TArray<std::unique_ptr<ReplicationInfo>> Infos;
+            TArray<ReplicaState> Replicas;
+            NetConnectionView View;
+            int32 ServerConnectionID = -1;
+            double BytesSent = 0.0;
+        };
+
+        ReplicationBenchmarkSettings m_Settings;
+
+        std::unique_ptr<NetworkManager> m_ServerNetwork;
+        std::unique_ptr<ReplicationManager> m_ServerReplicationManager;
+        std::unique_ptr<ServerReplication> m_ServerReplication;
+
+        TArray<BenchmarkActor> m_Actors;
+        TMap<UObject*, int32> m_ActorIndices;
+        TArray<std::unique_ptr<BenchmarkClient>> m_Clients;
+        TMap<int32, int32> m_ClientsByPort; // Client socket port to client index, for matching server connections
+
+        TArray<double> m_RevisionTimes; // Wall time of each tick, indexed by revision
+        TArray<float> m_LatencySamples;
+        double m_StartTime;
+        uint32 m_Tick;
+
+        // Helper functions
+        double GetTime() const;
+        bool Setup();
+        void Teardown();
+        void CreateActors();
+        void CreateClients();
+        bool ConnectClients();
+        void MoveActors(float DeltaTime);
+        void TickClients();
+        float GetConvergedFraction() const;
+    };
+}
@@ -0,0 +1,329 @@
+/*
+ * UE4 Spatial Index Implementation - Self-contained loose octree implementation
+ * Vibe coder approved ✨
+ */
+
+#include "SpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace UE4SDK
+{
+    // SpatialOctree implementation
+    SpatialOctree::SpatialOctree(const SpatialOctreeSettings& Settings)
+        : m_LeafDepth(0)
+        , m_FirstFreeEntry(InvalidHandle)
+        , m_Count(0)
+    {
+        SetSettings(Settings);
+    }
+
+    void SpatialOctree::SetSettings(const SpatialOctreeSettings& Settings)
+    {
+        m_Settings = Settings;
+        m_Settings.HalfExtent = std::max(1.0f, m_Settings.HalfExtent);
+        m_Settings.MinNodeSize = std::max(1.0f, m_Settings.MinNodeSize);
+
+        // Halve until the cells reach the minimum size
+        m_LeafDepth = 0;
+        for (float Size = m_Settings.HalfExtent * 2.0f; Size * 0.5f >= m_Settings.MinNodeSize && m_LeafDepth < MaxDepth; Size *= 0.5f)
+        {
+            ++m_LeafDepth;
+        }
+
+        Clear();
+    }
+
+    void SpatialOctree::Clear()
+    {
+        // Keep the storage so refilling doesn't allocate
+        m_Nodes.Empty();
+        m_FreeBlocks.Empty();
+        m_Entries.Empty();
+        m_FirstFreeEntry = InvalidHandle;
+        m_Count = 0;
+
+        Node Root;
+        Root.Center = m_Settings.Origin;
+        Root.HalfSize = m_Settings.HalfExtent;
+        Root.Depth = 0;
+        Root.Parent = InvalidHandle;
+        Root.FirstChild = InvalidHandle;
+        Root.FirstEntry = InvalidHandle;
+        Root.SubtreeCount = 0;
+        m_Nodes.Add(Root);
+    }
+
+    int32 SpatialOctree::Insert(int32 UserId, const FVector& Location, float Radius)
+    {
+        int32 Handle = m_FirstFreeEntry;
+        if (Handle != InvalidHandle)
+        {
+            m_FirstFreeEntry = m_Entries[Handle].Next;
+        }
+        else
+        {
+            Handle = m_Entries.Num();
+            m_Entries.Add(EntrySlot());
+        }
+
+        EntrySlot& Slot = m_Entries[Handle];
+        Slot.Entry.Location = Location;
+        Slot.Entry.Radius = Radius;
+        Slot.Entry.UserId = UserId;
+        Link(Handle, FindOrCreateNode(Location, Radius));
+        ++m_Count;
+        return Handle;
+    }
+
+    void SpatialOctree::Update(int32 Handle, const FVector& Location, float Radius)
+    {
+        if (!IsValidHandle(Handle))
+        {
+            return;
+        }
+
+        EntrySlot& Slot = m_Entries[Handle];
+        const Node& Current = m_Nodes[Slot.NodeIndex];
+        bool bStays = Current.Depth == GetTargetDepth(Radius) && Current.IsInsideCell(Location);
+        Slot.Entry.Location = Location;
+        Slot.Entry.Radius = Radius;
+
+        if (!bStays)
+        {
+            // Unlink first - it may free the nodes the new location would have reused
+            Unlink(Handle);
+            Link(Handle, FindOrCreateNode(Location, Radius));
+        }
+    }
+
+    void SpatialOctree::Remove(int32 Handle)
+    {
+        if (!IsValidHandle(Handle))
+        {
+            return;
+        }
+
+        Unlink(Handle);
+        EntrySlot& Slot = m_Entries[Handle];
+        Slot.NodeIndex = InvalidHandle;
+        Slot.Next = m_FirstFreeEntry;
+        m_FirstFreeEntry = Handle;
+        --m_Count;
+    }
+
+    bool SpatialOctree::Raycast(const FVector& Origin, const FVector& Direction, float MaxDistance, int32& OutHandle, float& OutDistance) const
+    {
+        FVector InvDirection = GetInvDirection(Direction);
+        float BestDistance = MaxDistance;
+        int32 BestHandle = InvalidHandle;
+
+        Traverse(
+            [&Origin, &InvDirection, &BestDistance](const Node& Child) { return Child.GetLooseBounds().IntersectRay(Origin, InvDirection, BestDistance); },
+            [&Origin, &Direction, &BestDistance, &BestHandle](int32 Handle, const SpatialEntry& Entry)
+            {
+                float Distance;
+                if (IntersectEntry(Entry, Origin, Direction, BestDistance, Distance) && (BestHandle == InvalidHandle || Distance < BestDistance))
+                {
+                    BestDistance = Distance;
+                    BestHandle = Handle;
+                }
+                return true;
+            });
+
+        if (BestHandle == InvalidHandle)
+        {
+            return false;
+        }
+
+        OutHandle = BestHandle;
+        OutDistance = BestDistance;
+        return true;
+    }
+
+    void SpatialOctree::QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutUserIds) const
+    {
+        QuerySphere(Center, Radius, [&OutUserIds](int32, const SpatialEntry& Entry) { OutUserIds.Add(Entry.UserId); });
+    }
+
+    int32 SpatialOctree::GetTargetDepth(float Radius) const
+    {
+        // Deepest node whose cell half size still covers the radius, so the sphere fits the loose bounds
+        int32 Depth = 0;
+        for (float HalfSize = m_Settings.HalfExtent * 0.5f; Depth < m_LeafDepth && HalfSize >= Radius; HalfSize *= 0.5f)
+        {
+            ++Depth;
+        }
+        return Depth;
+    }
+
+    int32 SpatialOctree::FindOrCreateNode(const FVector& Location, float Radius)
+    {
+        if (!m_Nodes[0].IsInsideCell(Location))
+        {
+            return 0;
+        }
+
+        int32 TargetDepth = GetTargetDepth(Radius);
+        int32 NodeIndex = 0;
+        while (m_Nodes[NodeIndex].Depth < TargetDepth)
+        {
+            if (m_Nodes[NodeIndex].FirstChild == InvalidHandle)
+            {
+                AllocateChildren(NodeIndex);
+            }
+
+            const Node& Current = m_Nodes[NodeIndex];
+            int32 Octant = (Location.X >= Current.Center.X ? 1 : 0) | (Location.Y >= Current.Center.Y ? 2 : 0) | (Location.Z >= Current.Center.Z ? 4 : 0);
+            NodeIndex = Current.FirstChild + Octant;
+        }
+        return NodeIndex;
+    }
+
+    void SpatialOctree::AllocateChildren(int32 NodeIndex)
+    {
+        int32 FirstChild;
+        if (m_FreeBlocks.Num() > 0)
+        {
+            FirstChild = m_FreeBlocks.PopValue();
+        }
+        else
+        {
+            FirstChild = m_Nodes.Num();
+            for (int32 i = 0; i < 8; ++i)
+            {
+                m_Nodes.Add(Node());
+            }
+        }
+
+        // Parent may have moved if the node array grew
+        Node& Parent = m_Nodes[NodeIndex];
+        Parent.FirstChild = FirstChild;
+
+        float ChildHalfSize = Parent.HalfSize * 0.5f;
+        for (int32 i = 0; i < 8; ++i)
+        {
+            Node& Child = m_Nodes[FirstChild + i];
+            Child.Center = Parent.Center + FVector(i & 1 ? ChildHalfSize : -ChildHalfSize, i & 2 ? ChildHalfSize : -ChildHalfSize, i & 4 ? ChildHalfSize : -ChildHalfSize);
+            Child.HalfSize = ChildHalfSize;
+            Child.Depth = Parent.Depth + 1;
+            Child.Parent = NodeIndex;
+            Child.FirstChild = InvalidHandle;
+            Child.FirstEntry = InvalidHandle;
+            Child.SubtreeCount = 0;
+        }
+    }
+
+    void SpatialOctree::Link(int32 Handle, int32 NodeIndex)
+    {
+        EntrySlot& Slot = m_Entries[Handle];
+        Node& Target = m_Nodes[NodeIndex];
+        Slot.NodeIndex = NodeIndex;
+        Slot.Prev = InvalidHandle;
+        Slot.Next = Target.FirstEntry;
+        if (Target.FirstEntry != InvalidHandle)
+        {
+            m_Entries[Target.FirstEntry].Prev = Handle;
+        }
+        Target.FirstEntry = Handle;
+
+        for (int32 Index = NodeIndex; Index != InvalidHandle; Index = m_Nodes[Index].Parent)
+        {
+            ++m_Nodes[Index].SubtreeCount;
+        }
+    }
+
+    void SpatialOctree::Unlink(int32 Handle)
+    {
+        EntrySlot& Slot = m_Entries[Handle];
+        if (Slot.Prev != InvalidHandle)
+        {
+            m_Entries[Slot.Prev].Next = Slot.Next;
+        }
+        else
+        {
+            m_Nodes[Slot.NodeIndex].FirstEntry = Slot.Next;
+        }
+        if (Slot.Next != InvalidHandle)
+        {
+            m_Entries[Slot.Next].Prev = Slot.Prev;
+        }
+
+        // Children of a node that just went empty are empty too - hand the block back
+        for (int32 Index = Slot.NodeIndex; Index != InvalidHandle; Index = m_Nodes[Index].Parent)
+        {
+            Node& Current = m_Nodes[Index];
+            if (--Current.SubtreeCount == 0 && Current.FirstChild != InvalidHandle)
+            {
+                m_FreeBlocks.Add(Current.FirstChild);
+                Current.FirstChild = InvalidHandle;
+            }
+        }
+    }
+
+    FVector SpatialOctree::GetInvDirection(const FVector& Direction)
+    {
+        // Axis-parallel rays would give 0 * inf in the slab test, a huge reciprocal keeps it finite
+        auto Invert = [](float Value) { return std::abs(Value) > 1e-20f ? 1.0f / Value : (Value < 0.0f ? -1e20f : 1e20f); };
+        return FVector(Invert(Direction.X), Invert(Direction.Y), Invert(Direction.Z));
+    }
+
+    bool SpatialOctree::IntersectEntry(const SpatialEntry& Entry, const FVector& Origin, const FVector& Direction, float MaxDistance, float& OutDistance)
+    {
+        FVector ToCenter = Entry.Location - Origin;
+        float Along = ToCenter | Direction;
+        float RadiusSquared = Entry.Radius * Entry.Radius;
+        float ClosestSquared = ToCenter.SizeSquared() - Along * Along;
+        if (ClosestSquared > RadiusSquared)
+        {
+            return false;
+        }
+
+        float HalfChord = std::sqrt(std::max(0.0f, RadiusSquared - ClosestSquared));
+        float Enter = Along - HalfChord;
+        if (Along + HalfChord < 0.0f || Enter > MaxDistance)
+        {
+            return false;
+        }
+
+        OutDistance = std::max(0.0f, Enter);
+        return true;
+    }
+
+    // SpatialIndex implementation
+    SpatialIndex::SpatialIndex(const SpatialOctreeSettings& Settings)
+        : m_Live(Settings)
+        , m_Published(std::make_shared<SpatialOctree>(Settings))
+        , m_PublishedVersion(0)
+    {
+    }
+
+    void SpatialIndex::Publish()
+    {
+        // Only the publisher touches the spare, and readers can't pick it up again once it's unpublished,
+        // so a use count of one means nobody is reading it any more
+        if (m_Spare && m_Spare.use_count() == 1)
+        {
+            // use_count() is a relaxed load - the fence orders the overwrite after the last reader's
+            // release of its reference (the count decrement), and so after its final query
+            std::atomic_thread_fence(std::memory_order_acquire);
+            *m_Spare = m_Live;
+        }
+        else
+        {
+            m_Spare = std::make_shared<SpatialOctree>(m_Live);
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(m_PublishMutex);
+            std::swap(m_Published, m_Spare);
+        }
+        m_PublishedVersion.fetch_add(1, std::memory_order_release);
+    }
+
+    std::shared_ptr<const SpatialOctree> SpatialIndex::GetPublished() const
+    {
+        std::lock_guard<std::mutex> Lock(m_PublishMutex);
+        return m_Published;
+    }
+}
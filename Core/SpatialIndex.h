@@ -0,0 +1,222 @@
+/*
+ * UE4 Spatial Index - Self-contained loose octree for proximity, box and ray queries
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "Matrix.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace UE4SDK
+{
+    struct SpatialOctreeSettings
+    {
+        FVector Origin;
+        float HalfExtent = 524288.0f; // Entries outside the root cube still work, they all sit in the root node
+        float MinNodeSize = 512.0f;   // Deepest cells are about this wide
+    };
+
+    // Entry - a bounding sphere plus whatever id the caller uses to find its object
+    struct SpatialEntry
+    {
+        FVector Location;
+        float Radius = 0.0f;
+        int32 UserId = -1;
+    };
+
+    // Loose octree - each node's bounds are twice its cell, so an entry lives in exactly one node picked
+    // from its center and radius. Moves that stay inside the same cell are a plain write.
+    // Queries are const and never allocate; any number of threads can query while nobody modifies.
+    class SpatialOctree
+    {
+    public:
+        static constexpr int32 InvalidHandle = -1;
+        static constexpr int32 MaxDepth = 16;
+
+        explicit SpatialOctree(const SpatialOctreeSettings& Settings = SpatialOctreeSettings());
+
+        void SetSettings(const SpatialOctreeSettings& Settings); // Clears the tree
+        const SpatialOctreeSettings& GetSettings() const { return m_Settings; }
+
+        // Modification - handles stay valid until removed and are reused afterwards
+        int32 Insert(int32 UserId, const FVector& Location, float Radius = 0.0f);
+        void Update(int32 Handle, const FVector& Location, float Radius);
+        void Move(int32 Handle, const FVector& Location) { Update(Handle, Location, m_Entries[Handle].Entry.Radius); }
+        void SetUserId(int32 Handle, int32 UserId) { m_Entries[Handle].Entry.UserId = UserId; }
+        void Remove(int32 Handle);
+        void Clear();
+
+        bool IsValidHandle(int32 Handle) const { return Handle >= 0 && Handle < m_Entries.Num() && m_Entries[Handle].NodeIndex != InvalidHandle; }
+        const SpatialEntry& GetEntry(int32 Handle) const { return m_Entries[Handle].Entry; }
+        int32 Num() const { return m_Count; }
+        int32 GetNodeCount() const { return m_Nodes.Num() - m_FreeBlocks.Num() * 8; }
+
+        // Visitors are called as (int32 Handle, const SpatialEntry& Entry) and may return bool - false stops the query.
+        // Entries are reported when their sphere overlaps the query shape.
+        template<typename VisitorType>
+        void QuerySphere(const FVector& Center, float Radius, VisitorType&& Visitor) const
+        {
+            Traverse(
+                [&Center, Radius](const Node& Child) { return Child.GetLooseBounds().ComputeSquaredDistanceToPoint(Center) <= Radius * Radius; },
+                [&Center, Radius, &Visitor](int32 Handle, const SpatialEntry& Entry)
+                {
+                    float Reach = Radius + Entry.Radius;
+                    return (Entry.Location - Center).SizeSquared() > Reach * Reach || Visit(Visitor, Handle, Entry);
+                });
+        }
+
+        template<typename VisitorType>
+        void QueryBox(const FBox& Box, VisitorType&& Visitor) const
+        {
+            Traverse(
+                [&Box](const Node& Child) { return Box.Intersect(Child.GetLooseBounds()); },
+                [&Box, &Visitor](int32 Handle, const SpatialEntry& Entry)
+                {
+                    return Box.ComputeSquaredDistanceToPoint(Entry.Location) > Entry.Radius * Entry.Radius || Visit(Visitor, Handle, Entry);
+                });
+        }
+
+        // Ray visitors are called as (int32 Handle, const SpatialEntry& Entry, float Distance), in no particular order.
+        // Direction must be normalized; Distance is zero when the ray starts inside the entry.
+        template<typename VisitorType>
+        void QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, VisitorType&& Visitor) const
+        {
+            FVector InvDirection = GetInvDirection(Direction);
+            Traverse(
+                [&Origin, &InvDirection, MaxDistance](const Node& Child) { return Child.GetLooseBounds().IntersectRay(Origin, InvDirection, MaxDistance); },
+                [&Origin, &Direction, MaxDistance, &Visitor](int32 Handle, const SpatialEntry& Entry)
+                {
+                    float Distance;
+                    return !IntersectEntry(Entry, Origin, Direction, MaxDistance, Distance) || Visit(Visitor, Handle, Entry, Distance);
+                });
+        }
+
+        // Closest entry along the ray, nodes beyond the best hit so far are skipped
+        bool Raycast(const FVector& Origin, const FVector& Direction, float MaxDistance, int32& OutHandle, float& OutDistance) const;
+
+        // Appends the user ids of entries overlapping the sphere
+        void QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutUserIds) const;
+
+    private:
+        struct Node
+        {
+            FVector Center;
+            float HalfSize;
+            int32 Depth;
+            int32 Parent;
+            int32 FirstChild;   // Eight siblings stored together, InvalidHandle for leaves
+            int32 FirstEntry;   // Entries in this node, linked through EntrySlot
+            int32 SubtreeCount; // Entries here and below, empty subtrees are skipped and freed
+
+            FBox GetLooseBounds() const { return FBox::BuildAABB(Center, FVector(HalfSize * 2.0f)); }
+            bool IsInsideCell(const FVector& Point) const
+            {
+                return std::abs(Point.X - Center.X) <= HalfSize && std::abs(Point.Y - Center.Y) <= HalfSize && std::abs(Point.Z - Center.Z) <= HalfSize;
+            }
+        };
+
+        struct EntrySlot
+        {
+            SpatialEntry Entry;
+            int32 NodeIndex; // InvalidHandle while free
+            int32 Prev;
+            int32 Next; // Next free slot while free
+        };
+
+        SpatialOctreeSettings m_Settings;
+        int32 m_LeafDepth;
+        TArray<Node> m_Nodes; // Root is always index 0
+        TArray<int32> m_FreeBlocks;
+        TArray<EntrySlot> m_Entries;
+        int32 m_FirstFreeEntry;
+        int32 m_Count;
+
+        // Helper functions
+        int32 GetTargetDepth(float Radius) const;
+        int32 FindOrCreateNode(const FVector& Location, float Radius);
+        void AllocateChildren(int32 NodeIndex);
+        void Link(int32 Handle, int32 NodeIndex);
+        void Unlink(int32 Handle);
+
+        static FVector GetInvDirection(const FVector& Direction);
+        static bool IntersectEntry(const SpatialEntry& Entry, const FVector& Origin, const FVector& Direction, float MaxDistance, float& OutDistance);
+
+        template<typename VisitorType, typename... ArgTypes>
+        static bool Visit(VisitorType& Visitor, ArgTypes&&... Args)
+        {
+            if constexpr (std::is_same_v<std::invoke_result_t<VisitorType&, ArgTypes...>, bool>)
+            {
+                return Visitor(std::forward<ArgTypes>(Args)...);
+            }
+            else
+            {
+                Visitor(std::forward<ArgTypes>(Args)...);
+                return true;
+            }
+        }
+
+        // Depth-first walk on a fixed stack. The root is always visited, it holds everything outside the root cube.
+        template<typename NodeTestType, typename EntryTestType>
+        void Traverse(NodeTestType&& NodeTest, EntryTestType&& EntryTest) const
+        {
+            int32 Stack[8 * (MaxDepth + 1)];
+            int32 StackSize = 0;
+            Stack[StackSize++] = 0;
+
+            while (StackSize > 0)
+            {
+                const Node& Current = m_Nodes[Stack[--StackSize]];
+                for (int32 Handle = Current.FirstEntry; Handle != InvalidHandle; Handle = m_Entries[Handle].Next)
+                {
+                    if (!EntryTest(Handle, m_Entries[Handle].Entry))
+                    {
+                        return;
+                    }
+                }
+
+                if (Current.FirstChild == InvalidHandle)
+                {
+                    continue;
+                }
+                for (int32 i = 0; i < 8; ++i)
+                {
+                    const Node& Child = m_Nodes[Current.FirstChild + i];
+                    if (Child.SubtreeCount > 0 && NodeTest(Child))
+                    {
+                        Stack[StackSize++] = Current.FirstChild + i;
+                    }
+                }
+            }
+        }
+    };
+
+    // Spatial index - the live octree for the thread that owns the objects, plus a published copy
+    // that worker threads read for a whole frame. Call Publish() once the frame's updates are in;
+    // readers hold the returned pointer, so later publishes never change it under them.
+    class SpatialIndex
+    {
+    public:
+        explicit SpatialIndex(const SpatialOctreeSettings& Settings = SpatialOctreeSettings());
+
+        // Live tree - modify and query from the owning thread only
+        SpatialOctree& GetLive() { return m_Live; }
+        const SpatialOctree& GetLive() const { return m_Live; }
+
+        // Frame-stable copy - safe to call from any thread
+        void Publish();
+        std::shared_ptr<const SpatialOctree> GetPublished() const;
+        uint32 GetPublishedVersion() const { return m_PublishedVersion.load(std::memory_order_acquire); }
+
+    private:
+        SpatialOctree m_Live;
+        std::shared_ptr<SpatialOctree> m_Published;
+        std::shared_ptr<SpatialOctree> m_Spare; // Last publish, reused once every reader has let go
+        mutable std::mutex m_PublishMutex;
+        std::atomic<uint32> m_PublishedVersion;
+    };
+}
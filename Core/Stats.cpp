@@ -0,0 +1,582 @@
+/*
+ * UE4 Stats Implementation - Self-contained frame stats registry implementation
+ * Vibe coder approved ✨
+ */
+
+#include "Stats.h"
+#include "Utils.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        const int32 DefaultWindowFrames = 300;
+
+        // Hands the thread's shard back when the thread exits
+        struct ThreadShardRelease
+        {
+            StatsThreadShard* Shard = nullptr;
+
+            ~ThreadShardRelease()
+            {
+                if (Shard)
+                {
+                    StatsRegistry::Get().RetireThreadShard(*Shard);
+                }
+            }
+        };
+
+        thread_local ThreadShardRelease t_ShardRelease;
+
+        const char* GetStatTypeName(EStatType Type)
+        {
+            switch (Type)
+            {
+            case EStatType::Counter: return "counter";
+            case EStatType::Gauge: return "gauge";
+            case EStatType::Histogram: return "histogram";
+            }
+            return "unknown";
+        }
+
+        void AppendEscaped(std::string& Json, const char* Text)
+        {
+            for (const char* Char = Text ? Text : ""; *Char; ++Char)
+            {
+                if (*Char == '"' || *Char == '\\')
+                {
+                    Json += '\\';
+                    Json += *Char;
+                }
+                else if (static_cast<unsigned char>(*Char) < 0x20)
+                {
+                    Json += ' ';
+                }
+                else
+                {
+                    Json += *Char;
+                }
+            }
+        }
+    }
+
+    // StatsThreadShard implementation
+    StatsThreadShard::StatsThreadShard()
+        : m_Slots(new std::atomic<int64>[StatsRegistry::MaxSlots])
+        , m_bRetired(false)
+    {
+        for (int32 i = 0; i < StatsRegistry::MaxSlots; ++i)
+        {
+            m_Slots[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // StatsRegistry implementation
+    thread_local StatsThreadShard* StatsRegistry::t_Shard = nullptr;
+    StatsRegistry* StatsRegistry::s_Instance = nullptr;
+
+    StatsRegistry& StatsRegistry::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(Diagnostics);
+            s_Instance = new StatsRegistry();
+        }
+        return *s_Instance;
+    }
+
+    StatsRegistry::StatsRegistry()
+        : m_NextSlot(0)
+        , m_MergedSlots(new int64[MaxSlots])
+        , m_FrameNumber(0)
+        , m_WindowFrames(DefaultWindowFrames)
+        , m_WindowCursor(0)
+        , m_WindowFilled(0)
+        , m_DumpInterval(0.0f)
+        , m_TimeSinceDump(0.0f)
+    {
+        for (int32 i = 0; i < MaxSlots; ++i)
+        {
+            m_MergedSlots[i] = 0;
+        }
+        for (std::atomic<double>& Gauge : m_Gauges)
+        {
+            Gauge.store(0.0, std::memory_order_relaxed);
+        }
+        for (int32 i = 0; i < m_WindowFrames; ++i)
+        {
+            m_FrameSeconds.Add(0.0f);
+        }
+    }
+
+    StatId StatsRegistry::RegisterCounter(const FString& Name)
+    {
+        return RegisterStat(Name, EStatType::Counter, 1, nullptr);
+    }
+
+    StatId StatsRegistry::RegisterGauge(const FString& Name)
+    {
+        return RegisterStat(Name, EStatType::Gauge, 0, nullptr);
+    }
+
+    StatId StatsRegistry::RegisterHistogram(const FString& Name, double Min, double Max, int32 BucketCount)
+    {
+        if (!(Max > Min))
+        {
+            Utils::Get().LogWarning(TEXT("Stats: histogram ") + Name + TEXT(" has an empty range"));
+            Max = Min + 1.0;
+        }
+
+        HistogramLayout Layout;
+        Layout.Min = Min;
+        Layout.Max = Max;
+        Layout.BucketCount = std::max(1, std::min(BucketCount, MaxHistogramBuckets));
+        Layout.InverseBucketWidth = Layout.BucketCount / (Max - Min);
+        return RegisterStat(Name, EStatType::Histogram, Layout.BucketCount + 3, &Layout);
+    }
+
+    StatId StatsRegistry::RegisterStat(const FString& Name, EStatType Type, int32 SlotCount, const HistogramLayout* Layout)
+    {
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        const int32* Existing = m_StatNames.Find(Name);
+        if (Existing)
+        {
+            const StatWindow& Stat = m_Stats[*Existing];
+            if (Stat.Type != Type)
+            {
+                Utils::Get().LogWarning(TEXT("Stats: ") + Name + TEXT(" is already registered with another type"));
+                return StatId();
+            }
+            return { *Existing, Stat.Slot };
+        }
+
+        if (m_Stats.Num() >= MaxStats || m_NextSlot + SlotCount > MaxSlots)
+        {
+            Utils::Get().LogError(TEXT("Stats: registry is full, can't register ") + Name);
+            return StatId();
+        }
+
+        // The layout is written before the id leaves this function, so recording threads see it complete
+        int32 Index = m_Stats.Num();
+        if (Layout)
+        {
+            m_Histograms[Index] = *Layout;
+        }
+
+        StatWindow Stat;
+        Stat.Name = Name;
+        Stat.Type = Type;
+        Stat.Slot = SlotCount > 0 ? m_NextSlot : -1;
+        Stat.SlotCount = SlotCount;
+        ResetWindow(Stat);
+        m_NextSlot += SlotCount;
+
+        m_Stats.Add(Stat);
+        m_StatNames.Add(Name, Index);
+        return { Index, Stat.Slot };
+    }
+
+    StatId StatsRegistry::FindStat(const FString& Name) const
+    {
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        const int32* Index = m_StatNames.Find(Name);
+        if (!Index)
+        {
+            return StatId();
+        }
+        return { *Index, m_Stats[*Index].Slot };
+    }
+
+    int32 StatsRegistry::GetStatCount() const
+    {
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        return m_Stats.Num();
+    }
+
+    void StatsRegistry::EndFrame(float DeltaTime)
+    {
+        TArray<StatsThreadShard*> Shards;
+        {
+            std::lock_guard<std::mutex> Lock(m_ShardMutex);
+            Shards.Reserve(m_Shards.Num());
+            for (const std::unique_ptr<StatsThreadShard>& Shard : m_Shards)
+            {
+                Shards.Add(Shard.get());
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+
+            // Slot deltas since the last merge, summed over every shard. Unsigned so histogram sum
+            // slots, which hold double bits and are merged separately, can't overflow the sum.
+            TArray<int64> Deltas;
+            Deltas.Reserve(m_NextSlot);
+            for (int32 Slot = 0; Slot < m_NextSlot; ++Slot)
+            {
+                uint64 Sum = 0;
+                for (StatsThreadShard* Shard : Shards)
+                {
+                    Sum += static_cast<uint64>(Shard->m_Slots[Slot].load(std::memory_order_relaxed));
+                }
+                Deltas.Add(static_cast<int64>(Sum - static_cast<uint64>(m_MergedSlots[Slot])));
+                m_MergedSlots[Slot] = static_cast<int64>(Sum);
+            }
+
+            m_FrameSeconds[m_WindowCursor] = DeltaTime;
+            for (int32 Index = 0; Index < m_Stats.Num(); ++Index)
+            {
+                StatWindow& Stat = m_Stats[Index];
+                switch (Stat.Type)
+                {
+                case EStatType::Counter:
+                {
+                    Stat.LastFrame = Deltas[Stat.Slot];
+                    Stat.Total += Stat.LastFrame;
+                    Stat.FrameCounts[m_WindowCursor] = Stat.LastFrame;
+                    break;
+                }
+                case EStatType::Gauge:
+                {
+                    Stat.LastValue = m_Gauges[Index].load(std::memory_order_relaxed);
+                    Stat.FrameValues[m_WindowCursor] = Stat.LastValue;
+                    break;
+                }
+                case EStatType::Histogram:
+                {
+                    // Sums are stored as double bits, so their delta is taken on the decoded values
+                    int32 BucketSlots = Stat.SlotCount - 1;
+                    int32 SumSlot = Stat.Slot + BucketSlots;
+                    double SumNow = 0.0;
+                    for (StatsThreadShard* Shard : Shards)
+                    {
+                        SumNow += std::bit_cast<double>(Shard->m_Slots[SumSlot].load(std::memory_order_relaxed));
+                    }
+
+                    int64 Count = 0;
+                    int64* FrameBuckets = &Stat.FrameBuckets[m_WindowCursor * BucketSlots];
+                    for (int32 Bucket = 0; Bucket < BucketSlots; ++Bucket)
+                    {
+                        int64 Delta = Deltas[Stat.Slot + Bucket];
+                        Stat.WindowBuckets[Bucket] += Delta - FrameBuckets[Bucket];
+                        FrameBuckets[Bucket] = Delta;
+                        Count += Delta;
+                    }
+
+                    Stat.LastFrame = Count;
+                    Stat.Total += Count;
+                    Stat.FrameCounts[m_WindowCursor] = Count;
+                    Stat.FrameValues[m_WindowCursor] = SumNow - Stat.MergedSum;
+                    Stat.MergedSum = SumNow;
+                    break;
+                }
+                }
+            }
+
+            m_WindowCursor = (m_WindowCursor + 1) % m_WindowFrames;
+            m_WindowFilled = std::min(m_WindowFilled + 1, m_WindowFrames);
+            ++m_FrameNumber;
+        }
+
+        if (m_DumpInterval > 0.0f)
+        {
+            m_TimeSinceDump += DeltaTime;
+            if (m_TimeSinceDump >= m_DumpInterval)
+            {
+                m_TimeSinceDump = 0.0f;
+                Dump();
+            }
+        }
+    }
+
+    void StatsRegistry::SetWindowFrames(int32 Frames)
+    {
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        m_WindowFrames = std::max(1, Frames);
+        m_WindowCursor = 0;
+        m_WindowFilled = 0;
+
+        m_FrameSeconds.Empty();
+        for (int32 i = 0; i < m_WindowFrames; ++i)
+        {
+            m_FrameSeconds.Add(0.0f);
+        }
+        for (StatWindow& Stat : m_Stats)
+        {
+            ResetWindow(Stat);
+        }
+    }
+
+    void StatsRegistry::ResetWindow(StatWindow& Stat)
+    {
+        Stat.FrameCounts.Empty();
+        Stat.FrameValues.Empty();
+        Stat.FrameBuckets.Empty();
+        Stat.WindowBuckets.Empty();
+
+        for (int32 i = 0; i < m_WindowFrames; ++i)
+        {
+            Stat.FrameCounts.Add(0);
+            Stat.FrameValues.Add(0.0);
+        }
+
+        if (Stat.Type == EStatType::Histogram)
+        {
+            int32 BucketSlots = Stat.SlotCount - 1;
+            Stat.FrameBuckets.Reserve(m_WindowFrames * BucketSlots);
+            for (int32 i = 0; i < m_WindowFrames * BucketSlots; ++i)
+            {
+                Stat.FrameBuckets.Add(0);
+            }
+            for (int32 i = 0; i < BucketSlots; ++i)
+            {
+                Stat.WindowBuckets.Add(0);
+            }
+        }
+    }
+
+    bool StatsRegistry::GetSnapshot(const FString& Name, StatSnapshot& OutSnapshot) const
+    {
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        const int32* Index = m_StatNames.Find(Name);
+        if (!Index)
+        {
+            return false;
+        }
+
+        OutSnapshot = BuildSnapshot(m_Stats[*Index], *Index);
+        return true;
+    }
+
+    void StatsRegistry::GetSnapshots(TArray<StatSnapshot>& OutSnapshots) const
+    {
+        OutSnapshots.Empty();
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        OutSnapshots.Reserve(m_Stats.Num());
+
+        // Map order is name order
+        for (const auto& Pair : m_StatNames)
+        {
+            OutSnapshots.Add(BuildSnapshot(m_Stats[Pair.second], Pair.second));
+        }
+    }
+
+    StatSnapshot StatsRegistry::BuildSnapshot(const StatWindow& Stat, int32 Index) const
+    {
+        StatSnapshot Snapshot;
+        Snapshot.Name = Stat.Name;
+        Snapshot.Type = Stat.Type;
+        Snapshot.WindowFrames = m_WindowFilled;
+        Snapshot.Total = Stat.Total;
+        Snapshot.LastFrame = Stat.LastFrame;
+
+        // Walk back from the newest frame
+        double WindowSum = 0.0;
+        for (int32 i = 1; i <= m_WindowFilled; ++i)
+        {
+            int32 Frame = (m_WindowCursor - i + m_WindowFrames) % m_WindowFrames;
+            Snapshot.WindowSeconds += m_FrameSeconds[Frame];
+            Snapshot.WindowTotal += Stat.FrameCounts[Frame];
+            WindowSum += Stat.FrameValues[Frame];
+
+            if (Stat.Type == EStatType::Gauge)
+            {
+                double Value = Stat.FrameValues[Frame];
+                Snapshot.Min = i == 1 ? Value : std::min(Snapshot.Min, Value);
+                Snapshot.Max = i == 1 ? Value : std::max(Snapshot.Max, Value);
+            }
+        }
+
+        if (Snapshot.WindowSeconds > 0.0)
+        {
+            Snapshot.PerSecond = Snapshot.WindowTotal / Snapshot.WindowSeconds;
+        }
+
+        if (Stat.Type == EStatType::Gauge)
+        {
+            Snapshot.Value = Stat.LastValue;
+            Snapshot.Average = m_WindowFilled > 0 ? WindowSum / m_WindowFilled : 0.0;
+        }
+        else if (Stat.Type == EStatType::Histogram)
+        {
+            const HistogramLayout& Layout = m_Histograms[Index];
+            Snapshot.Count = Snapshot.WindowTotal;
+            Snapshot.Mean = Snapshot.Count > 0 ? WindowSum / Snapshot.Count : 0.0;
+
+            // Underflow and overflow samples clamp to the range ends
+            double BucketWidth = (Layout.Max - Layout.Min) / Layout.BucketCount;
+            auto Percentile = [&](double Fraction) -> double
+            {
+                if (Snapshot.Count == 0)
+                {
+                    return 0.0;
+                }
+
+                double Rank = Fraction * static_cast<double>(Snapshot.Count);
+                int64 Seen = 0;
+                for (int32 Bucket = 0; Bucket < Stat.WindowBuckets.Num(); ++Bucket)
+                {
+                    int64 InBucket = Stat.WindowBuckets[Bucket];
+                    if (InBucket > 0 && static_cast<double>(Seen + InBucket) >= Rank)
+                    {
+                        if (Bucket == 0)
+                        {
+                            return Layout.Min;
+                        }
+                        if (Bucket > Layout.BucketCount)
+                        {
+                            return Layout.Max;
+                        }
+                        double Within = (Rank - static_cast<double>(Seen)) / static_cast<double>(InBucket);
+                        return Layout.Min + (Bucket - 1 + Within) * BucketWidth;
+                    }
+                    Seen += InBucket;
+                }
+                return Layout.Max;
+            };
+
+            Snapshot.P50 = Percentile(0.50);
+            Snapshot.P95 = Percentile(0.95);
+            Snapshot.P99 = Percentile(0.99);
+        }
+
+        return Snapshot;
+    }
+
+    FString StatsRegistry::GetSnapshotJson() const
+    {
+        TArray<StatSnapshot> Snapshots;
+        GetSnapshots(Snapshots);
+
+        std::string Json;
+        char Buffer[256];
+        std::snprintf(Buffer, sizeof(Buffer), "{\"frame\":%llu,\"stats\":[", static_cast<unsigned long long>(m_FrameNumber));
+        Json += Buffer;
+
+        for (int32 i = 0; i < Snapshots.Num(); ++i)
+        {
+            const StatSnapshot& Stat = Snapshots[i];
+            Json += i == 0 ? "{\"name\":\"" : ",{\"name\":\"";
+            AppendEscaped(Json, *Stat.Name);
+            std::snprintf(Buffer, sizeof(Buffer), "\",\"type\":\"%s\",\"window_frames\":%d,\"window_seconds\":%.3f,", GetStatTypeName(Stat.Type), Stat.WindowFrames, Stat.WindowSeconds);
+            Json += Buffer;
+
+            switch (Stat.Type)
+            {
+            case EStatType::Counter:
+                std::snprintf(Buffer, sizeof(Buffer), "\"total\":%lld,\"last_frame\":%lld,\"window_total\":%lld,\"per_second\":%.3f}",
+                    static_cast<long long>(Stat.Total), static_cast<long long>(Stat.LastFrame), static_cast<long long>(Stat.WindowTotal), Stat.PerSecond);
+                break;
+            case EStatType::Gauge:
+                std::snprintf(Buffer, sizeof(Buffer), "\"value\":%.6g,\"min\":%.6g,\"max\":%.6g,\"average\":%.6g}", Stat.Value, Stat.Min, Stat.Max, Stat.Average);
+                break;
+            case EStatType::Histogram:
+                std::snprintf(Buffer, sizeof(Buffer), "\"count\":%lld,\"total\":%lld,\"mean\":%.6g,\"p50\":%.6g,\"p95\":%.6g,\"p99\":%.6g}",
+                    static_cast<long long>(Stat.Count), static_cast<long long>(Stat.Total), Stat.Mean, Stat.P50, Stat.P95, Stat.P99);
+                break;
+            }
+            Json += Buffer;
+        }
+
+        Json += "]}";
+        return FString(Json.c_str());
+    }
+
+    void StatsRegistry::LogReport() const
+    {
+        TArray<StatSnapshot> Snapshots;
+        GetSnapshots(Snapshots);
+
+        char Line[256];
+        std::snprintf(Line, sizeof(Line), "Stats frame %llu - %d stats", static_cast<unsigned long long>(m_FrameNumber), Snapshots.Num());
+        Utils::Get().LogInfo(FString(Line));
+
+        for (const StatSnapshot& Stat : Snapshots)
+        {
+            switch (Stat.Type)
+            {
+            case EStatType::Counter:
+                std::snprintf(Line, sizeof(Line), "  %-36.36s total %lld, last frame %lld, %.1f/s", *Stat.Name,
+                    static_cast<long long>(Stat.Total), static_cast<long long>(Stat.LastFrame), Stat.PerSecond);
+                break;
+            case EStatType::Gauge:
+                std::snprintf(Line, sizeof(Line), "  %-36.36s %.3f (min %.3f, avg %.3f, max %.3f)", *Stat.Name, Stat.Value, Stat.Min, Stat.Average, Stat.Max);
+                break;
+            case EStatType::Histogram:
+                std::snprintf(Line, sizeof(Line), "  %-36.36s n %lld, mean %.3f, p50 %.3f, p95 %.3f, p99 %.3f", *Stat.Name,
+                    static_cast<long long>(Stat.Count), Stat.Mean, Stat.P50, Stat.P95, Stat.P99);
+                break;
+            }
+            Utils::Get().LogInfo(FString(Line));
+        }
+    }
+
+    void StatsRegistry::SetDumpInterval(float Seconds, const FString& FilePath)
+    {
+        std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+        m_DumpInterval = std::max(0.0f, Seconds);
+        m_DumpPath = FilePath;
+        m_TimeSinceDump = 0.0f;
+    }
+
+    void StatsRegistry::Dump()
+    {
+        FString Path;
+        {
+            std::lock_guard<std::mutex> Lock(m_RegistryMutex);
+            Path = m_DumpPath;
+        }
+
+        if (Path.IsEmpty())
+        {
+            LogReport();
+            return;
+        }
+
+        std::ofstream File(*Path, std::ios::app);
+        if (!File)
+        {
+            Utils::Get().LogWarning(TEXT("Stats: can't open dump file ") + Path);
+            return;
+        }
+        File << *GetSnapshotJson() << '\n';
+    }
+
+    void StatsRegistry::RetireThreadShard(StatsThreadShard& Shard)
+    {
+        // Slot values stay put - they're cumulative, so the next owner just keeps adding
+        std::lock_guard<std::mutex> Lock(m_ShardMutex);
+        Shard.m_bRetired = true;
+        t_Shard = nullptr;
+    }
+
+    StatsThreadShard& StatsRegistry::RegisterThreadShard()
+    {
+        std::lock_guard<std::mutex> Lock(m_ShardMutex);
+        StatsThreadShard* Shard = nullptr;
+        for (const std::unique_ptr<StatsThreadShard>& Existing : m_Shards)
+        {
+            if (Existing->m_bRetired)
+            {
+                Shard = Existing.get();
+                Shard->m_bRetired = false;
+                break;
+            }
+        }
+
+        if (!Shard)
+        {
+            m_Shards.Add(std::make_unique<StatsThreadShard>());
+            Shard = m_Shards.Last().get();
+        }
+
+        t_Shard = Shard;
+        t_ShardRelease.Shard = Shard;
+        return *Shard;
+    }
+}
@@ -0,0 +1,252 @@
+/*
+ * UE4 Stats - Self-contained frame stats registry (counters, gauges, histograms)
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+
+namespace UE4SDK
+{
+    enum class EStatType : uint8
+    {
+        Counter,   // Monotonic count, summed across threads
+        Gauge,     // Last value set, sampled once per frame
+        Histogram  // Value distribution over fixed linear buckets
+    };
+
+    // Handle returned by registration - cheap to copy, keep it in a static
+    struct StatId
+    {
+        int32 Index = -1;
+        int32 Slot = -1; // First shard slot, -1 for gauges
+
+        bool IsValid() const { return Index >= 0; }
+    };
+
+    // Sliding-window view of one stat, built on request
+    struct StatSnapshot
+    {
+        FString Name;
+        EStatType Type = EStatType::Counter;
+        int32 WindowFrames = 0;      // Frames the window actually covers
+        double WindowSeconds = 0.0;
+
+        // Counter
+        int64 Total = 0;
+        int64 LastFrame = 0;
+        int64 WindowTotal = 0;
+        double PerSecond = 0.0;
+
+        // Gauge
+        double Value = 0.0;
+        double Min = 0.0;
+        double Max = 0.0;
+        double Average = 0.0;
+
+        // Histogram - percentiles are interpolated inside the bucket, so they're only as fine as the buckets
+        int64 Count = 0;             // Samples in the window
+        double Mean = 0.0;
+        double P50 = 0.0;
+        double P95 = 0.0;
+        double P99 = 0.0;
+    };
+
+    // Per-thread shard - only the owning thread writes it, the frame merge reads it.
+    // Slots are atomics for the reader's sake; the writer never uses a read-modify-write.
+    class StatsThreadShard
+    {
+    public:
+        StatsThreadShard();
+
+        void Add(int32 Slot, int64 Delta)
+        {
+            std::atomic<int64>& Value = m_Slots[Slot];
+            Value.store(Value.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+        }
+
+        void AddDouble(int32 Slot, double Delta)
+        {
+            std::atomic<int64>& Value = m_Slots[Slot];
+            double Sum = std::bit_cast<double>(Value.load(std::memory_order_relaxed)) + Delta;
+            Value.store(std::bit_cast<int64>(Sum), std::memory_order_relaxed);
+        }
+
+    private:
+        friend class StatsRegistry;
+
+        std::unique_ptr<std::atomic<int64>[]> m_Slots;
+        bool m_bRetired; // Owning thread exited, the next new thread takes the shard over
+    };
+
+    // StatsRegistry - one global view of every subsystem's counters.
+    // Updates touch only the calling thread's shard; EndFrame merges the shards and advances the windows.
+    class StatsRegistry
+    {
+    public:
+        static constexpr int32 MaxStats = 1024;
+        static constexpr int32 MaxSlots = 8192;       // Counters take one slot, histograms BucketCount + 3
+        static constexpr int32 MaxHistogramBuckets = 64;
+
+        static StatsRegistry& Get();
+
+        // Registration - registering an existing name returns the existing stat, if the type matches
+        StatId RegisterCounter(const FString& Name);
+        StatId RegisterGauge(const FString& Name);
+        StatId RegisterHistogram(const FString& Name, double Min, double Max, int32 BucketCount = 32);
+        StatId FindStat(const FString& Name) const;
+        int32 GetStatCount() const;
+
+        // Updates - safe from any thread
+        static void AddCounter(StatId Id, int64 Delta = 1)
+        {
+            if (Id.Slot >= 0)
+            {
+                GetThreadShard().Add(Id.Slot, Delta);
+            }
+        }
+
+        void SetGauge(StatId Id, double Value)
+        {
+            if (Id.IsValid())
+            {
+                m_Gauges[Id.Index].store(Value, std::memory_order_relaxed);
+            }
+        }
+
+        void RecordHistogram(StatId Id, double Value)
+        {
+            if (Id.Slot < 0)
+            {
+                return;
+            }
+
+            // Slot layout: underflow, BucketCount buckets, overflow, sum
+            const HistogramLayout& Layout = m_Histograms[Id.Index];
+            int32 Bucket;
+            if (Value < Layout.Min)
+            {
+                Bucket = 0;
+            }
+            else if (Value >= Layout.Max)
+            {
+                Bucket = Layout.BucketCount + 1;
+            }
+            else
+            {
+                Bucket = 1 + static_cast<int32>((Value - Layout.Min) * Layout.InverseBucketWidth);
+                Bucket = Bucket > Layout.BucketCount ? Layout.BucketCount : Bucket;
+            }
+
+            StatsThreadShard& Shard = GetThreadShard();
+            Shard.Add(Id.Slot + Bucket, 1);
+            Shard.AddDouble(Id.Slot + Layout.BucketCount + 2, Value);
+        }
+
+        // Call once per frame from the game thread - merges every shard and advances the sliding windows
+        void EndFrame(float DeltaTime);
+        uint64 GetFrameNumber() const { return m_FrameNumber; }
+
+        // Windows
+        void SetWindowFrames(int32 Frames); // Clears the windows, totals are kept
+        int32 GetWindowFrames() const { return m_WindowFrames; }
+
+        // Snapshots
+        bool GetSnapshot(const FString& Name, StatSnapshot& OutSnapshot) const;
+        void GetSnapshots(TArray<StatSnapshot>& OutSnapshots) const; // Sorted by name
+        FString GetSnapshotJson() const;
+        void LogReport() const;
+
+        // Periodic dump from EndFrame - an empty path logs the report, otherwise one JSON line is appended per dump
+        void SetDumpInterval(float Seconds, const FString& FilePath = FString());
+        float GetDumpInterval() const { return m_DumpInterval; }
+
+        // Threads
+        void RetireThreadShard(StatsThreadShard& Shard); // Called on thread exit, frees the shard for reuse
+
+        static StatsThreadShard& GetThreadShard()
+        {
+            StatsThreadShard* Shard = t_Shard;
+            return Shard ? *Shard : Get().RegisterThreadShard();
+        }
+
+    private:
+        StatsRegistry();
+        ~StatsRegistry() = default;
+
+        StatsRegistry(const StatsRegistry&) = delete;
+        StatsRegistry& operator=(const StatsRegistry&) = delete;
+
+        struct HistogramLayout
+        {
+            double Min = 0.0;
+            double Max = 0.0;
+            double InverseBucketWidth = 0.0;
+            int32 BucketCount = 0;
+        };
+
+        // Merged state for one stat - owned by EndFrame and the snapshot getters
+        struct StatWindow
+        {
+            FString Name;
+            EStatType Type = EStatType::Counter;
+            int32 Slot = -1;
+            int32 SlotCount = 0;
+
+            int64 Total = 0;           // Counter total or histogram sample count since startup
+            int64 LastFrame = 0;
+            double LastValue = 0.0;    // Gauge value at the last EndFrame
+            double MergedSum = 0.0;    // Histogram sample sum as of the last merge
+
+            // One entry per frame in the window - counter deltas, gauge samples, histogram sample counts
+            TArray<int64> FrameCounts;
+            TArray<double> FrameValues;
+            TArray<int64> FrameBuckets; // Histogram only, BucketCount + 2 per frame
+            TArray<int64> WindowBuckets;
+        };
+
+        // Registration
+        mutable std::mutex m_RegistryMutex;
+        TMap<FString, int32> m_StatNames;
+        TArray<StatWindow> m_Stats;
+        int32 m_NextSlot;
+        HistogramLayout m_Histograms[MaxStats];
+        std::atomic<double> m_Gauges[MaxStats];
+
+        // Shards - live as long as the registry and are reused after their thread exits
+        mutable std::mutex m_ShardMutex;
+        TArray<std::unique_ptr<StatsThreadShard>> m_Shards;
+        std::unique_ptr<int64[]> m_MergedSlots; // Slot totals as of the last merge
+
+        // Windows
+        uint64 m_FrameNumber;
+        int32 m_WindowFrames;
+        int32 m_WindowCursor;
+        int32 m_WindowFilled;
+        TArray<float> m_FrameSeconds;
+
+        // Dump
+        float m_DumpInterval;
+        float m_TimeSinceDump;
+        FString m_DumpPath;
+
+        // Helper functions
+        StatId RegisterStat(const FString& Name, EStatType Type, int32 SlotCount, const HistogramLayout* Layout);
+        StatsThreadShard& RegisterThreadShard();
+        void ResetWindow(StatWindow& Stat);
+        StatSnapshot BuildSnapshot(const StatWindow& Stat, int32 Index) const;
+        void Dump();
+
+        static thread_local StatsThreadShard* t_Shard;
+        static StatsRegistry* s_Instance;
+    };
+}
+
+// Global access macros
+#define STATS UE4SDK::StatsRegistry::Get()
+#define STATS_END_FRAME(DeltaTime) UE4SDK::StatsRegistry::Get().EndFrame(DeltaTime)
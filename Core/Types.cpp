@@ -155,177 +155,32 @@ namespace UE4SDK
         return *this;
     }
 
-    // FVector implementation
-    bool FVector::operator==(const FVector& Other) const
-    {
-        return X == Other.X && Y == Other.Y && Z == Other.Z;
-    }
-    
-    bool FVector::operator!=(const FVector& Other) const
-    {
-        return !(*this == Other);
-    }
-    
-    FVector FVector::operator+(const FVector& Other) const
-    {
-        return FVector(X + Other.X, Y + Other.Y, Z + Other.Z);
-    }
-    
-    FVector FVector::operator-(const FVector& Other) const
-    {
-        return FVector(X - Other.X, Y - Other.Y, Z - Other.Z);
-    }
-    
-    FVector FVector::operator*(const FVector& Other) const
-    {
-        return FVector(X * Other.X, Y * Other.Y, Z * Other.Z);
-    }
-    
-    FVector FVector::operator*(float Scale) const
-    {
-        return FVector(X * Scale, Y * Scale, Z * Scale);
-    }
-    
-    FVector FVector::operator/(const FVector& Other) const
-    {
-        return FVector(X / Other.X, Y / Other.Y, Z / Other.Z);
-    }
-    
-    FVector FVector::operator/(float Scale) const
-    {
-        return FVector(X / Scale, Y / Scale, Z / Scale);
-    }
-    
-    FVector FVector::operator-() const
-    {
-        return FVector(-X, -Y, -Z);
-    }
-    
-    FVector& FVector::operator+=(const FVector& Other)
-    {
-        X += Other.X; Y += Other.Y; Z += Other.Z;
-        return *this;
-    }
-    
-    FVector& FVector::operator-=(const FVector& Other)
-    {
-        X -= Other.X; Y -= Other.Y; Z -= Other.Z;
-        return *this;
-    }
-    
-    FVector& FVector::operator*=(const FVector& Other)
-    {
-        X *= Other.X; Y *= Other.Y; Z *= Other.Z;
-        return *this;
-    }
-    
-    FVector& FVector::operator*=(float Scale)
-    {
-        X *= Scale; Y *= Scale; Z *= Scale;
-        return *this;
-    }
-    
-    FVector& FVector::operator/=(const FVector& Other)
-    {
-        X /= Other.X; Y /= Other.Y; Z /= Other.Z;
-        return *this;
-    }
-    
-    FVector& FVector::operator/=(float Scale)
-    {
-        X /= Scale; Y /= Scale; Z /= Scale;
-        return *this;
-    }
-    
-    float FVector::operator|(const FVector& Other) const
-    {
-        return X * Other.X + Y * Other.Y + Z * Other.Z;
-    }
-    
-    FVector FVector::operator^(const FVector& Other) const
-    {
-        return FVector(
-            Y * Other.Z - Z * Other.Y,
-            Z * Other.X - X * Other.Z,
-            X * Other.Y - Y * Other.X
-        );
-    }
-    
-    float FVector::Size() const
-    {
-        return std::sqrt(X * X + Y * Y + Z * Z);
-    }
-    
-    float FVector::SizeSquared() const
-    {
-        return X * X + Y * Y + Z * Z;
-    }
-    
-    float FVector::Size2D() const
-    {
-        return std::sqrt(X * X + Y * Y);
-    }
-    
-    float FVector::SizeSquared2D() const
-    {
-        return X * X + Y * Y;
-    }
-    
-    FVector FVector::GetSafeNormal(float Tolerance) const
-    {
-        float SquareSum = SizeSquared();
-        if (SquareSum < Tolerance) return FVector::ZeroVector;
-        return *this * (1.0f / std::sqrt(SquareSum));
-    }
-    
-    FVector FVector::GetUnsafeNormal() const
-    {
-        float SquareSum = SizeSquared();
-        return *this * (1.0f / std::sqrt(SquareSum));
-    }
-    
-    bool FVector::IsNearlyZero(float Tolerance) const
-    {
-        return SizeSquared() < Tolerance * Tolerance;
-    }
-    
-    bool FVector::IsZero() const
-    {
-        return X == 0.0f && Y == 0.0f && Z == 0.0f;
-    }
-    
-    bool FVector::IsUnit(float LengthSquaredTolerance) const
-    {
-        return std::abs(SizeSquared() - 1.0f) < LengthSquaredTolerance;
-    }
-    
-    bool FVector::ContainsNaN() const
+    // Math type string conversion - the math itself is inline in Types.h
+    FString FVector::ToString() const
     {
-        return std::isnan(X) || std::isnan(Y) || std::isnan(Z);
+        std::ostringstream oss;
+        oss << "X=" << X << " Y=" << Y << " Z=" << Z;
+        return FString(oss.str());
     }
     
-    bool FVector::IsFinite() const
+    FString FRotator::ToString() const
     {
-        return std::isfinite(X) && std::isfinite(Y) && std::isfinite(Z);
+        std::ostringstream oss;
+        oss << "Pitch=" << Pitch << " Yaw=" << Yaw << " Roll=" << Roll;
+        return FString(oss.str());
     }
     
-    FVector FVector::RotateAngleAxis(float AngleDeg, const FVector& Axis) const
+    FString FQuat::ToString() const
     {
-        float AngleRad = AngleDeg * (3.14159265359f / 180.0f);
-        float Cos = std::cos(AngleRad);
-        float Sin = std::sin(AngleRad);
-        
-        FVector NormalizedAxis = Axis.GetSafeNormal();
-        FVector Projected = *this - NormalizedAxis * (*this | NormalizedAxis);
-        FVector Perpendicular = NormalizedAxis ^ *this;
-        
-        return NormalizedAxis * (*this | NormalizedAxis) + Projected * Cos + Perpendicular * Sin;
+        std::ostringstream oss;
+        oss << "X=" << X << " Y=" << Y << " Z=" << Z << " W=" << W;
+        return FString(oss.str());
     }
     
-    FString FVector::ToString() const
+    FString FTransform::ToString() const
     {
         std::ostringstream oss;
-        oss << "X=" << X << " Y=" << Y << " Z=" << Z;
+        oss << "Rotation=" << *Rotation.ToString() << " Translation=" << *Translation.ToString() << " Scale3D=" << *Scale3D.ToString();
         return FString(oss.str());
     }
     
@@ -339,431 +194,12 @@ namespace UE4SDK
     const FVector FVector::RightVector(0.0f, 1.0f, 0.0f);
     const FVector FVector::LeftVector(0.0f, -1.0f, 0.0f);
 
-    // FRotator implementation
-    bool FRotator::operator==(const FRotator& Other) const
-    {
-        return Pitch == Other.Pitch && Yaw == Other.Yaw && Roll == Other.Roll;
-    }
-    
-    bool FRotator::operator!=(const FRotator& Other) const
-    {
-        return !(*this == Other);
-    }
-    
-    FRotator FRotator::operator+(const FRotator& Other) const
-    {
-        return FRotator(Pitch + Other.Pitch, Yaw + Other.Yaw, Roll + Other.Roll);
-    }
-    
-    FRotator FRotator::operator-(const FRotator& Other) const
-    {
-        return FRotator(Pitch - Other.Pitch, Yaw - Other.Yaw, Roll - Other.Roll);
-    }
-    
-    FRotator FRotator::operator*(const FRotator& Other) const
-    {
-        return FRotator(Pitch * Other.Pitch, Yaw * Other.Yaw, Roll * Other.Roll);
-    }
-    
-    FRotator FRotator::operator*(float Scale) const
-    {
-        return FRotator(Pitch * Scale, Yaw * Scale, Roll * Scale);
-    }
-    
-    FRotator FRotator::operator-() const
-    {
-        return FRotator(-Pitch, -Yaw, -Roll);
-    }
-    
-    FRotator& FRotator::operator+=(const FRotator& Other)
-    {
-        Pitch += Other.Pitch; Yaw += Other.Yaw; Roll += Other.Roll;
-        return *this;
-    }
-    
-    FRotator& FRotator::operator-=(const FRotator& Other)
-    {
-        Pitch -= Other.Pitch; Yaw -= Other.Yaw; Roll -= Other.Roll;
-        return *this;
-    }
-    
-    FRotator& FRotator::operator*=(const FRotator& Other)
-    {
-        Pitch *= Other.Pitch; Yaw *= Other.Yaw; Roll *= Other.Roll;
-        return *this;
-    }
-    
-    FRotator& FRotator::operator*=(float Scale)
-    {
-        Pitch *= Scale; Yaw *= Scale; Roll *= Scale;
-        return *this;
-    }
-    
-    bool FRotator::IsNearlyZero(float Tolerance) const
-    {
-        return std::abs(Pitch) < Tolerance && std::abs(Yaw) < Tolerance && std::abs(Roll) < Tolerance;
-    }
-    
-    bool FRotator::IsZero() const
-    {
-        return Pitch == 0.0f && Yaw == 0.0f && Roll == 0.0f;
-    }
-    
-    bool FRotator::ContainsNaN() const
-    {
-        return std::isnan(Pitch) || std::isnan(Yaw) || std::isnan(Roll);
-    }
-    
-    bool FRotator::IsFinite() const
-    {
-        return std::isfinite(Pitch) && std::isfinite(Yaw) && std::isfinite(Roll);
-    }
-    
-    FRotator FRotator::GetNormalized() const
-    {
-        return FRotator(
-            std::fmod(Pitch + 360.0f, 360.0f),
-            std::fmod(Yaw + 360.0f, 360.0f),
-            std::fmod(Roll + 360.0f, 360.0f)
-        );
-    }
-    
-    FRotator FRotator::GetDenormalized() const
-    {
-        return *this;
-    }
-    
-    FVector FRotator::Vector() const
-    {
-        float PitchRad = Pitch * (3.14159265359f / 180.0f);
-        float YawRad = Yaw * (3.14159265359f / 180.0f);
-        float RollRad = Roll * (3.14159265359f / 180.0f);
-        
-        float CP = std::cos(PitchRad);
-        float SP = std::sin(PitchRad);
-        float CY = std::cos(YawRad);
-        float SY = std::sin(YawRad);
-        float CR = std::cos(RollRad);
-        float SR = std::sin(RollRad);
-        
-        return FVector(
-            CP * CY,
-            CP * SY,
-            SP
-        );
-    }
-    
-    FVector FRotator::GetForwardVector() const
-    {
-        return Vector();
-    }
-    
-    FVector FRotator::GetRightVector() const
-    {
-        float YawRad = Yaw * (3.14159265359f / 180.0f);
-        return FVector(-std::sin(YawRad), std::cos(YawRad), 0.0f);
-    }
-    
-    FVector FRotator::GetUpVector() const
-    {
-        float PitchRad = Pitch * (3.14159265359f / 180.0f);
-        float YawRad = Yaw * (3.14159265359f / 180.0f);
-        return FVector(
-            -std::sin(PitchRad) * std::cos(YawRad),
-            -std::sin(PitchRad) * std::sin(YawRad),
-            std::cos(PitchRad)
-        );
-    }
-    
-    FString FRotator::ToString() const
-    {
-        std::ostringstream oss;
-        oss << "Pitch=" << Pitch << " Yaw=" << Yaw << " Roll=" << Roll;
-        return FString(oss.str());
-    }
-    
     // FRotator static constants
     const FRotator FRotator::ZeroRotator(0.0f, 0.0f, 0.0f);
 
-    // FQuat implementation
-    bool FQuat::operator==(const FQuat& Other) const
-    {
-        return X == Other.X && Y == Other.Y && Z == Other.Z && W == Other.W;
-    }
-    
-    bool FQuat::operator!=(const FQuat& Other) const
-    {
-        return !(*this == Other);
-    }
-    
-    FQuat FQuat::operator+(const FQuat& Other) const
-    {
-        return FQuat(X + Other.X, Y + Other.Y, Z + Other.Z, W + Other.W);
-    }
-    
-    FQuat FQuat::operator-(const FQuat& Other) const
-    {
-        return FQuat(X - Other.X, Y - Other.Y, Z - Other.Z, W - Other.W);
-    }
-    
-    FQuat FQuat::operator*(const FQuat& Other) const
-    {
-        return FQuat(
-            W * Other.X + X * Other.W + Y * Other.Z - Z * Other.Y,
-            W * Other.Y - X * Other.Z + Y * Other.W + Z * Other.X,
-            W * Other.Z + X * Other.Y - Y * Other.X + Z * Other.W,
-            W * Other.W - X * Other.X - Y * Other.Y - Z * Other.Z
-        );
-    }
-    
-    FQuat FQuat::operator*(float Scale) const
-    {
-        return FQuat(X * Scale, Y * Scale, Z * Scale, W * Scale);
-    }
-    
-    FQuat FQuat::operator-() const
-    {
-        return FQuat(-X, -Y, -Z, -W);
-    }
-    
-    FQuat& FQuat::operator+=(const FQuat& Other)
-    {
-        X += Other.X; Y += Other.Y; Z += Other.Z; W += Other.W;
-        return *this;
-    }
-    
-    FQuat& FQuat::operator-=(const FQuat& Other)
-    {
-        X -= Other.X; Y -= Other.Y; Z -= Other.Z; W -= Other.W;
-        return *this;
-    }
-    
-    FQuat& FQuat::operator*=(const FQuat& Other)
-    {
-        *this = *this * Other;
-        return *this;
-    }
-    
-    FQuat& FQuat::operator*=(float Scale)
-    {
-        X *= Scale; Y *= Scale; Z *= Scale; W *= Scale;
-        return *this;
-    }
-    
-    float FQuat::Size() const
-    {
-        return std::sqrt(X * X + Y * Y + Z * Z + W * W);
-    }
-    
-    float FQuat::SizeSquared() const
-    {
-        return X * X + Y * Y + Z * Z + W * W;
-    }
-    
-    FQuat FQuat::GetNormalized() const
-    {
-        float Size = Size();
-        if (Size == 0.0f) return FQuat::Identity;
-        return *this * (1.0f / Size);
-    }
-    
-    bool FQuat::IsNormalized() const
-    {
-        return std::abs(SizeSquared() - 1.0f) < 0.01f;
-    }
-    
-    bool FQuat::IsNearlyZero(float Tolerance) const
-    {
-        return SizeSquared() < Tolerance * Tolerance;
-    }
-    
-    bool FQuat::IsZero() const
-    {
-        return X == 0.0f && Y == 0.0f && Z == 0.0f && W == 0.0f;
-    }
-    
-    bool FQuat::ContainsNaN() const
-    {
-        return std::isnan(X) || std::isnan(Y) || std::isnan(Z) || std::isnan(W);
-    }
-    
-    bool FQuat::IsFinite() const
-    {
-        return std::isfinite(X) && std::isfinite(Y) && std::isfinite(Z) && std::isfinite(W);
-    }
-    
-    FVector FQuat::RotateVector(const FVector& V) const
-    {
-        FQuat VQuat(V.X, V.Y, V.Z, 0.0f);
-        FQuat Result = *this * VQuat * GetNormalized();
-        return FVector(Result.X, Result.Y, Result.Z);
-    }
-    
-    FVector FQuat::GetAxisX() const
-    {
-        return RotateVector(FVector::ForwardVector);
-    }
-    
-    FVector FQuat::GetAxisY() const
-    {
-        return RotateVector(FVector::RightVector);
-    }
-    
-    FVector FQuat::GetAxisZ() const
-    {
-        return RotateVector(FVector::UpVector);
-    }
-    
-    FString FQuat::ToString() const
-    {
-        std::ostringstream oss;
-        oss << "X=" << X << " Y=" << Y << " Z=" << Z << " W=" << W;
-        return FString(oss.str());
-    }
-    
     // FQuat static constants
     const FQuat FQuat::Identity(0.0f, 0.0f, 0.0f, 1.0f);
 
-    // FTransform implementation
-    FTransform::FTransform(const FRotator& InRotation, const FVector& InTranslation, const FVector& InScale3D)
-        : Rotation(InRotation), Translation(InTranslation), Scale3D(InScale3D)
-    {
-        // Convert rotator to quaternion
-        float PitchRad = InRotation.Pitch * (3.14159265359f / 180.0f);
-        float YawRad = InRotation.Yaw * (3.14159265359f / 180.0f);
-        float RollRad = InRotation.Roll * (3.14159265359f / 180.0f);
-        
-        float CP = std::cos(PitchRad * 0.5f);
-        float SP = std::sin(PitchRad * 0.5f);
-        float CY = std::cos(YawRad * 0.5f);
-        float SY = std::sin(YawRad * 0.5f);
-        float CR = std::cos(RollRad * 0.5f);
-        float SR = std::sin(RollRad * 0.5f);
-        
-        Rotation = FQuat(
-            CR * CP * CY + SR * SP * SY,
-            CR * CP * SY - SR * SP * CY,
-            CR * SP * CY + SR * CP * SY,
-            SR * CP * CY - CR * SP * SY
-        );
-    }
-    
-    bool FTransform::operator==(const FTransform& Other) const
-    {
-        return Rotation == Other.Rotation && Translation == Other.Translation && Scale3D == Other.Scale3D;
-    }
-    
-    bool FTransform::operator!=(const FTransform& Other) const
-    {
-        return !(*this == Other);
-    }
-    
-    FTransform FTransform::operator*(const FTransform& Other) const
-    {
-        FTransform Result;
-        Result.Rotation = Rotation * Other.Rotation;
-        Result.Translation = Translation + Rotation.RotateVector(Other.Translation * Scale3D);
-        Result.Scale3D = Scale3D * Other.Scale3D;
-        return Result;
-    }
-    
-    FTransform& FTransform::operator*=(const FTransform& Other)
-    {
-        *this = *this * Other;
-        return *this;
-    }
-    
-    FVector FTransform::TransformPosition(const FVector& V) const
-    {
-        return Translation + Rotation.RotateVector(V * Scale3D);
-    }
-    
-    FVector FTransform::TransformVector(const FVector& V) const
-    {
-        return Rotation.RotateVector(V * Scale3D);
-    }
-    
-    FVector FTransform::TransformVectorNoScale(const FVector& V) const
-    {
-        return Rotation.RotateVector(V);
-    }
-    
-    FVector FTransform::InverseTransformPosition(const FVector& V) const
-    {
-        return Rotation.GetNormalized().RotateVector(V - Translation) / Scale3D;
-    }
-    
-    FVector FTransform::InverseTransformVector(const FVector& V) const
-    {
-        return Rotation.GetNormalized().RotateVector(V) / Scale3D;
-    }
-    
-    FVector FTransform::InverseTransformVectorNoScale(const FVector& V) const
-    {
-        return Rotation.GetNormalized().RotateVector(V);
-    }
-    
-    FTransform FTransform::GetRelativeTransform(const FTransform& Other) const
-    {
-        FTransform Result;
-        Result.Rotation = Other.Rotation.GetNormalized() * Rotation;
-        Result.Translation = Other.Rotation.GetNormalized().RotateVector(Translation - Other.Translation) / Other.Scale3D;
-        Result.Scale3D = Scale3D / Other.Scale3D;
-        return Result;
-    }
-    
-    FTransform FTransform::GetRelativeTransformReverse(const FTransform& Other) const
-    {
-        return Other.GetRelativeTransform(*this);
-    }
-    
-    FTransform FTransform::GetScaled(float InScale) const
-    {
-        return FTransform(Rotation, Translation, Scale3D * InScale);
-    }
-    
-    FTransform FTransform::GetScaled(const FVector& InScale) const
-    {
-        return FTransform(Rotation, Translation, Scale3D * InScale);
-    }
-    
-    FTransform FTransform::GetNormalized() const
-    {
-        return FTransform(Rotation.GetNormalized(), Translation, Scale3D);
-    }
-    
-    bool FTransform::IsRotationNormalized() const
-    {
-        return Rotation.IsNormalized();
-    }
-    
-    bool FTransform::IsTranslationValid() const
-    {
-        return Translation.IsFinite();
-    }
-    
-    bool FTransform::IsScale3DValid() const
-    {
-        return Scale3D.IsFinite() && Scale3D.X > 0.0f && Scale3D.Y > 0.0f && Scale3D.Z > 0.0f;
-    }
-    
-    bool FTransform::ContainsNaN() const
-    {
-        return Rotation.ContainsNaN() || Translation.ContainsNaN() || Scale3D.ContainsNaN();
-    }
-    
-    bool FTransform::IsFinite() const
-    {
-        return Rotation.IsFinite() && Translation.IsFinite() && Scale3D.IsFinite();
-    }
-    
-    FString FTransform::ToString() const
-    {
-        std::ostringstream oss;
-        oss << "Rotation=" << Rotation.ToString() << " Translation=" << Translation.ToString() << " Scale3D=" << Scale3D.ToString();
-        return FString(oss.str());
-    }
-    
     // FTransform static constants
     const FTransform FTransform::Identity(FQuat::Identity, FVector::ZeroVector, FVector::OneVector);
 
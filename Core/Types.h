@@ -19,6 +19,11 @@
 #include <chrono>
 #include <random>
 
+// Build with UE4SDK_ENABLE_MEMORY_TRACKING=0 to give the containers plain std::allocator storage
+#ifndef UE4SDK_ENABLE_MEMORY_TRACKING
+    #define UE4SDK_ENABLE_MEMORY_TRACKING 1
+#endif
+
 namespace UE4SDK
 {
     // Basic types
@@ -110,53 +115,76 @@ namespace UE4SDK
         std::string m_Name;
     };
 
+    // Math types - everything on the per-frame path is defined inline here so hot loops can inline it.
+    // Only string conversion lives in Types.cpp. Batch kernels for many vectors are in VectorRegister.h.
+    constexpr float MathPi = 3.14159265359f;
+    constexpr float DegreesToRadians = MathPi / 180.0f;
+
     // Vector type
     class FVector
     {
     public:
         float X, Y, Z;
         
-        FVector() : X(0.0f), Y(0.0f), Z(0.0f) {}
-        FVector(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) {}
-        FVector(float InValue) : X(InValue), Y(InValue), Z(InValue) {}
-        
-        bool operator==(const FVector& Other) const;
-        bool operator!=(const FVector& Other) const;
-        
-        FVector operator+(const FVector& Other) const;
-        FVector operator-(const FVector& Other) const;
-        FVector operator*(const FVector& Other) const;
-        FVector operator*(float Scale) const;
-        FVector operator/(const FVector& Other) const;
-        FVector operator/(float Scale) const;
-        FVector operator-() const;
-        
-        FVector& operator+=(const FVector& Other);
-        FVector& operator-=(const FVector& Other);
-        FVector& operator*=(const FVector& Other);
-        FVector& operator*=(float Scale);
-        FVector& operator/=(const FVector& Other);
-        FVector& operator/=(float Scale);
-        
-        float operator|(const FVector& Other) const; // Dot product
-        FVector operator^(const FVector& Other) const; // Cross product
-        
-        float Size() const;
-        float SizeSquared() const;
-        float Size2D() const;
-        float SizeSquared2D() const;
-        
-        FVector GetSafeNormal(float Tolerance = 1e-8f) const;
-        FVector GetUnsafeNormal() const;
-        
-        bool IsNearlyZero(float Tolerance = 1e-8f) const;
-        bool IsZero() const;
-        bool IsUnit(float LengthSquaredTolerance = 1e-8f) const;
-        
-        bool ContainsNaN() const;
-        bool IsFinite() const;
-        
-        FVector RotateAngleAxis(float AngleDeg, const FVector& Axis) const;
+        constexpr FVector() : X(0.0f), Y(0.0f), Z(0.0f) {}
+        constexpr FVector(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) {}
+        constexpr FVector(float InValue) : X(InValue), Y(InValue), Z(InValue) {}
+        
+        constexpr bool operator==(const FVector& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z; }
+        constexpr bool operator!=(const FVector& Other) const { return !(*this == Other); }
+        
+        constexpr FVector operator+(const FVector& Other) const { return FVector(X + Other.X, Y + Other.Y, Z + Other.Z); }
+        constexpr FVector operator-(const FVector& Other) const { return FVector(X - Other.X, Y - Other.Y, Z - Other.Z); }
+        constexpr FVector operator*(const FVector& Other) const { return FVector(X * Other.X, Y * Other.Y, Z * Other.Z); }
+        constexpr FVector operator*(float Scale) const { return FVector(X * Scale, Y * Scale, Z * Scale); }
+        constexpr FVector operator/(const FVector& Other) const { return FVector(X / Other.X, Y / Other.Y, Z / Other.Z); }
+        constexpr FVector operator/(float Scale) const { return FVector(X / Scale, Y / Scale, Z / Scale); }
+        constexpr FVector operator-() const { return FVector(-X, -Y, -Z); }
+        
+        FVector& operator+=(const FVector& Other) { X += Other.X; Y += Other.Y; Z += Other.Z; return *this; }
+        FVector& operator-=(const FVector& Other) { X -= Other.X; Y -= Other.Y; Z -= Other.Z; return *this; }
+        FVector& operator*=(const FVector& Other) { X *= Other.X; Y *= Other.Y; Z *= Other.Z; return *this; }
+        FVector& operator*=(float Scale) { X *= Scale; Y *= Scale; Z *= Scale; return *this; }
+        FVector& operator/=(const FVector& Other) { X /= Other.X; Y /= Other.Y; Z /= Other.Z; return *this; }
+        FVector& operator/=(float Scale) { X /= Scale; Y /= Scale; Z /= Scale; return *this; }
+        
+        constexpr float operator|(const FVector& Other) const { return X * Other.X + Y * Other.Y + Z * Other.Z; } // Dot product
+        constexpr FVector operator^(const FVector& Other) const // Cross product
+        {
+            return FVector(Y * Other.Z - Z * Other.Y, Z * Other.X - X * Other.Z, X * Other.Y - Y * Other.X);
+        }
+        
+        float Size() const { return std::sqrt(SizeSquared()); }
+        constexpr float SizeSquared() const { return X * X + Y * Y + Z * Z; }
+        float Size2D() const { return std::sqrt(SizeSquared2D()); }
+        constexpr float SizeSquared2D() const { return X * X + Y * Y; }
+        
+        FVector GetSafeNormal(float Tolerance = 1e-8f) const
+        {
+            float SquareSum = SizeSquared();
+            return SquareSum < Tolerance ? FVector(0.0f) : *this * (1.0f / std::sqrt(SquareSum));
+        }
+        FVector GetUnsafeNormal() const { return *this * (1.0f / std::sqrt(SizeSquared())); }
+        
+        constexpr bool IsNearlyZero(float Tolerance = 1e-8f) const { return SizeSquared() < Tolerance * Tolerance; }
+        constexpr bool IsZero() const { return X == 0.0f && Y == 0.0f && Z == 0.0f; }
+        bool IsUnit(float LengthSquaredTolerance = 1e-8f) const { return std::abs(SizeSquared() - 1.0f) < LengthSquaredTolerance; }
+        
+        bool ContainsNaN() const { return std::isnan(X) || std::isnan(Y) || std::isnan(Z); }
+        bool IsFinite() const { return std::isfinite(X) && std::isfinite(Y) && std::isfinite(Z); }
+        
+        FVector RotateAngleAxis(float AngleDeg, const FVector& Axis) const
+        {
+            float AngleRad = AngleDeg * DegreesToRadians;
+            float Cos = std::cos(AngleRad);
+            float Sin = std::sin(AngleRad);
+            
+            FVector NormalizedAxis = Axis.GetSafeNormal();
+            FVector Projected = *this - NormalizedAxis * (*this | NormalizedAxis);
+            FVector Perpendicular = NormalizedAxis ^ *this;
+            
+            return NormalizedAxis * (*this | NormalizedAxis) + Projected * Cos + Perpendicular * Sin;
+        }
         
         FString ToString() const;
         
@@ -177,37 +205,55 @@ namespace UE4SDK
     public:
         float Pitch, Yaw, Roll;
         
-        FRotator() : Pitch(0.0f), Yaw(0.0f), Roll(0.0f) {}
-        FRotator(float InPitch, float InYaw, float InRoll) : Pitch(InPitch), Yaw(InYaw), Roll(InRoll) {}
-        FRotator(float InValue) : Pitch(InValue), Yaw(InValue), Roll(InValue) {}
-        
-        bool operator==(const FRotator& Other) const;
-        bool operator!=(const FRotator& Other) const;
-        
-        FRotator operator+(const FRotator& Other) const;
-        FRotator operator-(const FRotator& Other) const;
-        FRotator operator*(const FRotator& Other) const;
-        FRotator operator*(float Scale) const;
-        FRotator operator-() const;
-        
-        FRotator& operator+=(const FRotator& Other);
-        FRotator& operator-=(const FRotator& Other);
-        FRotator& operator*=(const FRotator& Other);
-        FRotator& operator*=(float Scale);
-        
-        bool IsNearlyZero(float Tolerance = 1e-8f) const;
-        bool IsZero() const;
-        
-        bool ContainsNaN() const;
-        bool IsFinite() const;
-        
-        FRotator GetNormalized() const;
-        FRotator GetDenormalized() const;
-        
-        FVector Vector() const;
-        FVector GetForwardVector() const;
-        FVector GetRightVector() const;
-        FVector GetUpVector() const;
+        constexpr FRotator() : Pitch(0.0f), Yaw(0.0f), Roll(0.0f) {}
+        constexpr FRotator(float InPitch, float InYaw, float InRoll) : Pitch(InPitch), Yaw(InYaw), Roll(InRoll) {}
+        constexpr FRotator(float InValue) : Pitch(InValue), Yaw(InValue), Roll(InValue) {}
+        
+        constexpr bool operator==(const FRotator& Other) const { return Pitch == Other.Pitch && Yaw == Other.Yaw && Roll == Other.Roll; }
+        constexpr bool operator!=(const FRotator& Other) const { return !(*this == Other); }
+        
+        constexpr FRotator operator+(const FRotator& Other) const { return FRotator(Pitch + Other.Pitch, Yaw + Other.Yaw, Roll + Other.Roll); }
+        constexpr FRotator operator-(const FRotator& Other) const { return FRotator(Pitch - Other.Pitch, Yaw - Other.Yaw, Roll - Other.Roll); }
+        constexpr FRotator operator*(const FRotator& Other) const { return FRotator(Pitch * Other.Pitch, Yaw * Other.Yaw, Roll * Other.Roll); }
+        constexpr FRotator operator*(float Scale) const { return FRotator(Pitch * Scale, Yaw * Scale, Roll * Scale); }
+        constexpr FRotator operator-() const { return FRotator(-Pitch, -Yaw, -Roll); }
+        
+        FRotator& operator+=(const FRotator& Other) { Pitch += Other.Pitch; Yaw += Other.Yaw; Roll += Other.Roll; return *this; }
+        FRotator& operator-=(const FRotator& Other) { Pitch -= Other.Pitch; Yaw -= Other.Yaw; Roll -= Other.Roll; return *this; }
+        FRotator& operator*=(const FRotator& Other) { Pitch *= Other.Pitch; Yaw *= Other.Yaw; Roll *= Other.Roll; return *this; }
+        FRotator& operator*=(float Scale) { Pitch *= Scale; Yaw *= Scale; Roll *= Scale; return *this; }
+        
+        bool IsNearlyZero(float Tolerance = 1e-8f) const { return std::abs(Pitch) < Tolerance && std::abs(Yaw) < Tolerance && std::abs(Roll) < Tolerance; }
+        constexpr bool IsZero() const { return Pitch == 0.0f && Yaw == 0.0f && Roll == 0.0f; }
+        
+        bool ContainsNaN() const { return std::isnan(Pitch) || std::isnan(Yaw) || std::isnan(Roll); }
+        bool IsFinite() const { return std::isfinite(Pitch) && std::isfinite(Yaw) && std::isfinite(Roll); }
+        
+        FRotator GetNormalized() const
+        {
+            return FRotator(std::fmod(Pitch + 360.0f, 360.0f), std::fmod(Yaw + 360.0f, 360.0f), std::fmod(Roll + 360.0f, 360.0f));
+        }
+        constexpr FRotator GetDenormalized() const { return *this; }
+        
+        FVector Vector() const
+        {
+            float PitchRad = Pitch * DegreesToRadians;
+            float YawRad = Yaw * DegreesToRadians;
+            float CP = std::cos(PitchRad);
+            return FVector(CP * std::cos(YawRad), CP * std::sin(YawRad), std::sin(PitchRad));
+        }
+        FVector GetForwardVector() const { return Vector(); }
+        FVector GetRightVector() const
+        {
+            float YawRad = Yaw * DegreesToRadians;
+            return FVector(-std::sin(YawRad), std::cos(YawRad), 0.0f);
+        }
+        FVector GetUpVector() const
+        {
+            float PitchRad = Pitch * DegreesToRadians;
+            float YawRad = Yaw * DegreesToRadians;
+            return FVector(-std::sin(PitchRad) * std::cos(YawRad), -std::sin(PitchRad) * std::sin(YawRad), std::cos(PitchRad));
+        }
         
         FString ToString() const;
         
@@ -221,46 +267,119 @@ namespace UE4SDK
     public:
         float X, Y, Z, W;
         
-        FQuat() : X(0.0f), Y(0.0f), Z(0.0f), W(1.0f) {}
-        FQuat(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
-        
-        bool operator==(const FQuat& Other) const;
-        bool operator!=(const FQuat& Other) const;
-        
-        FQuat operator+(const FQuat& Other) const;
-        FQuat operator-(const FQuat& Other) const;
-        FQuat operator*(const FQuat& Other) const;
-        FQuat operator*(float Scale) const;
-        FQuat operator-() const;
-        
-        FQuat& operator+=(const FQuat& Other);
-        FQuat& operator-=(const FQuat& Other);
-        FQuat& operator*=(const FQuat& Other);
-        FQuat& operator*=(float Scale);
-        
-        float Size() const;
-        float SizeSquared() const;
-        
-        FQuat GetNormalized() const;
-        bool IsNormalized() const;
-        
-        bool IsNearlyZero(float Tolerance = 1e-8f) const;
-        bool IsZero() const;
-        
-        bool ContainsNaN() const;
-        bool IsFinite() const;
-        
-        FVector RotateVector(const FVector& V) const;
-        FVector GetAxisX() const;
-        FVector GetAxisY() const;
-        FVector GetAxisZ() const;
+        constexpr FQuat() : X(0.0f), Y(0.0f), Z(0.0f), W(1.0f) {}
+        constexpr FQuat(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+        explicit FQuat(const FRotator& Rotator)
+        {
+            float CP = std::cos(Rotator.Pitch * DegreesToRadians * 0.5f);
+            float SP = std::sin(Rotator.Pitch * DegreesToRadians * 0.5f);
+            float CY = std::cos(Rotator.Yaw * DegreesToRadians * 0.5f);
+            float SY = std::sin(Rotator.Yaw * DegreesToRadians * 0.5f);
+            float CR = std::cos(Rotator.Roll * DegreesToRadians * 0.5f);
+            float SR = std::sin(Rotator.Roll * DegreesToRadians * 0.5f);
+            
+            X = CR * SP * SY - SR * CP * CY;
+            Y = -CR * SP * CY - SR * CP * SY;
+            Z = CR * CP * SY - SR * SP * CY;
+            W = CR * CP * CY + SR * SP * SY;
+        }
+        
+        constexpr bool operator==(const FQuat& Other) const { return X == Other.X && Y == Other.Y && Z == Other.Z && W == Other.W; }
+        constexpr bool operator!=(const FQuat& Other) const { return !(*this == Other); }
+        
+        constexpr FQuat operator+(const FQuat& Other) const { return FQuat(X + Other.X, Y + Other.Y, Z + Other.Z, W + Other.W); }
+        constexpr FQuat operator-(const FQuat& Other) const { return FQuat(X - Other.X, Y - Other.Y, Z - Other.Z, W - Other.W); }
+        constexpr FQuat operator*(const FQuat& Other) const
+        {
+            return FQuat(W * Other.X + X * Other.W + Y * Other.Z - Z * Other.Y,
+                         W * Other.Y - X * Other.Z + Y * Other.W + Z * Other.X,
+                         W * Other.Z + X * Other.Y - Y * Other.X + Z * Other.W,
+                         W * Other.W - X * Other.X - Y * Other.Y - Z * Other.Z);
+        }
+        constexpr FQuat operator*(float Scale) const { return FQuat(X * Scale, Y * Scale, Z * Scale, W * Scale); }
+        constexpr FQuat operator-() const { return FQuat(-X, -Y, -Z, -W); }
+        
+        FQuat& operator+=(const FQuat& Other) { X += Other.X; Y += Other.Y; Z += Other.Z; W += Other.W; return *this; }
+        FQuat& operator-=(const FQuat& Other) { X -= Other.X; Y -= Other.Y; Z -= Other.Z; W -= Other.W; return *this; }
+        FQuat& operator*=(const FQuat& Other) { *this = *this * Other; return *this; }
+        FQuat& operator*=(float Scale) { X *= Scale; Y *= Scale; Z *= Scale; W *= Scale; return *this; }
+        
+        constexpr float operator|(const FQuat& Other) const { return X * Other.X + Y * Other.Y + Z * Other.Z + W * Other.W; } // Dot product
+        
+        float Size() const { return std::sqrt(SizeSquared()); }
+        constexpr float SizeSquared() const { return X * X + Y * Y + Z * Z + W * W; }
+        
+        FQuat GetNormalized() const
+        {
+            float Length = Size();
+            return Length == 0.0f ? FQuat() : *this * (1.0f / Length);
+        }
+        bool IsNormalized() const { return std::abs(SizeSquared() - 1.0f) < 0.01f; }
+        
+        // Inverse of a unit quaternion
+        constexpr FQuat Inverse() const { return FQuat(-X, -Y, -Z, W); }
+        
+        constexpr bool IsNearlyZero(float Tolerance = 1e-8f) const { return SizeSquared() < Tolerance * Tolerance; }
+        constexpr bool IsZero() const { return X == 0.0f && Y == 0.0f && Z == 0.0f && W == 0.0f; }
+        
+        bool ContainsNaN() const { return std::isnan(X) || std::isnan(Y) || std::isnan(Z) || std::isnan(W); }
+        bool IsFinite() const { return std::isfinite(X) && std::isfinite(Y) && std::isfinite(Z) && std::isfinite(W); }
+        
+        // q * v * q^-1 expanded - T = 2(q x v), v' = v + wT + q x T. Assumes a unit quaternion.
+        constexpr FVector RotateVector(const FVector& V) const
+        {
+            return RotateVectorWithT(V, FVector(2.0f * (Y * V.Z - Z * V.Y), 2.0f * (Z * V.X - X * V.Z), 2.0f * (X * V.Y - Y * V.X)));
+        }
+        constexpr FVector UnrotateVector(const FVector& V) const { return Inverse().RotateVector(V); }
+        constexpr FVector GetAxisX() const { return RotateVector(FVector(1.0f, 0.0f, 0.0f)); }
+        constexpr FVector GetAxisY() const { return RotateVector(FVector(0.0f, 1.0f, 0.0f)); }
+        constexpr FVector GetAxisZ() const { return RotateVector(FVector(0.0f, 0.0f, 1.0f)); }
         
         FString ToString() const;
         
+        // Shortest path spherical interpolation, Alpha past 1 extrapolates along the same arc
+        static FQuat Slerp(const FQuat& A, const FQuat& B, float Alpha)
+        {
+            // q and -q are the same rotation, flipping B keeps the blend on the short arc
+            float RawCosom = A | B;
+            float Cosom = std::abs(RawCosom);
+            
+            float Scale0, Scale1;
+            if (Cosom < 0.9999f)
+            {
+                float Omega = std::acos(Cosom);
+                float InvSin = 1.0f / std::sin(Omega);
+                Scale0 = std::sin((1.0f - Alpha) * Omega) * InvSin;
+                Scale1 = std::sin(Alpha * Omega) * InvSin;
+            }
+            else
+            {
+                // Nearly identical, linear is accurate and avoids dividing by sin(~0)
+                Scale0 = 1.0f - Alpha;
+                Scale1 = Alpha;
+            }
+            Scale1 = RawCosom >= 0.0f ? Scale1 : -Scale1;
+            
+            return FQuat(Scale0 * A.X + Scale1 * B.X,
+                         Scale0 * A.Y + Scale1 * B.Y,
+                         Scale0 * A.Z + Scale1 * B.Z,
+                         Scale0 * A.W + Scale1 * B.W).GetNormalized();
+        }
+        
         // Static constants
         static const FQuat Identity;
+        
+    private:
+        constexpr FVector RotateVectorWithT(const FVector& V, const FVector& T) const
+        {
+            return FVector(V.X + W * T.X + (Y * T.Z - Z * T.Y),
+                           V.Y + W * T.Y + (Z * T.X - X * T.Z),
+                           V.Z + W * T.Z + (X * T.Y - Y * T.X));
+        }
     };
 
+    class FMatrix; // Core/Matrix.h
+
     // Transform type
     class FTransform
     {
@@ -269,37 +388,62 @@ namespace UE4SDK
         FVector Translation;
         FVector Scale3D;
         
-        FTransform() : Rotation(FQuat::Identity), Translation(FVector::ZeroVector), Scale3D(FVector::OneVector) {}
-        FTransform(const FQuat& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector::OneVector)
+        constexpr FTransform() : Rotation(), Translation(0.0f), Scale3D(1.0f) {}
+        constexpr FTransform(const FQuat& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector(1.0f))
             : Rotation(InRotation), Translation(InTranslation), Scale3D(InScale3D) {}
-        FTransform(const FRotator& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector::OneVector);
-        
-        bool operator==(const FTransform& Other) const;
-        bool operator!=(const FTransform& Other) const;
-        
-        FTransform operator*(const FTransform& Other) const;
-        FTransform& operator*=(const FTransform& Other);
-        
-        FVector TransformPosition(const FVector& V) const;
-        FVector TransformVector(const FVector& V) const;
-        FVector TransformVectorNoScale(const FVector& V) const;
-        FVector InverseTransformPosition(const FVector& V) const;
-        FVector InverseTransformVector(const FVector& V) const;
-        FVector InverseTransformVectorNoScale(const FVector& V) const;
-        
-        FTransform GetRelativeTransform(const FTransform& Other) const;
-        FTransform GetRelativeTransformReverse(const FTransform& Other) const;
-        
-        FTransform GetScaled(float InScale) const;
-        FTransform GetScaled(const FVector& InScale) const;
-        FTransform GetNormalized() const;
-        
-        bool IsRotationNormalized() const;
-        bool IsTranslationValid() const;
-        bool IsScale3DValid() const;
-        
-        bool ContainsNaN() const;
-        bool IsFinite() const;
+        FTransform(const FRotator& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector(1.0f))
+            : Rotation(InRotation), Translation(InTranslation), Scale3D(InScale3D) {}
+        explicit FTransform(const FMatrix& Matrix) { SetFromMatrix(Matrix); }
+        
+        // Matrix conversion - defined in Matrix.cpp. SetFromMatrix expects no shear.
+        FMatrix ToMatrixWithScale() const;
+        FMatrix ToMatrixNoScale() const;
+        void SetFromMatrix(const FMatrix& Matrix);
+        
+        constexpr bool operator==(const FTransform& Other) const { return Rotation == Other.Rotation && Translation == Other.Translation && Scale3D == Other.Scale3D; }
+        constexpr bool operator!=(const FTransform& Other) const { return !(*this == Other); }
+        
+        // Parent * Child - Other applies first, the reverse of FMatrix. So (A * B).ToMatrixWithScale() is
+        // B.ToMatrixWithScale() * A.ToMatrixWithScale(), exact while A's scale is uniform.
+        constexpr FTransform operator*(const FTransform& Other) const
+        {
+            return FTransform(Rotation * Other.Rotation, Translation + Rotation.RotateVector(Other.Translation * Scale3D), Scale3D * Other.Scale3D);
+        }
+        FTransform& operator*=(const FTransform& Other) { *this = *this * Other; return *this; }
+        
+        constexpr FVector TransformPosition(const FVector& V) const { return Translation + Rotation.RotateVector(V * Scale3D); }
+        constexpr FVector TransformVector(const FVector& V) const { return Rotation.RotateVector(V * Scale3D); }
+        constexpr FVector TransformVectorNoScale(const FVector& V) const { return Rotation.RotateVector(V); }
+        constexpr FVector InverseTransformPosition(const FVector& V) const { return Rotation.UnrotateVector(V - Translation) / Scale3D; }
+        constexpr FVector InverseTransformVector(const FVector& V) const { return Rotation.UnrotateVector(V) / Scale3D; }
+        constexpr FVector InverseTransformVectorNoScale(const FVector& V) const { return Rotation.UnrotateVector(V); }
+        
+        constexpr FTransform GetRelativeTransform(const FTransform& Other) const
+        {
+            return FTransform(Other.Rotation.Inverse() * Rotation,
+                              Other.Rotation.UnrotateVector(Translation - Other.Translation) / Other.Scale3D,
+                              Scale3D / Other.Scale3D);
+        }
+        constexpr FTransform GetRelativeTransformReverse(const FTransform& Other) const { return Other.GetRelativeTransform(*this); }
+        
+        constexpr FTransform GetScaled(float InScale) const { return FTransform(Rotation, Translation, Scale3D * InScale); }
+        constexpr FTransform GetScaled(const FVector& InScale) const { return FTransform(Rotation, Translation, Scale3D * InScale); }
+        FTransform GetNormalized() const { return FTransform(Rotation.GetNormalized(), Translation, Scale3D); }
+        
+        // Sets this to A blended towards B - translation and scale lerp, rotation slerps
+        void Blend(const FTransform& A, const FTransform& B, float Alpha)
+        {
+            Rotation = FQuat::Slerp(A.Rotation, B.Rotation, Alpha);
+            Translation = A.Translation + (B.Translation - A.Translation) * Alpha;
+            Scale3D = A.Scale3D + (B.Scale3D - A.Scale3D) * Alpha;
+        }
+        
+        bool IsRotationNormalized() const { return Rotation.IsNormalized(); }
+        bool IsTranslationValid() const { return Translation.IsFinite(); }
+        bool IsScale3DValid() const { return Scale3D.IsFinite() && Scale3D.X > 0.0f && Scale3D.Y > 0.0f && Scale3D.Z > 0.0f; }
+        
+        bool ContainsNaN() const { return Rotation.ContainsNaN() || Translation.ContainsNaN() || Scale3D.ContainsNaN(); }
+        bool IsFinite() const { return Rotation.IsFinite() && Translation.IsFinite() && Scale3D.IsFinite(); }
         
         FString ToString() const;
         
@@ -381,6 +525,81 @@ namespace UE4SDK
         static const FColor Transparent;
     };
 
+    // Memory tags - the subsystem an allocation is charged to (MemoryTracker.h has the counters and reports)
+    enum class EMemoryTag : uint8
+    {
+        Default,      // Anything created outside a tag scope
+        UObject,
+        AI,
+        Blackboard,
+        Navigation,
+        Replication,
+        Network,
+        Tasks,
+        Diagnostics,  // Profiler, stats and logging
+        Count
+    };
+
+    // Tag new containers on this thread are charged to - set it with MEMORY_TAG_SCOPE
+    inline thread_local EMemoryTag t_MemoryTag = EMemoryTag::Default;
+
+    // Implemented in MemoryTracker.cpp
+    void TrackMemoryAllocation(EMemoryTag Tag, std::size_t Size);
+    void TrackMemoryFree(EMemoryTag Tag, std::size_t Size);
+
+    // Container allocator - takes the thread's tag when its container is created and charges every
+    // allocation to it. Move assignment and swap carry the tag along with the memory.
+    template<typename T>
+    class TTrackedAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        TTrackedAllocator() noexcept : m_Tag(t_MemoryTag) {}
+        explicit TTrackedAllocator(EMemoryTag Tag) noexcept : m_Tag(Tag) {}
+
+        template<typename U>
+        TTrackedAllocator(const TTrackedAllocator<U>& Other) noexcept : m_Tag(Other.GetTag()) {}
+
+        T* allocate(std::size_t Count)
+        {
+            T* Memory = std::allocator<T>().allocate(Count);
+            TrackMemoryAllocation(m_Tag, Count * sizeof(T));
+            return Memory;
+        }
+
+        void deallocate(T* Memory, std::size_t Count) noexcept
+        {
+            TrackMemoryFree(m_Tag, Count * sizeof(T));
+            std::allocator<T>().deallocate(Memory, Count);
+        }
+
+        // A copy is charged to the scope that makes it, not to the original's tag
+        TTrackedAllocator select_on_container_copy_construction() const { return TTrackedAllocator(); }
+
+        EMemoryTag GetTag() const { return m_Tag; }
+
+        template<typename U>
+        bool operator==(const TTrackedAllocator<U>& Other) const { return m_Tag == Other.GetTag(); }
+        template<typename U>
+        bool operator!=(const TTrackedAllocator<U>& Other) const { return m_Tag != Other.GetTag(); }
+
+    private:
+        EMemoryTag m_Tag;
+    };
+
+#if UE4SDK_ENABLE_MEMORY_TRACKING
+    template<typename T>
+    using TContainerAllocator = TTrackedAllocator<T>;
+#else
+    template<typename T>
+    using TContainerAllocator = std::allocator<T>;
+#endif
+
     // Container types
     template<typename T>
     class TArray
@@ -414,6 +633,9 @@ namespace UE4SDK
         template<typename... Args>
         T& Emplace(Args&&... Args) { m_Data.emplace_back(std::forward<Args>(Args)...); return m_Data.back(); }
         
+        T& Insert(const T& Item, IndexType Index) { return *m_Data.insert(m_Data.begin() + Index, Item); }
+        T& Insert(T&& Item, IndexType Index) { return *m_Data.insert(m_Data.begin() + Index, std::move(Item)); }
+        
         void RemoveAt(IndexType Index);
         void RemoveAtSwap(IndexType Index);
         bool Remove(const T& Item);
@@ -453,7 +675,7 @@ namespace UE4SDK
         auto end() const { return m_Data.end(); }
         
     private:
-        std::vector<T> m_Data;
+        std::vector<T, TContainerAllocator<T>> m_Data;
     };
 
     template<typename K, typename V>
@@ -500,7 +722,7 @@ namespace UE4SDK
         auto end() const { return m_Data.end(); }
         
     private:
-        std::map<K, V> m_Data;
+        std::map<K, V, std::less<K>, TContainerAllocator<std::pair<const K, V>>> m_Data;
     };
 
     template<typename T>
@@ -537,7 +759,7 @@ namespace UE4SDK
         auto end() const { return m_Data.end(); }
         
     private:
-        std::set<T> m_Data;
+        std::set<T, std::less<T>, TContainerAllocator<T>> m_Data;
     };
 
     // Enums
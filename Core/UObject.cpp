@@ -4,6 +4,7 @@
  */
 
 #include "UObject.h"
+#include "MemoryTracker.h"
 #include <algorithm>
 #include <cassert>
 
@@ -94,6 +95,20 @@ namespace UE4SDK
         BeginDestroy();
     }
 
+    void* UObject::operator new(std::size_t Size)
+    {
+        void* Memory = ::operator new(Size);
+        TrackMemoryAllocation(EMemoryTag::UObject, Size);
+        return Memory;
+    }
+
+    void UObject::operator delete(void* Memory, std::size_t Size)
+    {
+        // The destructor is virtual, so Size is the most derived class's size
+        TrackMemoryFree(EMemoryTag::UObject, Size);
+        ::operator delete(Memory, Size);
+    }
+
     void UObject::BeginDestroy()
     {
         if (m_State != EObjectState::Destroyed)
@@ -202,6 +217,7 @@ namespace UE4SDK
     {
         if (!s_Instance)
         {
+            MEMORY_TAG_SCOPE(UObject);
             s_Instance = new GObjects();
         }
         return *s_Instance;
@@ -209,6 +225,7 @@ namespace UE4SDK
 
     UObject* GObjects::CreateObject(const FString& ClassName, UObject* Outer, const FString& Name)
     {
+        MEMORY_TAG_SCOPE(UObject);
         UClass* Class = FindClass(ClassName);
         if (!Class)
         {
@@ -104,6 +104,10 @@ namespace UE4SDK
         UObject();
         virtual ~UObject();
 
+        // Every UObject and subclass is charged to EMemoryTag::UObject at its full size
+        static void* operator new(std::size_t Size);
+        static void operator delete(void* Memory, std::size_t Size);
+
         // Object info
         const FString& GetName() const { return m_Name; }
         void SetName(const FString& NewName) { m_Name = NewName; }
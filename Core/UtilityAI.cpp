@@ -0,0 +1,489 @@
+/*
+ * UE4 Utility AI Implementation - Self-contained utility-based action selection
+ * Vibe coder approved ✨
+ */
+
+#include "UtilityAI.h"
+#include "Utils.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define UE4SDK_UTILITY_SIMD 1
+#else
+    #define UE4SDK_UTILITY_SIMD 0
+#endif
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // Agents per job when scoring large batches
+        const int32 ScoreBatchSize = 256;
+
+        float ApplyCurveScalar(float Value, const UtilityConsideration& Consideration)
+        {
+            switch (Consideration.Curve)
+            {
+                case EResponseCurve::Linear:
+                    return Value;
+                case EResponseCurve::InverseLinear:
+                    return 1.0f - Value;
+                case EResponseCurve::EaseIn:
+                    return Utils::EaseIn(Value);
+                case EResponseCurve::EaseOut:
+                    return Utils::EaseOut(Value);
+                case EResponseCurve::EaseInOut:
+                    return Utils::EaseInOut(Value);
+                case EResponseCurve::SmoothStep:
+                    return Utils::SmoothStep(Value);
+                case EResponseCurve::Custom:
+                    return Consideration.CustomCurve ? Utils::Clamp(Consideration.CustomCurve(Value), 0.0f, 1.0f) : Value;
+            }
+            return Value;
+        }
+
+        // Scores agents [Begin, End) against every action, reading each blackboard key once per chunk
+        void ScoreRange(const UtilityActionSet& ActionSet, const TArray<Blackboard*>& Blackboards, TArray<float>& OutScores, int32 Begin, int32 End)
+        {
+            int32 AgentCount = Blackboards.Num();
+            int32 Count = End - Begin;
+
+            std::vector<float> Values(Count);
+            TMap<FString, std::vector<float>> InputCache;
+
+            for (int32 ActionIndex = 0; ActionIndex < ActionSet.GetActionCount(); ++ActionIndex)
+            {
+                UtilityAction* Action = ActionSet.GetAction(ActionIndex);
+                float* Scores = &OutScores[ActionIndex * AgentCount + Begin];
+                std::fill(Scores, Scores + Count, Action ? Action->GetWeight() : 0.0f);
+
+                if (!Action)
+                {
+                    continue;
+                }
+
+                for (const UtilityConsideration& Consideration : Action->GetConsiderations())
+                {
+                    // Gather the SoA input column for this key
+                    FString CacheKey = Consideration.KeyName + TEXT("#") + FString::FromInt(static_cast<int32>(Consideration.InputType));
+                    std::vector<float>* Inputs = InputCache.Find(CacheKey);
+                    if (!Inputs)
+                    {
+                        Inputs = &InputCache.Add(CacheKey, std::vector<float>(Count));
+                        for (int32 i = 0; i < Count; ++i)
+                        {
+                            (*Inputs)[i] = UtilityScorer::ReadInput(Blackboards[Begin + i], Consideration);
+                        }
+                    }
+
+                    UtilityScorer::NormalizeInputs(Inputs->data(), Values.data(), Count, Consideration.InputMin, Consideration.InputMax);
+                    UtilityScorer::ApplyCurve(Values.data(), Count, Consideration);
+                    UtilityScorer::MultiplyScores(Scores, Values.data(), Count);
+                }
+            }
+        }
+    }
+
+    // UtilityAction implementation
+    UtilityAction::UtilityAction()
+        : m_ActionName(TEXT("UnnamedAction"))
+        , m_Weight(1.0f)
+        , m_Task(nullptr)
+    {
+    }
+
+    // UtilityActionSet implementation
+    void UtilityActionSet::AddAction(UtilityAction* Action)
+    {
+        if (Action && !m_Actions.Contains(Action))
+        {
+            m_Actions.Add(Action);
+        }
+    }
+
+    UtilityAction* UtilityActionSet::GetAction(int32 Index) const
+    {
+        if (Index < 0 || Index >= m_Actions.Num())
+        {
+            return nullptr;
+        }
+        return m_Actions[Index];
+    }
+
+    // UtilityScorer implementation
+    void UtilityScorer::ScoreBatch(const UtilityActionSet& ActionSet, const TArray<Blackboard*>& Blackboards, TArray<float>& OutScores)
+    {
+        int32 ActionCount = ActionSet.GetActionCount();
+        int32 AgentCount = Blackboards.Num();
+        OutScores.SetNum(ActionCount * AgentCount);
+
+        if (ActionCount == 0 || AgentCount == 0)
+        {
+            return;
+        }
+
+        // Chunks write disjoint slices of every action row, so they can run in parallel
+        JobSystem::Get().ParallelFor(AgentCount, ScoreBatchSize, [&ActionSet, &Blackboards, &OutScores](int32 Begin, int32 End)
+        {
+            ScoreRange(ActionSet, Blackboards, OutScores, Begin, End);
+        });
+    }
+
+    void UtilityScorer::SelectBest(const TArray<float>& Scores, int32 ActionCount, int32 AgentCount, TArray<int32>& OutBestActions)
+    {
+        OutBestActions.SetNum(AgentCount);
+        for (int32 Agent = 0; Agent < AgentCount; ++Agent)
+        {
+            // Nothing scoring above zero means no action is worth taking
+            int32 BestAction = -1;
+            float BestScore = 0.0f;
+            for (int32 Action = 0; Action < ActionCount; ++Action)
+            {
+                float Score = Scores[Action * AgentCount + Agent];
+                if (Score > BestScore)
+                {
+                    BestScore = Score;
+                    BestAction = Action;
+                }
+            }
+            OutBestActions[Agent] = BestAction;
+        }
+    }
+
+    void UtilityScorer::NormalizeInputs(const float* Inputs, float* Outputs, int32 Count, float Min, float Max)
+    {
+        float Range = Max - Min;
+        float InvRange = Range != 0.0f ? 1.0f / Range : 0.0f;
+        int32 i = 0;
+
+#if UE4SDK_UTILITY_SIMD
+        __m128 MinVec = _mm_set1_ps(Min);
+        __m128 InvRangeVec = _mm_set1_ps(InvRange);
+        __m128 Zero = _mm_setzero_ps();
+        __m128 One = _mm_set1_ps(1.0f);
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m128 Value = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(Inputs + i), MinVec), InvRangeVec);
+            _mm_storeu_ps(Outputs + i, _mm_min_ps(_mm_max_ps(Value, Zero), One));
+        }
+#endif
+
+        for (; i < Count; ++i)
+        {
+            Outputs[i] = Utils::Clamp((Inputs[i] - Min) * InvRange, 0.0f, 1.0f);
+        }
+    }
+
+    void UtilityScorer::ApplyCurve(float* Values, int32 Count, const UtilityConsideration& Consideration)
+    {
+        if (Consideration.Curve == EResponseCurve::Linear)
+        {
+            return;
+        }
+
+        int32 i = 0;
+
+#if UE4SDK_UTILITY_SIMD
+        // Custom curves are arbitrary callables and always take the scalar path
+        if (Consideration.Curve != EResponseCurve::Custom)
+        {
+            __m128 One = _mm_set1_ps(1.0f);
+            __m128 Two = _mm_set1_ps(2.0f);
+            __m128 Three = _mm_set1_ps(3.0f);
+            __m128 Half = _mm_set1_ps(0.5f);
+
+            for (; i + 4 <= Count; i += 4)
+            {
+                __m128 X = _mm_loadu_ps(Values + i);
+                __m128 InvX = _mm_sub_ps(One, X);
+                __m128 Result = X;
+
+                switch (Consideration.Curve)
+                {
+                    case EResponseCurve::InverseLinear:
+                        Result = InvX;
+                        break;
+                    case EResponseCurve::EaseIn:
+                        Result = _mm_mul_ps(X, X);
+                        break;
+                    case EResponseCurve::EaseOut:
+                        Result = _mm_sub_ps(One, _mm_mul_ps(InvX, InvX));
+                        break;
+                    case EResponseCurve::EaseInOut:
+                    {
+                        __m128 Lower = _mm_mul_ps(Two, _mm_mul_ps(X, X));
+                        __m128 Upper = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_mul_ps(InvX, InvX)));
+                        __m128 Mask = _mm_cmplt_ps(X, Half);
+                        Result = _mm_or_ps(_mm_and_ps(Mask, Lower), _mm_andnot_ps(Mask, Upper));
+                        break;
+                    }
+                    case EResponseCurve::SmoothStep:
+                        Result = _mm_mul_ps(_mm_mul_ps(X, X), _mm_sub_ps(Three, _mm_mul_ps(Two, X)));
+                        break;
+                    default:
+                        break;
+                }
+
+                _mm_storeu_ps(Values + i, Result);
+            }
+        }
+#endif
+
+        for (; i < Count; ++i)
+        {
+            Values[i] = ApplyCurveScalar(Values[i], Consideration);
+        }
+    }
+
+    void UtilityScorer::MultiplyScores(float* Scores, const float* Values, int32 Count)
+    {
+        int32 i = 0;
+
+#if UE4SDK_UTILITY_SIMD
+        for (; i + 4 <= Count; i += 4)
+        {
+            _mm_storeu_ps(Scores + i, _mm_mul_ps(_mm_loadu_ps(Scores + i), _mm_loadu_ps(Values + i)));
+        }
+#endif
+
+        for (; i < Count; ++i)
+        {
+            Scores[i] *= Values[i];
+        }
+    }
+
+    float UtilityScorer::EvaluateCurve(float Value, const UtilityConsideration& Consideration)
+    {
+        return ApplyCurveScalar(Utils::Clamp(Value, 0.0f, 1.0f), Consideration);
+    }
+
+    float UtilityScorer::ReadInput(Blackboard* InBlackboard, const UtilityConsideration& Consideration)
+    {
+        if (!InBlackboard)
+        {
+            return 0.0f;
+        }
+
+        switch (Consideration.InputType)
+        {
+            case EConsiderationInput::Float:
+                return InBlackboard->GetValueAsFloat(Consideration.KeyName);
+            case EConsiderationInput::Int:
+                return static_cast<float>(InBlackboard->GetValueAsInt(Consideration.KeyName));
+            case EConsiderationInput::Bool:
+                return InBlackboard->GetValueAsBool(Consideration.KeyName) ? 1.0f : 0.0f;
+        }
+        return 0.0f;
+    }
+
+    bool UtilityScorer::IsSIMDEnabled()
+    {
+        return UE4SDK_UTILITY_SIMD != 0;
+    }
+
+    // UtilitySelectorTask implementation
+    UtilitySelectorTask::UtilitySelectorTask()
+        : m_ActionSet(nullptr)
+        , m_Blackboard(nullptr)
+        , m_CurrentAction(nullptr)
+        , m_CurrentActionIndex(-1)
+        , m_ReevaluationInterval(0.5f)
+        , m_SwitchThreshold(0.05f)
+        , m_TimeSinceEvaluation(0.0f)
+        , m_bHasBatchedScores(false)
+    {
+        SetTaskName(TEXT("UtilitySelector"));
+        UtilityAISystem::Get().RegisterSelector(this);
+    }
+
+    UtilitySelectorTask::~UtilitySelectorTask()
+    {
+        UtilityAISystem::Get().UnregisterSelector(this);
+    }
+
+    bool UtilitySelectorTask::NeedsEvaluation() const
+    {
+        return IsRunning() && m_ActionSet && (!m_CurrentAction || m_TimeSinceEvaluation >= m_ReevaluationInterval);
+    }
+
+    void UtilitySelectorTask::ReceiveScores(const float* Scores, int32 Stride, int32 ActionCount)
+    {
+        m_Scores.SetNum(ActionCount);
+        for (int32 i = 0; i < ActionCount; ++i)
+        {
+            m_Scores[i] = Scores[i * Stride];
+        }
+        m_bHasBatchedScores = true;
+    }
+
+    void UtilitySelectorTask::ExecuteTask(float DeltaTime)
+    {
+        if (!m_ActionSet || m_ActionSet->GetActionCount() == 0)
+        {
+            CompleteTask(false);
+            return;
+        }
+
+        m_TimeSinceEvaluation += DeltaTime;
+        if (!m_CurrentAction || m_TimeSinceEvaluation >= m_ReevaluationInterval)
+        {
+            Evaluate();
+        }
+
+        if (!m_CurrentAction)
+        {
+            // No action scored above zero
+            CompleteTask(false);
+            return;
+        }
+
+        AITask* Task = m_CurrentAction->GetTask();
+        if (!Task)
+        {
+            CompleteTask(true);
+            return;
+        }
+
+        Task->Update(DeltaTime);
+        if (Task->IsCompleted())
+        {
+            bool bSuccessful = Task->IsSuccessful();
+            m_CurrentAction = nullptr;
+            m_CurrentActionIndex = -1;
+            CompleteTask(bSuccessful);
+        }
+    }
+
+    void UtilitySelectorTask::Evaluate()
+    {
+        m_TimeSinceEvaluation = 0.0f;
+
+        if (!m_bHasBatchedScores)
+        {
+            // Missed the batched pass - score just this agent
+            TArray<Blackboard*> Blackboards;
+            Blackboards.Add(m_Blackboard);
+            UtilityScorer::ScoreBatch(*m_ActionSet, Blackboards, m_Scores);
+        }
+        m_bHasBatchedScores = false;
+
+        TArray<int32> BestActions;
+        UtilityScorer::SelectBest(m_Scores, m_ActionSet->GetActionCount(), 1, BestActions);
+        int32 BestIndex = BestActions[0];
+
+        if (BestIndex == m_CurrentActionIndex)
+        {
+            return;
+        }
+
+        // Hysteresis - don't flip between actions that score about the same
+        if (m_CurrentAction && BestIndex >= 0 && m_CurrentActionIndex < m_Scores.Num() &&
+            m_Scores[BestIndex] < m_Scores[m_CurrentActionIndex] + m_SwitchThreshold)
+        {
+            return;
+        }
+
+        SwitchToAction(BestIndex);
+    }
+
+    void UtilitySelectorTask::SwitchToAction(int32 ActionIndex)
+    {
+        if (m_CurrentAction && m_CurrentAction->GetTask() && m_CurrentAction->GetTask()->IsRunning())
+        {
+            m_CurrentAction->GetTask()->StopTask();
+        }
+
+        m_CurrentActionIndex = ActionIndex;
+        m_CurrentAction = m_ActionSet->GetAction(ActionIndex);
+
+        if (m_CurrentAction)
+        {
+            LOG_DEBUG(TEXT("UtilitySelector picked action: ") + m_CurrentAction->GetActionName());
+            if (m_CurrentAction->GetTask())
+            {
+                m_CurrentAction->GetTask()->StartTask();
+            }
+        }
+    }
+
+    // UtilityAISystem implementation
+    UtilityAISystem* UtilityAISystem::s_Instance = nullptr;
+
+    UtilityAISystem& UtilityAISystem::Get()
+    {
+        if (!s_Instance)
+        {
+            MEMORY_TAG_SCOPE(AI);
+            s_Instance = new UtilityAISystem();
+        }
+        return *s_Instance;
+    }
+
+    UtilityAISystem::UtilityAISystem()
+        : m_LastScoredAgentCount(0)
+    {
+    }
+
+    void UtilityAISystem::RegisterSelector(UtilitySelectorTask* Selector)
+    {
+        if (Selector && !m_Selectors.Contains(Selector))
+        {
+            m_Selectors.Add(Selector);
+        }
+    }
+
+    void UtilityAISystem::UnregisterSelector(UtilitySelectorTask* Selector)
+    {
+        m_Selectors.Remove(Selector);
+    }
+
+    void UtilityAISystem::Update()
+    {
+        PROFILE_SCOPE("UtilityAISystem::Update");
+        MEMORY_TAG_SCOPE(AI);
+
+        m_LastScoredAgentCount = 0;
+
+        // Group due selectors by action set so each set is scored in one batch
+        TMap<UtilityActionSet*, TArray<UtilitySelectorTask*>> Groups;
+        for (UtilitySelectorTask* Selector : m_Selectors)
+        {
+            if (Selector->NeedsEvaluation())
+            {
+                Groups.FindOrAdd(Selector->GetActionSet()).Add(Selector);
+            }
+        }
+
+        for (auto& Pair : Groups)
+        {
+            const TArray<UtilitySelectorTask*>& Selectors = Pair.second;
+
+            TArray<Blackboard*> Blackboards;
+            Blackboards.Reserve(Selectors.Num());
+            for (UtilitySelectorTask* Selector : Selectors)
+            {
+                Blackboards.Add(Selector->GetBlackboard());
+            }
+
+            TArray<float> Scores;
+            UtilityScorer::ScoreBatch(*Pair.first, Blackboards, Scores);
+
+            int32 AgentCount = Selectors.Num();
+            int32 ActionCount = Pair.first->GetActionCount();
+            for (int32 Agent = 0; Agent < AgentCount; ++Agent)
+            {
+                if (ActionCount > 0)
+                {
+                    Selectors[Agent]->ReceiveScores(&Scores[Agent], AgentCount, ActionCount);
+                }
+            }
+
+            m_LastScoredAgentCount += AgentCount;
+        }
+    }
+}
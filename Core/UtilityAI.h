@@ -0,0 +1,187 @@
+/*
+ * UE4 Utility AI - Self-contained utility-based action selection
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include "AI.h"
+#include <functional>
+
+namespace UE4SDK
+{
+    // Response curves - same shapes as the Utils easing family
+    enum class EResponseCurve : uint8
+    {
+        Linear = 0,
+        InverseLinear = 1,
+        EaseIn = 2,
+        EaseOut = 3,
+        EaseInOut = 4,
+        SmoothStep = 5,
+        Custom = 6
+    };
+
+    enum class EConsiderationInput : uint8
+    {
+        Float = 0,
+        Int = 1,
+        Bool = 2
+    };
+
+    // Consideration - maps one blackboard value through a response curve into [0, 1]
+    struct UtilityConsideration
+    {
+        FString KeyName;
+        EConsiderationInput InputType = EConsiderationInput::Float;
+        float InputMin = 0.0f;
+        float InputMax = 1.0f;
+        EResponseCurve Curve = EResponseCurve::Linear;
+        std::function<float(float)> CustomCurve; // Only used with EResponseCurve::Custom, always scalar
+    };
+
+    // Utility action - score is Weight times the product of its considerations
+    class UtilityAction
+    {
+    public:
+        UtilityAction();
+
+        // Action properties
+        void SetActionName(const FString& Name) { m_ActionName = Name; }
+        const FString& GetActionName() const { return m_ActionName; }
+        void SetWeight(float Weight) { m_Weight = Weight; }
+        float GetWeight() const { return m_Weight; }
+
+        // Task run while this action is selected
+        void SetTask(AITask* Task) { m_Task = Task; }
+        AITask* GetTask() const { return m_Task; }
+
+        // Considerations
+        void AddConsideration(const UtilityConsideration& Consideration) { m_Considerations.Add(Consideration); }
+        const TArray<UtilityConsideration>& GetConsiderations() const { return m_Considerations; }
+
+    private:
+        FString m_ActionName;
+        float m_Weight;
+        AITask* m_Task;
+        TArray<UtilityConsideration> m_Considerations;
+    };
+
+    // Utility action set - shared by every agent choosing between the same actions
+    class UtilityActionSet
+    {
+    public:
+        void SetSetName(const FString& Name) { m_SetName = Name; }
+        const FString& GetSetName() const { return m_SetName; }
+
+        void AddAction(UtilityAction* Action);
+        void RemoveAction(UtilityAction* Action) { m_Actions.Remove(Action); }
+        UtilityAction* GetAction(int32 Index) const;
+        const TArray<UtilityAction*>& GetActions() const { return m_Actions; }
+        int32 GetActionCount() const { return m_Actions.Num(); }
+
+    private:
+        FString m_SetName;
+        TArray<UtilityAction*> m_Actions;
+    };
+
+    // Utility scorer - scores agents x actions in batches over SoA inputs.
+    // Kernels use SSE when available and fall back to scalar loops otherwise.
+    class UtilityScorer
+    {
+    public:
+        // OutScores is laid out action-major: [ActionIndex * AgentCount + AgentIndex]
+        static void ScoreBatch(const UtilityActionSet& ActionSet, const TArray<Blackboard*>& Blackboards, TArray<float>& OutScores);
+        static void SelectBest(const TArray<float>& Scores, int32 ActionCount, int32 AgentCount, TArray<int32>& OutBestActions);
+
+        // Batch kernels
+        static void NormalizeInputs(const float* Inputs, float* Outputs, int32 Count, float Min, float Max);
+        static void ApplyCurve(float* Values, int32 Count, const UtilityConsideration& Consideration);
+        static void MultiplyScores(float* Scores, const float* Values, int32 Count);
+
+        // Scalar reference for a single value
+        static float EvaluateCurve(float Value, const UtilityConsideration& Consideration);
+        static float ReadInput(Blackboard* InBlackboard, const UtilityConsideration& Consideration);
+
+        static bool IsSIMDEnabled();
+    };
+
+    // Utility selector task - runs the best scoring action's task and re-evaluates as it goes
+    class UtilitySelectorTask : public AITask
+    {
+    public:
+        UtilitySelectorTask();
+        virtual ~UtilitySelectorTask();
+
+        // Setup
+        void SetActionSet(UtilityActionSet* ActionSet) { m_ActionSet = ActionSet; }
+        UtilityActionSet* GetActionSet() const { return m_ActionSet; }
+        void SetBlackboard(Blackboard* InBlackboard) { m_Blackboard = InBlackboard; }
+        Blackboard* GetBlackboard() const { return m_Blackboard; }
+
+        // Re-evaluation - a new action must beat the current one by SwitchThreshold to take over
+        void SetReevaluationInterval(float Interval) { m_ReevaluationInterval = Interval; }
+        float GetReevaluationInterval() const { return m_ReevaluationInterval; }
+        void SetSwitchThreshold(float Threshold) { m_SwitchThreshold = Threshold; }
+        float GetSwitchThreshold() const { return m_SwitchThreshold; }
+
+        // Selection state
+        UtilityAction* GetCurrentAction() const { return m_CurrentAction; }
+        bool NeedsEvaluation() const;
+
+        // Scores computed by UtilityAISystem's batched pass, one per action
+        void ReceiveScores(const float* Scores, int32 Stride, int32 ActionCount);
+
+        // Task execution
+        virtual void ExecuteTask(float DeltaTime) override;
+
+    private:
+        UtilityActionSet* m_ActionSet;
+        Blackboard* m_Blackboard;
+        UtilityAction* m_CurrentAction;
+        int32 m_CurrentActionIndex;
+        float m_ReevaluationInterval;
+        float m_SwitchThreshold;
+        float m_TimeSinceEvaluation;
+        TArray<float> m_Scores;
+        bool m_bHasBatchedScores;
+
+        // Helper functions
+        void Evaluate();
+        void SwitchToAction(int32 ActionIndex);
+    };
+
+    // Utility AI System - batches scoring for every running selector once per AI frame
+    class UtilityAISystem
+    {
+    public:
+        static UtilityAISystem& Get();
+
+        // Selector management
+        void RegisterSelector(UtilitySelectorTask* Selector);
+        void UnregisterSelector(UtilitySelectorTask* Selector);
+        int32 GetSelectorCount() const { return m_Selectors.Num(); }
+
+        // Scores every selector that is due, grouped by action set
+        void Update();
+
+        // Stats
+        int32 GetLastScoredAgentCount() const { return m_LastScoredAgentCount; }
+
+    private:
+        UtilityAISystem();
+        ~UtilityAISystem() = default;
+
+        UtilityAISystem(const UtilityAISystem&) = delete;
+        UtilityAISystem& operator=(const UtilityAISystem&) = delete;
+
+        TArray<UtilitySelectorTask*> m_Selectors;
+        int32 m_LastScoredAgentCount;
+
+        static UtilityAISystem* s_Instance;
+    };
+
+    // Global access macros
+    #define UTILITY_AI_SYSTEM UE4SDK::UtilityAISystem::Get()
+}
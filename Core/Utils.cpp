@@ -4,6 +4,8 @@
  */
 
 #include "Utils.h"
+#include "JobSystem.h"
+#include "Profiler.h"
 #include <chrono>
 #include <random>
 #include <sstream>
@@ -14,6 +16,20 @@
 
 namespace UE4SDK
 {
+    namespace
+    {
+        // Async helpers start the pool on first use rather than running inline
+        JobSystem& GetAsyncJobSystem()
+        {
+            JobSystem& Jobs = JobSystem::Get();
+            if (!Jobs.IsInitialized())
+            {
+                Jobs.Initialize();
+            }
+            return Jobs;
+        }
+    }
+
     Utils* Utils::s_Instance = nullptr;
 
     Utils& Utils::Get()
@@ -35,6 +51,7 @@ namespace UE4SDK
     {
         m_Timers.clear();
         m_Events.clear();
+        LogSystem::Get().Flush();
     }
 
     // Math utilities
@@ -408,9 +425,7 @@ namespace UE4SDK
 
     float Utils::GetTimeSinceStart()
     {
-        auto now = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_StartTime);
-        return duration.count() / 1000.0f;
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - Get().m_StartTime).count();
     }
 
     float Utils::GetDeltaTime()
@@ -429,10 +444,8 @@ namespace UE4SDK
 
     void Utils::SleepAsync(float Seconds, std::function<void()> Callback)
     {
-        std::thread([Seconds, Callback]() {
-            std::this_thread::sleep_for(std::chrono::duration<float>(Seconds));
-            Callback();
-        }).detach();
+        // A timer wheel entry instead of a sleeping thread per call
+        GetAsyncJobSystem().LaunchDelayed(Seconds, std::move(Callback));
     }
 
     // File utilities
@@ -611,21 +624,9 @@ namespace UE4SDK
     }
 
     // Logging utilities
-    void Utils::Log(const FString& Message, ELogVerbosity::Type Verbosity)
+    void Utils::Log(const FString& Message, ELogVerbosity Verbosity)
     {
-        const char* VerbosityName = "Log";
-        switch (Verbosity)
-        {
-            case ELogVerbosity::Fatal: VerbosityName = "Fatal"; break;
-            case ELogVerbosity::Error: VerbosityName = "Error"; break;
-            case ELogVerbosity::Warning: VerbosityName = "Warning"; break;
-            case ELogVerbosity::Display: VerbosityName = "Display"; break;
-            case ELogVerbosity::Log: VerbosityName = "Log"; break;
-            case ELogVerbosity::Verbose: VerbosityName = "Verbose"; break;
-            case ELogVerbosity::VeryVerbose: VerbosityName = "VeryVerbose"; break;
-        }
-        
-        printf("[%s] %s\n", VerbosityName, Message.c_str());
+        LogSystem::Get().Log(Verbosity, Message);
     }
 
     void Utils::LogWarning(const FString& Message)
@@ -651,39 +652,50 @@ namespace UE4SDK
     // Performance utilities
     void Utils::StartTimer(const FString& TimerName)
     {
-        m_Timers.Add(TimerName, GetTimeSinceStart());
+        Get().m_Timers.Add(TimerName, std::chrono::steady_clock::now());
     }
 
     float Utils::StopTimer(const FString& TimerName)
     {
-        float* StartTime = m_Timers.Find(TimerName);
-        if (StartTime)
-        {
-            float Elapsed = GetTimeSinceStart() - *StartTime;
-            m_Timers.Remove(TimerName);
-            return Elapsed;
-        }
-        return 0.0f;
+        float Elapsed = GetTimerElapsed(TimerName);
+        Get().m_Timers.Remove(TimerName);
+        return Elapsed;
     }
 
     float Utils::GetTimerElapsed(const FString& TimerName)
     {
-        float* StartTime = m_Timers.Find(TimerName);
+        const std::chrono::steady_clock::time_point* StartTime = Get().m_Timers.Find(TimerName);
         if (StartTime)
         {
-            return GetTimeSinceStart() - *StartTime;
+            return std::chrono::duration<float>(std::chrono::steady_clock::now() - *StartTime).count();
         }
         return 0.0f;
     }
 
     void Utils::ResetTimer(const FString& TimerName)
     {
-        m_Timers.Add(TimerName, GetTimeSinceStart());
+        StartTimer(TimerName);
     }
 
     bool Utils::IsTimerRunning(const FString& TimerName)
     {
-        return m_Timers.Contains(TimerName);
+        return Get().m_Timers.Contains(TimerName);
+    }
+
+    // Profiler zones - names must nest, a StopProfiler that doesn't match the innermost open one is ignored
+    void Utils::StartProfiler(const FString& ProfilerName)
+    {
+        Profiler::Get().BeginNamedZone(ProfilerName);
+    }
+
+    void Utils::StopProfiler(const FString& ProfilerName)
+    {
+        Profiler::Get().EndNamedZone(ProfilerName);
+    }
+
+    void Utils::LogProfilerResults()
+    {
+        Profiler::Get().LogReport();
     }
 
     // Platform utilities
@@ -769,6 +781,36 @@ namespace UE4SDK
         return m_Events.Contains(EventName);
     }
 
+    // Async utilities
+    void Utils::RunAsync(std::function<void()> Function)
+    {
+        GetAsyncJobSystem().Dispatch(std::move(Function));
+    }
+
+    void Utils::RunAsyncWithCallback(std::function<void()> Function, std::function<void()> Callback)
+    {
+        // The callback comes back on the game thread, like the engine's async helpers
+        JobSystem& Jobs = GetAsyncJobSystem();
+        Jobs.Then(Jobs.Launch(std::move(Function)), std::move(Callback), EJobThread::GameThread);
+    }
+
+    void Utils::RunOnGameThread(std::function<void()> Function)
+    {
+        JobSystem& Jobs = JobSystem::Get();
+        if (Jobs.IsGameThread())
+        {
+            Function();
+            return;
+        }
+        Jobs.Launch(std::move(Function), TArray<JobHandle>(), EJobThread::GameThread);
+    }
+
+    void Utils::RunOnRenderThread(std::function<void()> Function)
+    {
+        // There's no render thread in the SDK - game thread work is the closest match
+        RunOnGameThread(std::move(Function));
+    }
+
     // Helper functions
     FString Utils::GetRandomString(int32 Length)
     {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Types.h"
+#include "Logging.h"
 #include <chrono>
 #include <random>
 #include <sstream>
@@ -158,8 +159,8 @@ namespace UE4SDK
         static bool SaveBytesToFile(const TArray<uint8>& Bytes, const FString& FilePath);
         static TArray<uint8> LoadBytesFromFile(const FString& FilePath);
         
-        // Logging utilities
-        static void Log(const FString& Message, ELogVerbosity::Type Verbosity = ELogVerbosity::Log);
+        // Logging utilities - LogSystem filters and writes them, the LOG_ macros skip building filtered messages
+        static void Log(const FString& Message, ELogVerbosity Verbosity = ELogVerbosity::Log);
         static void LogWarning(const FString& Message);
         static void LogError(const FString& Message);
         static void LogInfo(const FString& Message);
@@ -311,7 +312,7 @@ namespace UE4SDK
         Utils& operator=(const Utils&) = delete;
         
         // Internal data
-        TMap<FString, float> m_Timers;
+        TMap<FString, std::chrono::steady_clock::time_point> m_Timers;
         TMap<FString, std::function<void()>> m_Events;
         std::chrono::steady_clock::time_point m_StartTime;
         std::mt19937 m_RandomGenerator;
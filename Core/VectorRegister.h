@@ -0,0 +1,290 @@
+/*
+ * UE4 Vector Register - Self-contained SIMD vector math and batch transform kernels
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+
+// SSE is used wherever the compiler guarantees it (always on x64), otherwise everything falls back to scalar code.
+// Define UE4SDK_DISABLE_SIMD to force the scalar path.
+#if !defined(UE4SDK_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define UE4SDK_SIMD_SSE 1
+    #include <xmmintrin.h>
+#else
+    #define UE4SDK_SIMD_SSE 0
+#endif
+
+namespace UE4SDK
+{
+    static_assert(sizeof(FVector) == sizeof(float) * 3, "Batch kernels read FVector arrays as packed floats");
+
+    // Four floats in a register - __m128 with SSE, a plain struct otherwise
+#if UE4SDK_SIMD_SSE
+    using VectorRegister = __m128;
+
+    inline VectorRegister MakeVectorRegister(float X, float Y, float Z, float W) { return _mm_setr_ps(X, Y, Z, W); }
+    inline VectorRegister VectorSetFloat1(float Value) { return _mm_set1_ps(Value); }
+    inline VectorRegister VectorLoad(const float* Data) { return _mm_loadu_ps(Data); }
+    inline void VectorStore(const VectorRegister& Vec, float* Data) { _mm_storeu_ps(Data, Vec); }
+
+    inline VectorRegister VectorAdd(const VectorRegister& A, const VectorRegister& B) { return _mm_add_ps(A, B); }
+    inline VectorRegister VectorSubtract(const VectorRegister& A, const VectorRegister& B) { return _mm_sub_ps(A, B); }
+    inline VectorRegister VectorMultiply(const VectorRegister& A, const VectorRegister& B) { return _mm_mul_ps(A, B); }
+    inline VectorRegister VectorMultiplyAdd(const VectorRegister& A, const VectorRegister& B, const VectorRegister& C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+    inline VectorRegister VectorMin(const VectorRegister& A, const VectorRegister& B) { return _mm_min_ps(A, B); }
+    inline VectorRegister VectorMax(const VectorRegister& A, const VectorRegister& B) { return _mm_max_ps(A, B); }
+    inline VectorRegister VectorSqrt(const VectorRegister& Vec) { return _mm_sqrt_ps(Vec); }
+
+    // Comparisons return all-ones lanes where true, VectorMaskBits packs lane i into bit i
+    inline VectorRegister VectorCompareLT(const VectorRegister& A, const VectorRegister& B) { return _mm_cmplt_ps(A, B); }
+    inline VectorRegister VectorCompareLE(const VectorRegister& A, const VectorRegister& B) { return _mm_cmple_ps(A, B); }
+    inline VectorRegister VectorBitwiseAnd(const VectorRegister& A, const VectorRegister& B) { return _mm_and_ps(A, B); }
+    inline VectorRegister VectorSelect(const VectorRegister& Mask, const VectorRegister& A, const VectorRegister& B) { return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B)); }
+    inline int32 VectorMaskBits(const VectorRegister& Mask) { return _mm_movemask_ps(Mask); }
+#else
+    struct VectorRegister
+    {
+        float V[4];
+    };
+
+    inline VectorRegister MakeVectorRegister(float X, float Y, float Z, float W) { return VectorRegister{ { X, Y, Z, W } }; }
+    inline VectorRegister VectorSetFloat1(float Value) { return VectorRegister{ { Value, Value, Value, Value } }; }
+    inline VectorRegister VectorLoad(const float* Data) { return VectorRegister{ { Data[0], Data[1], Data[2], Data[3] } }; }
+    inline void VectorStore(const VectorRegister& Vec, float* Data) { for (int32 i = 0; i < 4; ++i) Data[i] = Vec.V[i]; }
+
+    inline VectorRegister VectorAdd(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { A.V[0] + B.V[0], A.V[1] + B.V[1], A.V[2] + B.V[2], A.V[3] + B.V[3] } }; }
+    inline VectorRegister VectorSubtract(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { A.V[0] - B.V[0], A.V[1] - B.V[1], A.V[2] - B.V[2], A.V[3] - B.V[3] } }; }
+    inline VectorRegister VectorMultiply(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { A.V[0] * B.V[0], A.V[1] * B.V[1], A.V[2] * B.V[2], A.V[3] * B.V[3] } }; }
+    inline VectorRegister VectorMultiplyAdd(const VectorRegister& A, const VectorRegister& B, const VectorRegister& C) { return VectorAdd(VectorMultiply(A, B), C); }
+    inline VectorRegister VectorMin(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { std::min(A.V[0], B.V[0]), std::min(A.V[1], B.V[1]), std::min(A.V[2], B.V[2]), std::min(A.V[3], B.V[3]) } }; }
+    inline VectorRegister VectorMax(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { std::max(A.V[0], B.V[0]), std::max(A.V[1], B.V[1]), std::max(A.V[2], B.V[2]), std::max(A.V[3], B.V[3]) } }; }
+    inline VectorRegister VectorSqrt(const VectorRegister& Vec) { return VectorRegister{ { std::sqrt(Vec.V[0]), std::sqrt(Vec.V[1]), std::sqrt(Vec.V[2]), std::sqrt(Vec.V[3]) } }; }
+
+    // Comparisons - the scalar path stores 1/0 per lane instead of bit masks
+    inline VectorRegister VectorCompareLT(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { A.V[0] < B.V[0] ? 1.0f : 0.0f, A.V[1] < B.V[1] ? 1.0f : 0.0f, A.V[2] < B.V[2] ? 1.0f : 0.0f, A.V[3] < B.V[3] ? 1.0f : 0.0f } }; }
+    inline VectorRegister VectorCompareLE(const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { A.V[0] <= B.V[0] ? 1.0f : 0.0f, A.V[1] <= B.V[1] ? 1.0f : 0.0f, A.V[2] <= B.V[2] ? 1.0f : 0.0f, A.V[3] <= B.V[3] ? 1.0f : 0.0f } }; }
+    inline VectorRegister VectorBitwiseAnd(const VectorRegister& A, const VectorRegister& B) { return VectorMultiply(A, B); }
+    inline VectorRegister VectorSelect(const VectorRegister& Mask, const VectorRegister& A, const VectorRegister& B) { return VectorRegister{ { Mask.V[0] != 0.0f ? A.V[0] : B.V[0], Mask.V[1] != 0.0f ? A.V[1] : B.V[1], Mask.V[2] != 0.0f ? A.V[2] : B.V[2], Mask.V[3] != 0.0f ? A.V[3] : B.V[3] } }; }
+    inline int32 VectorMaskBits(const VectorRegister& Mask) { return (Mask.V[0] != 0.0f ? 1 : 0) | (Mask.V[1] != 0.0f ? 2 : 0) | (Mask.V[2] != 0.0f ? 4 : 0) | (Mask.V[3] != 0.0f ? 8 : 0); }
+#endif
+
+    // Horizontal reductions
+    inline float VectorHorizontalMin(const VectorRegister& Vec)
+    {
+        float Lanes[4];
+        VectorStore(Vec, Lanes);
+        return std::min(std::min(Lanes[0], Lanes[1]), std::min(Lanes[2], Lanes[3]));
+    }
+
+    inline float VectorHorizontalMax(const VectorRegister& Vec)
+    {
+        float Lanes[4];
+        VectorStore(Vec, Lanes);
+        return std::max(std::max(Lanes[0], Lanes[1]), std::max(Lanes[2], Lanes[3]));
+    }
+
+    // Four vectors spread over X, Y and Z registers - lane i is vector i
+    struct VectorRegister3x4
+    {
+        VectorRegister X;
+        VectorRegister Y;
+        VectorRegister Z;
+    };
+
+    // Loads four packed FVectors (12 floats) and transposes them into component registers
+    inline VectorRegister3x4 VectorLoadTransposed(const FVector* Vectors)
+    {
+        const float* Data = &Vectors[0].X;
+        VectorRegister3x4 Result;
+#if UE4SDK_SIMD_SSE
+        // A = x0 y0 z0 x1, B = y1 z1 x2 y2, C = z2 x3 y3 z3
+        __m128 A = _mm_loadu_ps(Data);
+        __m128 B = _mm_loadu_ps(Data + 4);
+        __m128 C = _mm_loadu_ps(Data + 8);
+
+        __m128 B2C1 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2));
+        Result.X = _mm_shuffle_ps(A, B2C1, _MM_SHUFFLE(2, 0, 3, 0));
+
+        __m128 A1B0 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1));
+        __m128 B3C2 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3));
+        Result.Y = _mm_shuffle_ps(A1B0, B3C2, _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 A2B1 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2));
+        __m128 C0C3 = _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0));
+        Result.Z = _mm_shuffle_ps(A2B1, C0C3, _MM_SHUFFLE(2, 0, 2, 0));
+#else
+        Result.X = MakeVectorRegister(Data[0], Data[3], Data[6], Data[9]);
+        Result.Y = MakeVectorRegister(Data[1], Data[4], Data[7], Data[10]);
+        Result.Z = MakeVectorRegister(Data[2], Data[5], Data[8], Data[11]);
+#endif
+        return Result;
+    }
+
+    // Inverse of VectorLoadTransposed
+    inline void VectorStoreTransposed(const VectorRegister3x4& Vec, FVector* Vectors)
+    {
+        float* Data = &Vectors[0].X;
+#if UE4SDK_SIMD_SSE
+        __m128 X0Y0 = _mm_shuffle_ps(Vec.X, Vec.Y, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 Z0X1 = _mm_shuffle_ps(Vec.Z, Vec.X, _MM_SHUFFLE(1, 1, 0, 0));
+        _mm_storeu_ps(Data, _mm_shuffle_ps(X0Y0, Z0X1, _MM_SHUFFLE(2, 0, 2, 0)));
+
+        __m128 Y1Z1 = _mm_shuffle_ps(Vec.Y, Vec.Z, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 X2Y2 = _mm_shuffle_ps(Vec.X, Vec.Y, _MM_SHUFFLE(2, 2, 2, 2));
+        _mm_storeu_ps(Data + 4, _mm_shuffle_ps(Y1Z1, X2Y2, _MM_SHUFFLE(2, 0, 2, 0)));
+
+        __m128 Z2X3 = _mm_shuffle_ps(Vec.Z, Vec.X, _MM_SHUFFLE(3, 3, 2, 2));
+        __m128 Y3Z3 = _mm_shuffle_ps(Vec.Y, Vec.Z, _MM_SHUFFLE(3, 3, 3, 3));
+        _mm_storeu_ps(Data + 8, _mm_shuffle_ps(Z2X3, Y3Z3, _MM_SHUFFLE(2, 0, 2, 0)));
+#else
+        for (int32 i = 0; i < 4; ++i)
+        {
+            Data[i * 3 + 0] = Vec.X.V[i];
+            Data[i * 3 + 1] = Vec.Y.V[i];
+            Data[i * 3 + 2] = Vec.Z.V[i];
+        }
+#endif
+    }
+
+    // A quaternion broadcast across lanes, for rotating four vectors at once
+    struct QuatRegister
+    {
+        VectorRegister X;
+        VectorRegister Y;
+        VectorRegister Z;
+        VectorRegister W;
+
+        explicit QuatRegister(const FQuat& Quat)
+            : X(VectorSetFloat1(Quat.X)), Y(VectorSetFloat1(Quat.Y)), Z(VectorSetFloat1(Quat.Z)), W(VectorSetFloat1(Quat.W)) {}
+    };
+
+    // Same math as FQuat::RotateVector, four vectors per call
+    inline VectorRegister3x4 VectorQuaternionRotate(const QuatRegister& Q, const VectorRegister3x4& V)
+    {
+        VectorRegister Two = VectorSetFloat1(2.0f);
+        VectorRegister TX = VectorMultiply(Two, VectorSubtract(VectorMultiply(Q.Y, V.Z), VectorMultiply(Q.Z, V.Y)));
+        VectorRegister TY = VectorMultiply(Two, VectorSubtract(VectorMultiply(Q.Z, V.X), VectorMultiply(Q.X, V.Z)));
+        VectorRegister TZ = VectorMultiply(Two, VectorSubtract(VectorMultiply(Q.X, V.Y), VectorMultiply(Q.Y, V.X)));
+
+        VectorRegister3x4 Result;
+        Result.X = VectorAdd(VectorMultiplyAdd(Q.W, TX, V.X), VectorSubtract(VectorMultiply(Q.Y, TZ), VectorMultiply(Q.Z, TY)));
+        Result.Y = VectorAdd(VectorMultiplyAdd(Q.W, TY, V.Y), VectorSubtract(VectorMultiply(Q.Z, TX), VectorMultiply(Q.X, TZ)));
+        Result.Z = VectorAdd(VectorMultiplyAdd(Q.W, TZ, V.Z), VectorSubtract(VectorMultiply(Q.X, TY), VectorMultiply(Q.Y, TX)));
+        return Result;
+    }
+
+    // Batch kernels - In and Out may be the same array. Four vectors per iteration, the remainder goes through the scalar math.
+    inline void RotateVectors(const FQuat& Rotation, const FVector* In, FVector* Out, int32 Count)
+    {
+        QuatRegister Q(Rotation);
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorStoreTransposed(VectorQuaternionRotate(Q, VectorLoadTransposed(In + i)), Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = Rotation.RotateVector(In[i]);
+        }
+    }
+
+    inline void TransformVectors(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        QuatRegister Q(Transform.Rotation);
+        VectorRegister ScaleX = VectorSetFloat1(Transform.Scale3D.X);
+        VectorRegister ScaleY = VectorSetFloat1(Transform.Scale3D.Y);
+        VectorRegister ScaleZ = VectorSetFloat1(Transform.Scale3D.Z);
+
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V = VectorLoadTransposed(In + i);
+            V.X = VectorMultiply(V.X, ScaleX);
+            V.Y = VectorMultiply(V.Y, ScaleY);
+            V.Z = VectorMultiply(V.Z, ScaleZ);
+            VectorStoreTransposed(VectorQuaternionRotate(Q, V), Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = Transform.TransformVector(In[i]);
+        }
+    }
+
+    inline void TransformPositions(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        QuatRegister Q(Transform.Rotation);
+        VectorRegister ScaleX = VectorSetFloat1(Transform.Scale3D.X);
+        VectorRegister ScaleY = VectorSetFloat1(Transform.Scale3D.Y);
+        VectorRegister ScaleZ = VectorSetFloat1(Transform.Scale3D.Z);
+        VectorRegister TranslationX = VectorSetFloat1(Transform.Translation.X);
+        VectorRegister TranslationY = VectorSetFloat1(Transform.Translation.Y);
+        VectorRegister TranslationZ = VectorSetFloat1(Transform.Translation.Z);
+
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V = VectorLoadTransposed(In + i);
+            V.X = VectorMultiply(V.X, ScaleX);
+            V.Y = VectorMultiply(V.Y, ScaleY);
+            V.Z = VectorMultiply(V.Z, ScaleZ);
+            V = VectorQuaternionRotate(Q, V);
+            V.X = VectorAdd(V.X, TranslationX);
+            V.Y = VectorAdd(V.Y, TranslationY);
+            V.Z = VectorAdd(V.Z, TranslationZ);
+            VectorStoreTransposed(V, Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = Transform.TransformPosition(In[i]);
+        }
+    }
+
+    // One transform per position, e.g. every bone's pivot or every actor's local offset
+    inline void TransformPositions(const FTransform* Transforms, const FVector* In, FVector* Out, int32 Count)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Out[i] = Transforms[i].TransformPosition(In[i]);
+        }
+    }
+
+    inline void InverseTransformPositions(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        QuatRegister Q(Transform.Rotation.Inverse());
+        VectorRegister InvScaleX = VectorSetFloat1(1.0f / Transform.Scale3D.X);
+        VectorRegister InvScaleY = VectorSetFloat1(1.0f / Transform.Scale3D.Y);
+        VectorRegister InvScaleZ = VectorSetFloat1(1.0f / Transform.Scale3D.Z);
+        VectorRegister TranslationX = VectorSetFloat1(Transform.Translation.X);
+        VectorRegister TranslationY = VectorSetFloat1(Transform.Translation.Y);
+        VectorRegister TranslationZ = VectorSetFloat1(Transform.Translation.Z);
+
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V = VectorLoadTransposed(In + i);
+            V.X = VectorSubtract(V.X, TranslationX);
+            V.Y = VectorSubtract(V.Y, TranslationY);
+            V.Z = VectorSubtract(V.Z, TranslationZ);
+            V = VectorQuaternionRotate(Q, V);
+            V.X = VectorMultiply(V.X, InvScaleX);
+            V.Y = VectorMultiply(V.Y, InvScaleY);
+            V.Z = VectorMultiply(V.Z, InvScaleZ);
+            VectorStoreTransposed(V, Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = Transform.InverseTransformPosition(In[i]);
+        }
+    }
+
+    // Composes every child with its parent transform, e.g. local bone poses into component space
+    inline void ComposeTransforms(const FTransform* Parents, const FTransform* Locals, FTransform* Out, int32 Count)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Out[i] = Parents[i] * Locals[i];
+        }
+    }
+}
@@ -0,0 +1,417 @@
+/*
+ * UE4 Vector Stream Implementation - Self-contained structure-of-arrays vector container implementation
+ * Vibe coder approved ✨
+ */
+
+#include "VectorStream.h"
+#include "VectorRegister.h"
+#include "Matrix.h"
+#include <limits>
+
+namespace UE4SDK
+{
+    namespace
+    {
+        // Appends the indices of set lanes, lane i is index Base + i
+        void AppendMaskedIndices(int32 Mask, int32 Base, TArray<int32>& OutIndices)
+        {
+            for (int32 Lane = 0; Mask != 0; ++Lane, Mask >>= 1)
+            {
+                if (Mask & 1)
+                {
+                    OutIndices.Add(Base + Lane);
+                }
+            }
+        }
+    }
+
+    void FVectorSoA::FromVectors(const FVector* Vectors, int32 Count)
+    {
+        SetNum(Count);
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V = VectorLoadTransposed(Vectors + i);
+            VectorStore(V.X, &m_X[i]);
+            VectorStore(V.Y, &m_Y[i]);
+            VectorStore(V.Z, &m_Z[i]);
+        }
+        for (; i < Count; ++i)
+        {
+            Set(i, Vectors[i]);
+        }
+    }
+
+    void FVectorSoA::ToArray(TArray<FVector>& OutVectors) const
+    {
+        int32 Count = Num();
+        OutVectors.SetNum(Count);
+        FVector* Vectors = OutVectors.GetData();
+
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V;
+            V.X = VectorLoad(&m_X[i]);
+            V.Y = VectorLoad(&m_Y[i]);
+            V.Z = VectorLoad(&m_Z[i]);
+            VectorStoreTransposed(V, Vectors + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Vectors[i] = Get(i);
+        }
+    }
+
+    void FVectorSoA::RemoveAtSwap(int32 Index)
+    {
+        int32 Last = Num() - 1;
+        if (Index != Last)
+        {
+            Set(Index, Get(Last));
+        }
+        m_X.pop_back();
+        m_Y.pop_back();
+        m_Z.pop_back();
+    }
+
+    void FVectorSoA::Translate(const FVector& Offset)
+    {
+        int32 Count = Num();
+        const float Offsets[3] = { Offset.X, Offset.Y, Offset.Z };
+        FloatArray* Columns[3] = { &m_X, &m_Y, &m_Z };
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float* Values = Columns[Axis]->data();
+            VectorRegister Add = VectorSetFloat1(Offsets[Axis]);
+
+            int32 i = 0;
+            for (; i + 4 <= Count; i += 4)
+            {
+                VectorStore(VectorAdd(VectorLoad(Values + i), Add), Values + i);
+            }
+            for (; i < Count; ++i)
+            {
+                Values[i] += Offsets[Axis];
+            }
+        }
+    }
+
+    void FVectorSoA::Add(const FVectorSoA& Other)
+    {
+        int32 Count = std::min(Num(), Other.Num());
+        FloatArray* Columns[3] = { &m_X, &m_Y, &m_Z };
+        const FloatArray* OtherColumns[3] = { &Other.m_X, &Other.m_Y, &Other.m_Z };
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float* Values = Columns[Axis]->data();
+            const float* OtherValues = OtherColumns[Axis]->data();
+
+            int32 i = 0;
+            for (; i + 4 <= Count; i += 4)
+            {
+                VectorStore(VectorAdd(VectorLoad(Values + i), VectorLoad(OtherValues + i)), Values + i);
+            }
+            for (; i < Count; ++i)
+            {
+                Values[i] += OtherValues[i];
+            }
+        }
+    }
+
+    void FVectorSoA::Scale(float Factor)
+    {
+        Scale(FVector(Factor));
+    }
+
+    void FVectorSoA::Scale(const FVector& Factor)
+    {
+        int32 Count = Num();
+        const float Factors[3] = { Factor.X, Factor.Y, Factor.Z };
+        FloatArray* Columns[3] = { &m_X, &m_Y, &m_Z };
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float* Values = Columns[Axis]->data();
+            VectorRegister Scale = VectorSetFloat1(Factors[Axis]);
+
+            int32 i = 0;
+            for (; i + 4 <= Count; i += 4)
+            {
+                VectorStore(VectorMultiply(VectorLoad(Values + i), Scale), Values + i);
+            }
+            for (; i < Count; ++i)
+            {
+                Values[i] *= Factors[Axis];
+            }
+        }
+    }
+
+    void FVectorSoA::TransformPositions(const FTransform& Transform)
+    {
+        // Already in component registers, so this is the batch kernel minus the transposes
+        QuatRegister Q(Transform.Rotation);
+        VectorRegister ScaleX = VectorSetFloat1(Transform.Scale3D.X);
+        VectorRegister ScaleY = VectorSetFloat1(Transform.Scale3D.Y);
+        VectorRegister ScaleZ = VectorSetFloat1(Transform.Scale3D.Z);
+        VectorRegister TranslationX = VectorSetFloat1(Transform.Translation.X);
+        VectorRegister TranslationY = VectorSetFloat1(Transform.Translation.Y);
+        VectorRegister TranslationZ = VectorSetFloat1(Transform.Translation.Z);
+
+        int32 Count = Num();
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister3x4 V;
+            V.X = VectorMultiply(VectorLoad(&m_X[i]), ScaleX);
+            V.Y = VectorMultiply(VectorLoad(&m_Y[i]), ScaleY);
+            V.Z = VectorMultiply(VectorLoad(&m_Z[i]), ScaleZ);
+            V = VectorQuaternionRotate(Q, V);
+            VectorStore(VectorAdd(V.X, TranslationX), &m_X[i]);
+            VectorStore(VectorAdd(V.Y, TranslationY), &m_Y[i]);
+            VectorStore(VectorAdd(V.Z, TranslationZ), &m_Z[i]);
+        }
+        for (; i < Count; ++i)
+        {
+            Set(i, Transform.TransformPosition(Get(i)));
+        }
+    }
+
+    void FVectorSoA::Dot(const FVector& Direction, float* Out) const
+    {
+        VectorRegister DirX = VectorSetFloat1(Direction.X);
+        VectorRegister DirY = VectorSetFloat1(Direction.Y);
+        VectorRegister DirZ = VectorSetFloat1(Direction.Z);
+
+        int32 Count = Num();
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister Result = VectorMultiply(VectorLoad(&m_X[i]), DirX);
+            Result = VectorMultiplyAdd(VectorLoad(&m_Y[i]), DirY, Result);
+            Result = VectorMultiplyAdd(VectorLoad(&m_Z[i]), DirZ, Result);
+            VectorStore(Result, Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = m_X[i] * Direction.X + m_Y[i] * Direction.Y + m_Z[i] * Direction.Z;
+        }
+    }
+
+    void FVectorSoA::DistanceSquared(const FVector& Point, float* Out) const
+    {
+        VectorRegister PointX = VectorSetFloat1(Point.X);
+        VectorRegister PointY = VectorSetFloat1(Point.Y);
+        VectorRegister PointZ = VectorSetFloat1(Point.Z);
+
+        int32 Count = Num();
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister DX = VectorSubtract(VectorLoad(&m_X[i]), PointX);
+            VectorRegister DY = VectorSubtract(VectorLoad(&m_Y[i]), PointY);
+            VectorRegister DZ = VectorSubtract(VectorLoad(&m_Z[i]), PointZ);
+            VectorStore(VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))), Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            float DX = m_X[i] - Point.X;
+            float DY = m_Y[i] - Point.Y;
+            float DZ = m_Z[i] - Point.Z;
+            Out[i] = DX * DX + DY * DY + DZ * DZ;
+        }
+    }
+
+    void FVectorSoA::Distance(const FVector& Point, float* Out) const
+    {
+        DistanceSquared(Point, Out);
+
+        int32 Count = Num();
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorStore(VectorSqrt(VectorLoad(Out + i)), Out + i);
+        }
+        for (; i < Count; ++i)
+        {
+            Out[i] = std::sqrt(Out[i]);
+        }
+    }
+
+    bool FVectorSoA::GetBounds(FVector& OutMin, FVector& OutMax) const
+    {
+        int32 Count = Num();
+        if (Count == 0)
+        {
+            return false;
+        }
+
+        const FloatArray* Columns[3] = { &m_X, &m_Y, &m_Z };
+        float Mins[3];
+        float Maxs[3];
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float* Values = Columns[Axis]->data();
+            float Min = Values[0];
+            float Max = Values[0];
+
+            int32 i = 0;
+            if (Count >= 4)
+            {
+                VectorRegister MinLanes = VectorLoad(Values);
+                VectorRegister MaxLanes = MinLanes;
+                for (i = 4; i + 4 <= Count; i += 4)
+                {
+                    VectorRegister Lanes = VectorLoad(Values + i);
+                    MinLanes = VectorMin(MinLanes, Lanes);
+                    MaxLanes = VectorMax(MaxLanes, Lanes);
+                }
+                Min = VectorHorizontalMin(MinLanes);
+                Max = VectorHorizontalMax(MaxLanes);
+            }
+            for (; i < Count; ++i)
+            {
+                Min = std::min(Min, Values[i]);
+                Max = std::max(Max, Values[i]);
+            }
+
+            Mins[Axis] = Min;
+            Maxs[Axis] = Max;
+        }
+
+        OutMin = FVector(Mins[0], Mins[1], Mins[2]);
+        OutMax = FVector(Maxs[0], Maxs[1], Maxs[2]);
+        return true;
+    }
+
+    int32 FVectorSoA::FindClosest(const FVector& Point, float* OutDistanceSquared) const
+    {
+        int32 Count = Num();
+        if (Count == 0)
+        {
+            return -1;
+        }
+
+        VectorRegister PointX = VectorSetFloat1(Point.X);
+        VectorRegister PointY = VectorSetFloat1(Point.Y);
+        VectorRegister PointZ = VectorSetFloat1(Point.Z);
+
+        // Each lane keeps its own best distance and index, indices are floats so they can be selected like distances
+        float Best = std::numeric_limits<float>::max();
+        int32 BestIndex = 0;
+        int32 i = 0;
+        if (Count >= 4)
+        {
+            VectorRegister BestLanes = VectorSetFloat1(Best);
+            VectorRegister BestIndexLanes = VectorSetFloat1(0.0f);
+            VectorRegister IndexLanes = MakeVectorRegister(0.0f, 1.0f, 2.0f, 3.0f);
+            VectorRegister Four = VectorSetFloat1(4.0f);
+            for (; i + 4 <= Count; i += 4)
+            {
+                VectorRegister DX = VectorSubtract(VectorLoad(&m_X[i]), PointX);
+                VectorRegister DY = VectorSubtract(VectorLoad(&m_Y[i]), PointY);
+                VectorRegister DZ = VectorSubtract(VectorLoad(&m_Z[i]), PointZ);
+                VectorRegister DistanceSquared = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+
+                VectorRegister Closer = VectorCompareLT(DistanceSquared, BestLanes);
+                BestLanes = VectorSelect(Closer, DistanceSquared, BestLanes);
+                BestIndexLanes = VectorSelect(Closer, IndexLanes, BestIndexLanes);
+                IndexLanes = VectorAdd(IndexLanes, Four);
+            }
+
+            float Distances[4];
+            float Indices[4];
+            VectorStore(BestLanes, Distances);
+            VectorStore(BestIndexLanes, Indices);
+            for (int32 Lane = 0; Lane < 4; ++Lane)
+            {
+                int32 LaneIndex = static_cast<int32>(Indices[Lane]);
+                if (Distances[Lane] < Best || (Distances[Lane] == Best && LaneIndex < BestIndex))
+                {
+                    Best = Distances[Lane];
+                    BestIndex = LaneIndex;
+                }
+            }
+        }
+        for (; i < Count; ++i)
+        {
+            float DX = m_X[i] - Point.X;
+            float DY = m_Y[i] - Point.Y;
+            float DZ = m_Z[i] - Point.Z;
+            float DistanceSquared = DX * DX + DY * DY + DZ * DZ;
+            if (DistanceSquared < Best)
+            {
+                Best = DistanceSquared;
+                BestIndex = i;
+            }
+        }
+
+        if (OutDistanceSquared)
+        {
+            *OutDistanceSquared = Best;
+        }
+        return BestIndex;
+    }
+
+    void FVectorSoA::CullSphere(const FVector& Center, float Radius, TArray<int32>& OutIndices) const
+    {
+        VectorRegister CenterX = VectorSetFloat1(Center.X);
+        VectorRegister CenterY = VectorSetFloat1(Center.Y);
+        VectorRegister CenterZ = VectorSetFloat1(Center.Z);
+        VectorRegister RadiusSquared = VectorSetFloat1(Radius * Radius);
+
+        int32 Count = Num();
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister DX = VectorSubtract(VectorLoad(&m_X[i]), CenterX);
+            VectorRegister DY = VectorSubtract(VectorLoad(&m_Y[i]), CenterY);
+            VectorRegister DZ = VectorSubtract(VectorLoad(&m_Z[i]), CenterZ);
+            VectorRegister DistanceSquared = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+            AppendMaskedIndices(VectorMaskBits(VectorCompareLE(DistanceSquared, RadiusSquared)), i, OutIndices);
+        }
+        for (; i < Count; ++i)
+        {
+            if ((Get(i) - Center).SizeSquared() <= Radius * Radius)
+            {
+                OutIndices.Add(i);
+            }
+        }
+    }
+
+    void FVectorSoA::CullFrustum(const FPlane* Planes, int32 PlaneCount, float Radius, TArray<int32>& OutIndices) const
+    {
+        int32 Count = Num();
+        int32 i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            VectorRegister X = VectorLoad(&m_X[i]);
+            VectorRegister Y = VectorLoad(&m_Y[i]);
+            VectorRegister Z = VectorLoad(&m_Z[i]);
+
+            // Every plane has to pass, so four vectors stop testing as soon as all of them are out
+            int32 Mask = 0xF;
+            for (int32 Plane = 0; Plane < PlaneCount && Mask != 0; ++Plane)
+            {
+                const FPlane& Bound = Planes[Plane];
+                VectorRegister Side = VectorMultiply(X, VectorSetFloat1(Bound.X));
+                Side = VectorMultiplyAdd(Y, VectorSetFloat1(Bound.Y), Side);
+                Side = VectorMultiplyAdd(Z, VectorSetFloat1(Bound.Z), Side);
+                Mask &= VectorMaskBits(VectorCompareLE(Side, VectorSetFloat1(Bound.W + Radius)));
+            }
+            AppendMaskedIndices(Mask, i, OutIndices);
+        }
+        for (; i < Count; ++i)
+        {
+            FVector Point = Get(i);
+            bool bInside = true;
+            for (int32 Plane = 0; Plane < PlaneCount && bInside; ++Plane)
+            {
+                bInside = Planes[Plane].PlaneDot(Point) <= Radius;
+            }
+            if (bInside)
+            {
+                OutIndices.Add(i);
+            }
+        }
+    }
+}
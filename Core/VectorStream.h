@@ -0,0 +1,127 @@
+/*
+ * UE4 Vector Stream - Self-contained structure-of-arrays vector container for bulk math
+ * Vibe coder approved ✨
+ */
+
+#pragma once
+
+#include "Types.h"
+#include <cstdlib>
+#include <new>
+
+namespace UE4SDK
+{
+    class FPlane; // Core/Matrix.h
+
+    // Allocator for SIMD-friendly buffers - every allocation starts on an Alignment boundary
+    template<typename T, size_t Alignment>
+    struct TAlignedAllocator
+    {
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = TAlignedAllocator<U, Alignment>;
+        };
+
+        TAlignedAllocator() = default;
+        template<typename U>
+        TAlignedAllocator(const TAlignedAllocator<U, Alignment>&) {}
+
+        T* allocate(size_t Count)
+        {
+            // Rounded up to the alignment, aligned_alloc requires it
+            size_t Bytes = (Count * sizeof(T) + Alignment - 1) / Alignment * Alignment;
+#if defined(_MSC_VER)
+            void* Memory = _aligned_malloc(Bytes, Alignment);
+#else
+            void* Memory = std::aligned_alloc(Alignment, Bytes);
+#endif
+            if (!Memory)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(Memory);
+        }
+
+        void deallocate(T* Memory, size_t)
+        {
+#if defined(_MSC_VER)
+            _aligned_free(Memory);
+#else
+            std::free(Memory);
+#endif
+        }
+
+        template<typename U>
+        bool operator==(const TAlignedAllocator<U, Alignment>&) const { return true; }
+        template<typename U>
+        bool operator!=(const TAlignedAllocator<U, Alignment>&) const { return false; }
+    };
+
+    // Vector stream - vectors stored as separate X, Y and Z float arrays, 32 byte aligned.
+    // Bulk operations run four vectors per SSE register without shuffling, which TArray<FVector> can't.
+    // Convert once, run as many queries as needed, convert back if the results are positions.
+    class FVectorSoA
+    {
+    public:
+        using FloatArray = std::vector<float, TAlignedAllocator<float, 32>>;
+
+        FVectorSoA() = default;
+        explicit FVectorSoA(const TArray<FVector>& Vectors) { FromArray(Vectors); }
+
+        // Conversion
+        void FromArray(const TArray<FVector>& Vectors) { FromVectors(Vectors.GetData(), Vectors.Num()); }
+        void FromVectors(const FVector* Vectors, int32 Count);
+        void ToArray(TArray<FVector>& OutVectors) const;
+        TArray<FVector> ToArray() const { TArray<FVector> Result; ToArray(Result); return Result; }
+
+        // Element access
+        int32 Num() const { return static_cast<int32>(m_X.size()); }
+        bool IsEmpty() const { return m_X.empty(); }
+        void Reserve(int32 Count) { m_X.reserve(Count); m_Y.reserve(Count); m_Z.reserve(Count); }
+        void SetNum(int32 Count) { m_X.resize(Count, 0.0f); m_Y.resize(Count, 0.0f); m_Z.resize(Count, 0.0f); }
+        void Empty() { m_X.clear(); m_Y.clear(); m_Z.clear(); }
+
+        int32 Add(const FVector& Vector) { m_X.push_back(Vector.X); m_Y.push_back(Vector.Y); m_Z.push_back(Vector.Z); return Num() - 1; }
+        void Set(int32 Index, const FVector& Vector) { m_X[Index] = Vector.X; m_Y[Index] = Vector.Y; m_Z[Index] = Vector.Z; }
+        FVector Get(int32 Index) const { return FVector(m_X[Index], m_Y[Index], m_Z[Index]); }
+        void RemoveAtSwap(int32 Index);
+
+        float* GetX() { return m_X.data(); }
+        float* GetY() { return m_Y.data(); }
+        float* GetZ() { return m_Z.data(); }
+        const float* GetX() const { return m_X.data(); }
+        const float* GetY() const { return m_Y.data(); }
+        const float* GetZ() const { return m_Z.data(); }
+
+        // In-place arithmetic
+        void Translate(const FVector& Offset);
+        void Add(const FVectorSoA& Other); // Element-wise, Other must be the same size
+        void Scale(float Factor);
+        void Scale(const FVector& Factor);
+        void TransformPositions(const FTransform& Transform);
+
+        // Per-element results - Out must hold Num() floats
+        void Dot(const FVector& Direction, float* Out) const;
+        void DistanceSquared(const FVector& Point, float* Out) const;
+        void Distance(const FVector& Point, float* Out) const;
+
+        // Reductions
+        bool GetBounds(FVector& OutMin, FVector& OutMax) const; // False when empty
+        int32 FindClosest(const FVector& Point, float* OutDistanceSquared = nullptr) const; // -1 when empty
+
+        // Culling - appends the indices of vectors that pass, in order
+        void CullSphere(const FVector& Center, float Radius, TArray<int32>& OutIndices) const;
+
+        // Planes face outwards: a vector is inside when PlaneDot(V) <= Radius for every plane.
+        // Radius treats every vector as a sphere of that size, zero tests points.
+        void CullFrustum(const FPlane* Planes, int32 PlaneCount, float Radius, TArray<int32>& OutIndices) const;
+
+    private:
+        FloatArray m_X;
+        FloatArray m_Y;
+        FloatArray m_Z;
+    };
+}
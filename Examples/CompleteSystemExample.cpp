@@ -110,7 +110,6 @@ int main()
         // Create AI controller
         AIController* AIController = new AIController();
         AIController->SetActive(true);
-        AIController->SetUpdateFrequency(2.0f);
         
         // Create behavior tree
         BehaviorTree* AITree = new BehaviorTree();
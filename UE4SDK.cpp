@@ -8,9 +8,28 @@
 #include "Core/Utils.h"
 #include "Core/UObject.h"
 #include "Core/AI.h"
+#include "Core/AIScheduler.h"
+#include "Core/UtilityAI.h"
+#include "Core/AIPerception.h"
+#include "Core/LatentTask.h"
 #include "Core/Navigation.h"
 #include "Core/Blackboard.h"
 #include "Core/Replication.h"
+#include "Core/NetSerialization.h"
+#include "Core/NetRelevancy.h"
+#include "Core/NetTransport.h"
+#include "Core/ReplicationBenchmark.h"
+#include "Core/NetFastArray.h"
+#include "Core/NetInterpolation.h"
+#include "Core/VectorRegister.h"
+#include "Core/VectorStream.h"
+#include "Core/Matrix.h"
+#include "Core/SpatialIndex.h"
+#include "Core/JobSystem.h"
+#include "Core/Profiler.h"
+#include "Core/Stats.h"
+#include "Core/Logging.h"
+#include "Core/MemoryTracker.h"
 
 namespace UE4SDK
 {
@@ -144,8 +144,9 @@ namespace UE4SDK
 #define UE4_UTILS UE4_SDK.GetUtils()
 
 // Logging macros
+// Filtered messages are never formatted
 #define UE_LOG(Category, Verbosity, Format, ...) \
-    UE4SDK::Utils::Log(UE4SDK::Utils::FormatString(Format, ##__VA_ARGS__), UE4SDK::ELogVerbosity::Verbosity)
+    do { if (UE4SDK::LogSystem::IsEnabled(UE4SDK::ELogVerbosity::Verbosity)) { UE4SDK::Utils::Log(UE4SDK::Utils::FormatString(Format, ##__VA_ARGS__), UE4SDK::ELogVerbosity::Verbosity); } } while (0)
 
 #define UE_LOG_VERBOSE(Format, ...) UE_LOG(LogUE4SDK, Verbose, Format, ##__VA_ARGS__)
 #define UE_LOG_VERY_VERBOSE(Format, ...) UE_LOG(LogUE4SDK, VeryVerbose, Format, ##__VA_ARGS__)